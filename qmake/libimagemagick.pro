@@ -14,6 +14,7 @@ HEADERS += \
     $${SRC_DIR}/libgraphics/io/pipelineexporter.hpp \
     $${SRC_DIR}/libgraphics/io/pipelineimporter.hpp \
     $${SRC_DIR}/libgraphics/io/pipelineinfo.hpp \
+    $${SRC_DIR}/libgraphics/io/pipelineformatprobe.hpp \
     $${SRC_DIR}/libgraphics/io/pipelineplugin.hpp \
     $${SRC_DIR}/libgraphics/io/pipelineplugininfo.hpp \
 #    $${SRC_DIR}/libgraphics/io/pipelinepluginloader.hpp \
@@ -27,6 +28,7 @@ SOURCES += \
     $${SRC_DIR}/libgraphics/io/io_pipelineexporter.cpp \
     $${SRC_DIR}/libgraphics/io/io_pipelineimporter.cpp \
     $${SRC_DIR}/libgraphics/io/io_pipelineinfo.cpp \
+    $${SRC_DIR}/libgraphics/io/io_pipelineformatprobe.cpp \
     $${SRC_DIR}/libgraphics/io/io_pipelineplugin.cpp \
     $${SRC_DIR}/libgraphics/io/io_pipelineplugininfo.cpp \
 #    $${SRC_DIR}/libgraphics/io/io_pipelinepluginloader.cpp \
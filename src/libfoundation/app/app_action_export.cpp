@@ -184,6 +184,9 @@ bool ApplicationActionExport::doStreamlinedRendering( const ApplicationBackend*
             ) );
     assert( renderAction.get() );
 
+    /** peak memory of full size renders: each filter drops its buffers after its pass */
+    renderAction->setPlanBuffers( true );
+
     const bool successfullyRenderedCurrentState = renderAction->process();
     assert( successfullyRenderedCurrentState );
 
@@ -314,6 +317,9 @@ bool ApplicationActionExport::doCpuRendering( const ApplicationBackend* currentS
             ) );
     assert( renderAction.get() );
 
+    /** peak memory of full size renders: each filter drops its buffers after its pass */
+    renderAction->setPlanBuffers( true );
+
     const bool successfullyRenderedCurrentState = renderAction->process();
     assert( successfullyRenderedCurrentState );
 
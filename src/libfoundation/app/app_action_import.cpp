@@ -28,6 +28,9 @@ struct ApplicationActionImport::Private {
 
     libgraphics::Bitmap     bitmapIn;
 
+    /** images saved by libgraphics are mapped instead of decoded **/
+    std::unique_ptr<libgraphics::Image> imageIn;
+
     Private(
         ApplicationSession* _session,
         libgraphics::fxapi::ApiBackendDevice* _device,
@@ -48,6 +51,16 @@ ApplicationActionImport::ApplicationActionImport(
 }
 
 bool ApplicationActionImport::commit() {
+    if( d->imageIn ) {
+        this->d->session->resetImageState(
+            nullptr,
+            d->imageIn.release(),
+            this->d->path
+        );
+
+        return true;
+    }
+
     if( ( d->bitmapIn.width() == 0 ) || ( d->bitmapIn.height() == 0 ) ) {
 #ifdef LIBFOUNDATION_DEBUG_OUTPUT
         qDebug() << "ApplicationActionImport::commit(): Failed to commit corrupted image.";
@@ -105,6 +118,21 @@ bool ApplicationActionImport::commit() {
 }
 
 bool ApplicationActionImport::process() {
+    if( libgraphics::Image::isSerializedImage( d->path ) ) {
+        std::unique_ptr<libgraphics::Image> image( new libgraphics::Image() );
+
+        if( ( image->readFromFile( this->d->backend, d->path ) == 0 ) || image->empty() ) {
+#ifdef LIBFOUNDATION_DEBUG_OUTPUT
+            qDebug() << "ApplicationActionImport::process(): Failed to read serialized image from path.";
+#endif
+            return false;
+        }
+
+        d->imageIn = std::move( image );
+
+        return true;
+    }
+
     libgraphics::io::Pipeline*  ioPipeline = const_cast<libgraphics::io::Pipeline*>( this->d->session->pipeline() );
 
     assert( ioPipeline != nullptr );
@@ -2,6 +2,9 @@
 #include <libgraphics/allocator.hpp>
 #include <libfoundation/app/application.hpp>
 #include <libgraphics/fxapi.hpp>
+#include <libgraphics/memorygovernor.hpp>
+#include <libgraphics/scratchlayerpool.hpp>
+#include <libgraphics/systeminfo.hpp>
 #include <libgraphics/backend/gl/gl_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <QDebug>
@@ -41,7 +44,15 @@ ApplicationBackend::~ApplicationBackend() {
 
 void ApplicationBackend::initializeAllocators() {
     if( !d->alloc ) {
-        d->alloc.reset( new libgraphics::StdDynamicPoolAllocator() );
+        /** image planes of 32MB and more in huge pages **/
+        d->alloc.reset( new libgraphics::StdDynamicPoolAllocator(
+                            libgraphics::AllocatorPolicy(
+                                1,
+                                libgraphics::AllocatorPolicy::DefaultAlignment,
+                                true,
+                                libgraphics::AllocatorPolicy::DefaultHugePageThreshold
+                            )
+                        ) );
     }
 }
 
@@ -75,6 +86,17 @@ bool ApplicationBackend::initializeCpuBackend() {
     d->cpuInitialized = true;
     d->cpuBackend->setAllocator( d->alloc );
 
+    /** the layers and buffers of both backends are allocated from the shared pool **/
+    libgraphics::MemoryGovernor::global().attach( d->alloc );
+
+    /** the pool may use half of the physical memory, the default
+        budget stays if the memory can't be detected **/
+    const libgraphics::UInt64 physicalMemory = libgraphics::SystemInfo::queryPhysicalMemory();
+
+    if( physicalMemory > 0 ) {
+        libgraphics::MemoryGovernor::global().setMemoryBudget( ( size_t )( physicalMemory / 2 ) );
+    }
+
     return true;
 }
 
@@ -121,6 +143,9 @@ bool ApplicationBackend::shutdownCpuBackend() {
         return false;
     }
 
+    libgraphics::ScratchLayerPool::global().clear( d->cpuBackend );
+    libgraphics::MemoryGovernor::global().detach( d->alloc );
+
     const bool successfullyShutdownCpuBackend = d->cpuBackend->shutdown();
     assert( successfullyShutdownCpuBackend );
 
@@ -140,6 +165,8 @@ bool ApplicationBackend::shutdownCpuBackend() {
 
 bool ApplicationBackend::shutdownGpuBackend() {
 
+    libgraphics::ScratchLayerPool::global().clear( d->gpuBackend );
+
     const bool successfullyShutdownGpuBackend = d->gpuBackend->shutdown();
     assert( successfullyShutdownGpuBackend );
 
@@ -192,6 +219,8 @@ bool ApplicationBackend::gpuInitialized() const {
 }
 
 void ApplicationBackend::cleanUp() {
+    libgraphics::ScratchLayerPool::global().clear();
+
     const auto numberOfReleasedCPUObjects = cpuBackend()->cleanUp();
     qDebug() << "Info:      Cleaned up" << numberOfReleasedCPUObjects << " objects from cpu-backend.";
 
@@ -6,9 +6,14 @@
 #include <libgraphics/filter.hpp>
 #include <libgraphics/filtercollection.hpp>
 #include <libgraphics/filterstack.hpp>
+#include <libgraphics/filterchain.hpp>
+#include <libgraphics/filterresultcache.hpp>
+#include <libgraphics/memorygovernor.hpp>
+#include <libgraphics/scratchlayerpool.hpp>
 #include <libgraphics/filterpreset.hpp>
 #include <libgraphics/filterpresetcollection.hpp>
 #include <libgraphics/fxapi.hpp>
+#include <libgraphics/cancellation.hpp>
 #include <libgraphics/backend/gl/gl_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
@@ -26,6 +31,7 @@
 #include <QProcess>
 #include <QCoreApplication>
 
+#include <algorithm>
 #include <cstdlib>
 
 namespace libfoundation {
@@ -40,7 +46,7 @@ struct ActionRunnable : QRunnable {
         virtual void run() {
             const auto successfullyProcessed = m_Action->process();
 
-            if( !successfullyProcessed ) {
+            if( !successfullyProcessed && !m_Action->cancelled() ) {
 #ifdef LIBFOUNDATION_DEBUG_OUTPUT
                 qDebug() << "Failed to process action. Aborting...";
 #endif
@@ -89,7 +95,16 @@ struct ApplicationSession::Private {
 
     std::recursive_mutex       mutex;
 
-    Private() : maxThreadCount( 0 ), imageOrigin( EImageOrigin::Unknown ), previewBackend( nullptr ) {}
+    /// latest-wins state of asyncUpdatePreview()
+    std::mutex                                          previewMutex;
+    std::shared_ptr<libgraphics::CancellationToken>     latestPreviewToken;
+    std::shared_ptr<std::mutex>                         previewRenderLock;
+
+    /// intermediate results of the preview filters
+    std::shared_ptr<libgraphics::FilterResultCache>     previewResultCache;
+
+    Private() : maxThreadCount( 0 ), imageOrigin( EImageOrigin::Unknown ), previewBackend( nullptr ),
+        previewRenderLock( new std::mutex() ), previewResultCache( new libgraphics::FilterResultCache() ) {}
 
     bool isMandatoryFilter( libgraphics::Filter* filter ) const {
         if( filter == nullptr ) {
@@ -319,6 +334,19 @@ libgraphics::fxapi::ApiBackendDevice*   ApplicationSession::previewBackend() con
 
 void ApplicationSession::setPreviewBackend( libgraphics::fxapi::ApiBackendDevice* previewBackend ) {
     this->d->previewBackend = previewBackend;
+    this->d->previewResultCache->clear();
+}
+
+size_t ApplicationSession::previewCacheBudget() const {
+    return this->d->previewResultCache->memoryBudget();
+}
+
+void ApplicationSession::setPreviewCacheBudget( size_t bytes ) {
+    this->d->previewResultCache->setMemoryBudget( bytes );
+}
+
+const std::shared_ptr<libgraphics::FilterResultCache>& ApplicationSession::previewResultCache() const {
+    return this->d->previewResultCache;
 }
 
 /// synchronization and serialization
@@ -1120,6 +1148,7 @@ bool ApplicationSession::updatePreview( bool _force ) {
             &this->d->filterStack
         )
     );
+    action->setResultCache( this->d->previewResultCache );
 
     const auto successfullyProcessedAction = action->process();
 
@@ -1151,13 +1180,31 @@ ApplicationActionRenderPreview* ApplicationSession::asyncUpdatePreview( bool _fo
         this->updateAllFilters();
     }
 
-    return new libfoundation::app::ApplicationActionRenderPreview(
-               this,
-               this->previewBackend(),
-               this->d->previewImage->layers().front().get(),
-               this->d->previewImage->layers().at( 1 ).get(),
-               &this->d->filterStack
-           );
+    libfoundation::app::ApplicationActionRenderPreview* preview = new libfoundation::app::ApplicationActionRenderPreview(
+        this,
+        this->previewBackend(),
+        this->d->previewImage->layers().front().get(),
+        this->d->previewImage->layers().at( 1 ).get(),
+        &this->d->filterStack
+    );
+    assert( preview );
+
+    /// all previews render into the same layers, run them one
+    /// after another and drop the superseded request.
+    preview->setRenderLock( this->d->previewRenderLock );
+    preview->setResultCache( this->d->previewResultCache );
+
+    {
+        std::lock_guard<std::mutex> lock( this->d->previewMutex );
+
+        if( this->d->latestPreviewToken ) {
+            this->d->latestPreviewToken->cancel();
+        }
+
+        this->d->latestPreviewToken = preview->cancellationToken();
+    }
+
+    return preview;
 }
 
 bool ApplicationSession::renderToBitmap(
@@ -1301,6 +1348,7 @@ void ApplicationSession::reset() {
     this->d->filterCollection.clear();
     this->d->filterMetaInfo.clear();
 
+    this->d->previewResultCache->clear();
     this->d->previewImage.reset();
     this->d->originalImage.reset();
 
@@ -1360,6 +1408,7 @@ ApplicationSession* ApplicationSession::clone() {
 }
 
 void ApplicationSession::resetImageState() {
+    this->d->previewResultCache->clear();
     this->d->previewImage.reset();
     this->d->originalImage.reset();
 }
@@ -1368,6 +1417,8 @@ void ApplicationSession::resetImageState(
     libgraphics::Image* preview,
     libgraphics::Image* original
 ) {
+    this->d->previewResultCache->clear();
+
     if( preview != nullptr ) {
         this->d->previewImage.reset( preview );
     }
@@ -1398,13 +1449,77 @@ struct ApplicationActionRenderPreview::Private {
     libgraphics::FilterStack*   stack;
     const unsigned int          initialThreadId;
 
+    std::shared_ptr<libgraphics::CancellationToken> token;
+    std::shared_ptr<std::mutex>                     renderLock;
+    std::shared_ptr<libgraphics::FilterResultCache> resultCache;
+    libgraphics::Rect32I                            regionOfInterest;
+    libgraphics::fxapi::ApiBackendDevice*           regionOfInterestDevice;
+    libgraphics::Rect32I                            renderedArea;
+    bool                                            planBuffers;
+    bool                                            monochromeWorkingFormat;
+    size_t                                          plannedPeakMemory;
+
+    /// copies of the stack filters used by scaled renders
+    struct FilterCopy {
+        std::weak_ptr<libgraphics::Filter>      original;
+        std::shared_ptr<libgraphics::Filter>    filter;
+        unsigned long long                      presetHash;
+    };
+    float                                           resolutionScale;
+    std::vector<FilterCopy>                         filterCopies;
+
     Private(
         ApplicationSession* _session,
         libgraphics::fxapi::ApiBackendDevice* _backendDevice,
         libgraphics::ImageLayer* _destination,
         libgraphics::ImageLayer* _source,
         libgraphics::FilterStack* _stack ) : session( _session ), backendDevice( _backendDevice ), destination( _destination ),
-        source( _source ), stack( _stack ), initialThreadId( libcommon::getCurrentThreadId() ) {}
+        source( _source ), stack( _stack ), initialThreadId( libcommon::getCurrentThreadId() ),
+        token( new libgraphics::CancellationToken() ), regionOfInterestDevice( nullptr ), planBuffers( false ), monochromeWorkingFormat( true ),
+        plannedPeakMemory( 0 ), resolutionScale( 1.0f ) {}
+
+    /// returns the filter rendered in place of the stack filter
+    std::shared_ptr<libgraphics::Filter> renderedFilter( const std::shared_ptr<libgraphics::Filter>& filter ) {
+        if( resolutionScale == 1.0f ) {
+            return filter;
+        }
+
+        /** drop the copies of removed filters */
+        filterCopies.erase( std::remove_if( filterCopies.begin(), filterCopies.end(), []( const FilterCopy & copy ) {
+            return copy.original.expired();
+        } ), filterCopies.end() );
+
+        const libgraphics::FilterPreset preset = filter->toPreset();
+        const unsigned long long presetHash = preset.hash();
+
+        auto it = std::find_if( filterCopies.begin(), filterCopies.end(), [&filter]( const FilterCopy & copy ) {
+            return copy.original.lock() == filter;
+        } );
+
+        if( it == filterCopies.end() ) {
+            FilterCopy copy;
+            copy.original   = filter;
+            copy.filter.reset( filter->clone() );
+            copy.presetHash = presetHash;
+            assert( copy.filter );
+
+            /** the clone may share the buffers of the original */
+            copy.filter->releaseBuffers();
+            copy.filter->setPixelScale( resolutionScale );
+
+            filterCopies.push_back( copy );
+            return copy.filter;
+        }
+
+        /** follow the parameters of the original, the copy keeps
+            its buffers as long as they stay valid */
+        if( ( *it ).presetHash != presetHash ) {
+            ( *it ).filter->fromPreset( preset );
+            ( *it ).presetHash = presetHash;
+        }
+
+        return ( *it ).filter;
+    }
 
 };
 
@@ -1428,6 +1543,85 @@ libgraphics::FilterStack* ApplicationActionRenderPreview::filters() const {
     return d->stack;
 }
 
+void ApplicationActionRenderPreview::cancel() {
+    d->token->cancel();
+}
+
+bool ApplicationActionRenderPreview::cancelled() const {
+    return d->token->cancelled();
+}
+
+const std::shared_ptr<libgraphics::CancellationToken>& ApplicationActionRenderPreview::cancellationToken() const {
+    return d->token;
+}
+
+void ApplicationActionRenderPreview::resetCancellation() {
+    d->token->reset();
+}
+
+void ApplicationActionRenderPreview::setRenderLock( const std::shared_ptr<std::mutex>& renderLock ) {
+    d->renderLock = renderLock;
+}
+
+void ApplicationActionRenderPreview::setResultCache( const std::shared_ptr<libgraphics::FilterResultCache>& resultCache ) {
+    d->resultCache = resultCache;
+}
+
+void ApplicationActionRenderPreview::setRegionOfInterest( const libgraphics::Rect32I& area ) {
+    d->regionOfInterest = area;
+}
+
+const libgraphics::Rect32I& ApplicationActionRenderPreview::regionOfInterest() const {
+    return d->regionOfInterest;
+}
+
+void ApplicationActionRenderPreview::setRegionOfInterestDevice( libgraphics::fxapi::ApiBackendDevice* device ) {
+    assert( ( device == nullptr ) || ( device->backendId() == FXAPI_BACKEND_CPU ) );
+
+    d->regionOfInterestDevice = device;
+}
+
+libgraphics::fxapi::ApiBackendDevice* ApplicationActionRenderPreview::regionOfInterestDevice() const {
+    return d->regionOfInterestDevice;
+}
+
+const libgraphics::Rect32I& ApplicationActionRenderPreview::renderedArea() const {
+    return d->renderedArea;
+}
+
+void ApplicationActionRenderPreview::setResolutionScale( float scale ) {
+    assert( scale > 0.0f );
+
+    if( d->resolutionScale != scale ) {
+        d->resolutionScale = scale;
+        d->filterCopies.clear();
+    }
+}
+
+float ApplicationActionRenderPreview::resolutionScale() const {
+    return d->resolutionScale;
+}
+
+void ApplicationActionRenderPreview::setPlanBuffers( bool enabled ) {
+    d->planBuffers = enabled;
+}
+
+bool ApplicationActionRenderPreview::planBuffers() const {
+    return d->planBuffers;
+}
+
+void ApplicationActionRenderPreview::setMonochromeWorkingFormat( bool enabled ) {
+    d->monochromeWorkingFormat = enabled;
+}
+
+bool ApplicationActionRenderPreview::monochromeWorkingFormat() const {
+    return d->monochromeWorkingFormat;
+}
+
+size_t ApplicationActionRenderPreview::plannedPeakMemory() const {
+    return d->plannedPeakMemory;
+}
+
 bool ApplicationActionRenderPreview::commit() {
     const unsigned int currentThreadId = libcommon::getCurrentThreadId();
 
@@ -1464,86 +1658,304 @@ bool ApplicationActionRenderPreview::process() {
 
 #endif
 
+    if( this->cancelled() ) {
+        return false; /** superseded before it was started */
+    }
+
+    std::unique_lock<std::mutex> renderLock;
+
+    if( d->renderLock ) {
+        renderLock = std::unique_lock<std::mutex>( *d->renderLock );
+
+        if( this->cancelled() ) {
+            return false;
+        }
+    }
+
+    libgraphics::ScopedCancellationToken    scopedToken( d->token );
     libgraphics::FilterStack    renderableFilters;
 
     for( auto it = this->d->stack->begin(); it != this->d->stack->end(); ++it ) {
         if( this->d->session->d->shouldRenderFilter( ( *it ).get() ) ) {
             renderableFilters.pushBack(
-                ( *it )
+                this->d->renderedFilter( *it )
             );
         }
     }
 
+    /** region rendered by the pass, clipped to the image */
+    const libgraphics::Rect32I  imageArea( this->d->source->size() );
+    libgraphics::Rect32I        renderArea( imageArea );
+
+    if( ( this->d->regionOfInterest.width > 0 ) && ( this->d->regionOfInterest.height > 0 ) ) {
+        const int left      = std::max( this->d->regionOfInterest.x, 0 );
+        const int top       = std::max( this->d->regionOfInterest.y, 0 );
+        const int right     = std::min( this->d->regionOfInterest.x + this->d->regionOfInterest.width, imageArea.width );
+        const int bottom    = std::min( this->d->regionOfInterest.y + this->d->regionOfInterest.height, imageArea.height );
+
+        if( ( right <= left ) || ( bottom <= top ) ) {
+            this->d->renderedArea = libgraphics::Rect32I();
+            return true; /** nothing visible */
+        }
+
+        renderArea = libgraphics::Rect32I( left, top, right - left, bottom - top );
+    }
+
+    /** only the cpu backend renders regions, a part of the
+        image is rendered there instead of the whole one */
+    libgraphics::fxapi::ApiBackendDevice* device( this->d->backendDevice );
+
+    if( ( renderArea != imageArea ) && ( device->backendId() != FXAPI_BACKEND_CPU ) ) {
+        if( this->d->regionOfInterestDevice != nullptr ) {
+            device = this->d->regionOfInterestDevice;
+
+            this->d->source->updateDataForBackend( device, device->backendId() );
+            this->d->destination->updateDataForBackend( device, device->backendId() );
+        } else {
+            renderArea = imageArea;
+        }
+    }
+
+    this->d->renderedArea = renderArea;
+
     if( renderableFilters.count() >= 1 ) {
-        libgraphics::Filter* filterObject = renderableFilters.top().get();
-        assert( filterObject );
+        /** consecutive point filters are rendered in one fused pass */
+        libgraphics::FilterChain    chain(
+            renderableFilters,
+            device,
+            this->d->source->format(),
+            this->d->monochromeWorkingFormat
+        );
 
-        const auto successfullyRendered = filterObject->process(
-                                              this->d->backendDevice,
-                                              this->d->destination,
-                                              this->d->source
-                                          );
+        /** ping-pong between two temporary layers per format, only
+            the last pass writes the destination. a cancelled render
+            leaves the destination untouched. the layers are leased
+            per slot, the plan maps them to the slots it assigned */
+        std::vector< std::unique_ptr<libgraphics::ScopedScratchLayer> >  workingLayers( 4 );
+        size_t  temporarySlots[2]   = { 0, 1 };
+        size_t  monochromeSlots[2]  = { 2, 3 };
 
-        assert( successfullyRendered );
+        if( this->d->planBuffers ) {
+            libgraphics::BufferPlan plan;
 
-        if( !successfullyRendered ) {
-#ifdef LIBFOUNDATION_DEBUG_OUTPUT
-            qDebug() << "ApplicationActionRenderPreview::process(): Failed to render front filter. Aborting...";
-#endif
-            return false;
+            const size_t lastStage = chain.passCount() - 1;
+            const size_t width     = this->d->destination->width();
+            const size_t height    = this->d->destination->height();
+
+            /** the destination and the working layers are alive during the whole render */
+            ( void ) plan.addBuffer( "Render.Destination", this->d->destination->format(), width, height, 0, lastStage );
+
+            size_t  temporaryBuffers[2];
+            size_t  monochromeBuffers[2];
+
+            for( size_t i = 0; 2 > i; ++i ) {
+                temporaryBuffers[i] = plan.addBuffer( "Render.Temporary", this->d->destination->format(), width, height, 0, lastStage );
+            }
+
+            bool    monochromePasses( false );
+
+            for( size_t pass = 0; chain.passCount() > pass; ++pass ) {
+                if( chain.passFormat( pass ) != this->d->destination->format() ) {
+                    for( size_t i = 0; 2 > i; ++i ) {
+                        monochromeBuffers[i] = plan.addBuffer( "Render.Monochrome", chain.passFormat( pass ), width, height, 0, lastStage );
+                    }
+
+                    monochromePasses = true;
+                    break;
+                }
+            }
+
+            chain.planBuffers(
+                plan,
+                device,
+                this->d->source->width(),
+                this->d->source->height()
+            );
+            plan.compute();
+
+            workingLayers.clear();
+            workingLayers.resize( plan.slotCount() );
+
+            for( size_t i = 0; 2 > i; ++i ) {
+                temporarySlots[i] = plan.slot( temporaryBuffers[i] );
+                monochromeSlots[i] = monochromePasses ? plan.slot( monochromeBuffers[i] ) : temporarySlots[i];
+            }
+
+            this->d->plannedPeakMemory = plan.peakMemory();
+
+            LOG_INFO(
+                "Planned " + std::to_string( plan.bufferCount() ) + " intermediate layers in " +
+                std::to_string( plan.slotCount() ) + " buffers, predicted peak memory " +
+                std::to_string( plan.peakMemory() / ( 1024 * 1024 ) ) + "MB instead of " +
+                std::to_string( plan.unsharedMemory() / ( 1024 * 1024 ) ) + "MB."
+            );
         }
 
-        if( renderableFilters.count() == 1 ) {
-            return successfullyRendered;
+        /** identity of the source contents, the cached results
+            are only valid for the same contents and backend */
+        unsigned long long sourceKey = this->d->source->contentId();
+        sourceKey = sourceKey * 31 + ( unsigned long long )device->backendId();
+        sourceKey = sourceKey * 31 + ( unsigned long long )this->d->source->format();
+        sourceKey = sourceKey * 31 + ( unsigned long long )this->d->source->width();
+        sourceKey = sourceKey * 31 + ( unsigned long long )this->d->source->height();
+
+        /** partial results must not be cached */
+        const bool renderFullImage = ( renderArea == imageArea );
+
+        const auto workingLayer = [this, device, &workingLayers, &temporarySlots, &monochromeSlots](
+                                      libgraphics::fxapi::EPixelFormat::t format,
+                                      libgraphics::ImageLayer* exclude,
+                                      bool lastPass
+        ) -> libgraphics::ImageLayer* {
+            /** returns a layer of the format, which isn't the excluded one */
+            const size_t* slots( monochromeSlots );
+
+            if( format == this->d->destination->format() ) {
+                if( lastPass && ( exclude != this->d->destination ) ) {
+                    return this->d->destination;
+                }
+
+                slots = temporarySlots;
+            }
+
+            std::unique_ptr<libgraphics::ScopedScratchLayer>& candidate = ( workingLayers[slots[0]] && ( workingLayers[slots[0]]->get() == exclude ) ) ? workingLayers[slots[1]] : workingLayers[slots[0]];
+
+            if( !candidate ) {
+                candidate.reset( new libgraphics::ScopedScratchLayer(
+                                     device,
+                                     format,
+                                     this->d->destination->width(),
+                                     this->d->destination->height()
+                                 ) );
+            }
+
+            return candidate->empty() ? nullptr : candidate->get();
+        };
+
+        libgraphics::ImageLayer*    input( this->d->source );
+        size_t                      firstPass( 0 );
+
+        if( this->d->resultCache && renderFullImage ) {
+            for( size_t pass = chain.passCount(); pass > 0; --pass ) {
+                libgraphics::ImageLayer* restored = workingLayer( chain.passFormat( pass - 1 ), this->d->source, false );
+
+                if( restored && this->d->resultCache->restore( chain.passKey( pass - 1, sourceKey ), restored ) ) {
+                    input       = restored;
+                    firstPass   = pass;
+                    break;
+                }
+            }
         }
 
-        std::unique_ptr<libgraphics::ImageLayer>   temporaryLayer( libgraphics::makeImageLayer( this->d->backendDevice, this->d->destination ) );
-        const auto successfullyInitializedTemporaryLayer = !temporaryLayer->empty();
+        for( size_t pass = firstPass; chain.passCount() > pass; ++pass ) {
+            if( this->cancelled() ) {
+                return false;
+            }
+
+            /** the last pass runs to its end, the destination either
+                keeps the previous frame or receives the new one */
+            const bool lastPass = ( ( pass + 1 ) == chain.passCount() );
+            libgraphics::ScopedCancellationToken passToken(
+                lastPass ? std::shared_ptr<libgraphics::CancellationToken>() : d->token
+            );
+
+            const libgraphics::Rect32I passArea = chain.passArea(
+                                                      pass,
+                                                      renderArea,
+                                                      imageArea.width,
+                                                      imageArea.height
+                                                  );
 
-        assert( successfullyInitializedTemporaryLayer );
+            /** the chain switches between the rgb and the single channel format */
+            if( input->format() != chain.passFormat( pass ) ) {
+                libgraphics::ImageLayer* converted = workingLayer( chain.passFormat( pass ), input, false );
 
-        if( !successfullyInitializedTemporaryLayer ) {
+                if( converted == nullptr ) {
 #ifdef LIBFOUNDATION_DEBUG_OUTPUT
-            qDebug() << "ApplicationActionRenderPreview::process(): Failed to create temporary layer.";
+                    qDebug() << "ApplicationActionRenderPreview::process(): Failed to create temporary layer.";
 #endif
-            return false;
-        }
+                    return false;
+                }
+
+                const libgraphics::Rect32I readArea = libgraphics::fx::operations::expandArea(
+                                                          passArea,
+                                                          chain.haloRadius( pass ),
+                                                          imageArea.width,
+                                                          imageArea.height
+                                                      );
+
+                if( libgraphics::fxapi::EPixelFormat::getChannelCount( converted->format() ) == 1 ) {
+                    libgraphics::fx::operations::packMonochrome( converted, input, readArea );
+                } else {
+                    libgraphics::fx::operations::expandMonochrome( converted, input, readArea );
+                }
+
+                input = converted;
+            }
 
-        libgraphics::ImageLayer* front( d->destination );
-        libgraphics::ImageLayer* back( temporaryLayer.get() );
+            libgraphics::ImageLayer* output = workingLayer( chain.passFormat( pass ), input, lastPass );
+            const auto successfullyInitializedTemporaryLayer = ( output != nullptr );
 
-        for( auto it = renderableFilters.begin() + 1; it != renderableFilters.end(); ++it ) {
-            libgraphics::Filter* currentFilter = ( *it ).get();
-            assert( currentFilter );
+            assert( successfullyInitializedTemporaryLayer );
+
+            if( !successfullyInitializedTemporaryLayer ) {
+#ifdef LIBFOUNDATION_DEBUG_OUTPUT
+                qDebug() << "ApplicationActionRenderPreview::process(): Failed to create temporary layer.";
+#endif
+                return false;
+            }
 
-            const auto successfullyRendered = currentFilter->process(
-                                                  this->d->backendDevice,
-                                                  back,
-                                                  front
+            const auto successfullyRendered = chain.processPass(
+                                                  pass,
+                                                  device,
+                                                  output,
+                                                  input,
+                                                  passArea
                                               );
 
             assert( successfullyRendered );
 
             if( !successfullyRendered ) {
 #ifdef LIBFOUNDATION_DEBUG_OUTPUT
-                qDebug() << "ApplicationActionRenderPreview::process(): Failed to render filter with name '" << currentFilter->name().c_str() << "'. Aborting...";
+                qDebug() << "ApplicationActionRenderPreview::process(): Failed to render filter pass" << pass << ". Aborting...";
 #endif
                 return false;
             }
 
-            std::swap(
-                front,
-                back
-            );
+            /** the buffers of the pass are dead in a planned render, the
+                filters rebuild them on demand under memory pressure */
+            if( this->d->planBuffers || libgraphics::MemoryGovernor::global().overBudget() ) {
+                chain.releaseBuffers( pass );
+            }
+
+            /** a cancelled pass may be incomplete */
+            if( !lastPass && this->cancelled() ) {
+                return false;
+            }
+
+            if( this->d->resultCache && renderFullImage ) {
+                this->d->resultCache->store(
+                    chain.passKey( pass, sourceKey ),
+                    device,
+                    output
+                );
+            }
+
+            input = output;
         }
 
-        if( ( renderableFilters.count() - 1 ) % 2 != 0 ) {
-            /** number of filters is not dividable by two */
+        if( input->format() != this->d->destination->format() ) {
+            libgraphics::fx::operations::expandMonochrome(
+                d->destination,
+                input,
+                renderArea
+            );
+        } else if( input != this->d->destination ) {
             libgraphics::fx::operations::blit(
                 d->destination,
-                temporaryLayer.get(),
-                temporaryLayer->size(),
-                temporaryLayer->size()
+                input,
+                renderArea,
+                renderArea
             );
         }
 
@@ -1552,6 +1964,8 @@ bool ApplicationActionRenderPreview::process() {
 
     qDebug() << "Warning: No active filters found. Aborting...";
 
+    this->d->renderedArea = imageArea;
+
     libgraphics::fx::operations::blit(
         d->destination,
         d->source,
@@ -25,6 +25,8 @@ class FilterPreset;
 class FilterPresetCollection;
 class FilterPlugin;
 class FilterStack;
+class CancellationToken;
+class FilterResultCache;
 
 namespace io {
 class Pipeline;
@@ -241,6 +243,12 @@ class ApplicationAction : public libcommon::INonCopyable {
         virtual bool process() = 0;
         virtual bool finished() = 0;
 
+        /// true, if the action was aborted. process() returns
+        /// false for an aborted action.
+        virtual bool cancelled() const {
+            return false;
+        }
+
         void waitForFinished();
     protected:
         std::mutex      m_FinishedMutex;
@@ -283,6 +291,71 @@ class ApplicationActionRenderPreview : public SessionCommitableApplicationAction
         libgraphics::fxapi::ApiBackendDevice* device() const;
         libgraphics::FilterStack* filters() const;
 
+        /// aborts the render. remaining tiles and filters are
+        /// skipped and process() returns false, cancelled() tells
+        /// it apart from a failure. the destination keeps its
+        /// previous content, only the last pass writes it and
+        /// runs to its end once it was started.
+        void cancel();
+        virtual bool cancelled() const;
+        const std::shared_ptr<libgraphics::CancellationToken>& cancellationToken() const;
+
+        /// rearms a cancelled action for its next render
+        void resetCancellation();
+
+        /// renders sharing the same lock never run at the
+        /// same time.
+        void setRenderLock( const std::shared_ptr<std::mutex>& renderLock );
+
+        /// the render restarts from the cached result of the
+        /// last unchanged filter and stores the new results.
+        void setResultCache( const std::shared_ptr<libgraphics::FilterResultCache>& resultCache );
+
+        /// only the region of interest and the pixels the
+        /// filters read around it are rendered, the rest of
+        /// the destination keeps its content. an empty region
+        /// renders the whole image. regions are only used on
+        /// the cpu backend, see setRegionOfInterestDevice(),
+        /// and disable the result cache.
+        void setRegionOfInterest( const libgraphics::Rect32I& area );
+        const libgraphics::Rect32I& regionOfInterest() const;
+
+        /// cpu device, which renders regions smaller than the
+        /// image instead of the action's device. the layers are
+        /// mirrored to it on demand.
+        void setRegionOfInterestDevice( libgraphics::fxapi::ApiBackendDevice* device );
+        libgraphics::fxapi::ApiBackendDevice* regionOfInterestDevice() const;
+
+        /// part of the destination written by the last render
+        const libgraphics::Rect32I& renderedArea() const;
+
+        /// pixels of the source per pixel of the image the filter
+        /// parameters are meant for, 1.0 by default. a scaled
+        /// render uses its own copies of the filters, which follow
+        /// the parameters of the stack and keep their buffers
+        /// apart from the other previews. see Filter::setPixelScale().
+        void setResolutionScale( float scale );
+        float resolutionScale() const;
+
+        /// plans the intermediate layers of the whole chain
+        /// before rendering, leases the working layers from the
+        /// slots of the plan and drops the buffers each filter
+        /// keeps between renders right after its pass. meant
+        /// for one-shot renders like exports.
+        void setPlanBuffers( bool enabled );
+        bool planBuffers() const;
+
+        /// renders the filters after a b&w mixer on single
+        /// channel layers, see libgraphics::FilterChain.
+        /// enabled by default.
+        void setMonochromeWorkingFormat( bool enabled );
+        bool monochromeWorkingFormat() const;
+
+        /// predicted peak memory of the destination and the
+        /// intermediate layers of the last planned render, in
+        /// bytes.
+        size_t plannedPeakMemory() const;
+
         virtual bool commit();
         virtual bool process();
         virtual bool finished();
@@ -445,6 +518,14 @@ class ApplicationSession : public libcommon::INonCopyable {
         libgraphics::fxapi::ApiBackendDevice*   previewBackend() const;
         void setPreviewBackend( libgraphics::fxapi::ApiBackendDevice* previewBackend );
 
+        /// memory used to keep the intermediate filter results
+        /// of the preview. 0 disables the cache.
+        size_t previewCacheBudget() const;
+        void setPreviewCacheBudget( size_t bytes );
+
+        /// the cache shared by the preview actions of the session
+        const std::shared_ptr<libgraphics::FilterResultCache>& previewResultCache() const;
+
 
         /// synchronization and serialization
         void synchronize();
@@ -589,6 +670,8 @@ class ApplicationSession : public libcommon::INonCopyable {
         );
 
         bool updatePreview( bool _force = false );
+        /// creates a new preview render and cancels the previously
+        /// created one, only the latest request is rendered.
         ApplicationActionRenderPreview* asyncUpdatePreview( bool _force = false );
 
         ApplicationActionRenderPreview* asyncRenderToLayer(
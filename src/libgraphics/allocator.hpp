@@ -3,13 +3,33 @@
 #include <libcommon/weakref.hpp>
 #include <libcommon/noncopyable.hpp>
 #include <libcommon/atomics.hpp>
+#include <libgraphics/base.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <map>
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <shared_mutex>
 
 namespace libgraphics {
+namespace memory {
+static const size_t HugePageLength = 2 * 1024 * 1024;
+
+/// allocates length bytes at a multiple of alignment, which
+/// has to be a power of two. returns nullptr on failure.
+LIBGRAPHICS_API void*   allocateAligned( size_t length, size_t alignment );
+LIBGRAPHICS_API void    freeAligned( void* p );
+
+/// maps length bytes of zeroed, page aligned memory. with
+/// hugePages set the mapping is backed by 2MB pages if the
+/// system provides them, otherwise by normal pages.
+LIBGRAPHICS_API void*   allocatePages( size_t length, bool hugePages );
+LIBGRAPHICS_API void    freePages( void* p, size_t length );
+}
+
 namespace detail {
 template < class _t_allocatable >
 struct AllocatorBase {
@@ -156,91 +176,234 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         typedef const void* ConstPointer;
         typedef _t_policy Policy;
 
+        /// blobs up to SmallBlobLength are rounded up to a power
+        /// of two and kept in a per-thread cache on release.
+        static const size_t SmallBlobLength     = 64 * 1024;
+        static const size_t MinSmallBlobLength  = 64;
+        static const size_t SmallClassCount     = 11;
+        static const size_t ThreadCacheDepth    = 8;
+
+        /// the entry pointer is stored right in front of the data,
+        /// the header is at least HeaderLength bytes and a multiple
+        /// of the policy alignment.
+        static const size_t HeaderLength        = 64;
+
+        struct Bin;
+
         struct Entry : libcommon::INonCopyable {
+            enum EState {
+                Unused  = 0,
+                Used    = 1,
+                Cached  = 2     /** unused, held by a thread cache **/
+            };
+
             size_t                          length;
             libcommon::atomics::type32      used;
             void*                           data;
+            Bin*                            bin;
 
-            Entry( size_t _length ) : length( _length ), used( 0 ), data( nullptr ) {
-                data = ( void* )new char[length];
-
-                assert( data != nullptr );
+            Entry( size_t _length, Bin* _bin ) : length( _length ), used( Unused ), data( nullptr ), bin( _bin ), block( nullptr ) {
                 assert( length != 0 );
+
+                if( bin->pageMapped ) {
+                    block = ( char* )memory::allocatePages( blockLength(), true );
+                } else {
+                    block = ( char* )memory::allocateAligned( blockLength(), bin->headerLength );
+                }
+
+                if( block == nullptr ) {
+                    throw std::bad_alloc();
+                }
+
+                data = ( void* )( block + bin->headerLength );
+                *( ( Entry** )data - 1 ) = this;
             }
+            ~Entry() {
+                assert( libcommon::atomics::equal32( &used, Used ) == false );
 
-            Entry( Entry&& rhs ) throw() : length( rhs.length ), used( rhs.used ), data( rhs.data ) {
-                rhs.data = nullptr;
-                rhs.used = 0;
-                rhs.length = 0;
+                if( bin->pageMapped ) {
+                    memory::freePages( block, blockLength() );
+                } else {
+                    memory::freeAligned( block );
+                }
             }
-            Entry& operator = ( Entry&& rhs ) throw() {
-                std::swap(
-                    rhs.data,
-                    data
-                );
-                std::swap(
-                    rhs.used,
-                    used
-                );
-                std::swap(
-                    rhs.length,
-                    length
-                );
 
-                return *this;
+            static Entry* fromData( void* p ) {
+                assert( p );
+                return *( ( Entry** )p - 1 );
             }
+        private:
+            size_t blockLength() const {
+                const size_t length = bin->headerLength + this->length;
 
-            ~Entry() {
-                assert( libcommon::atomics::equal32( &used, 0 ) == true );
-                delete []( char* )data;
+                if( bin->pageMapped ) {
+                    return ( length + memory::HugePageLength - 1 ) / memory::HugePageLength * memory::HugePageLength;
+                }
+
+                return length;
+            }
+
+            char*   block;
+        };
+
+        /// all entries of one length with the free list of the
+        /// unused ones.
+        struct Bin : libcommon::INonCopyable {
+            const size_t                            length;
+            const size_t                            headerLength;
+            const bool                              pageMapped;     /** entries in huge pages **/
+            std::mutex                              mutex;
+            std::vector< std::unique_ptr<Entry> >   entries;
+            std::vector<Entry*>                     unused;
+
+            Bin( size_t _length, size_t _alignment, bool _pageMapped ) :
+                length( _length ), headerLength( ( _alignment > HeaderLength ) ? _alignment : HeaderLength ), pageMapped( _pageMapped ) {
+                assert( !pageMapped || ( headerLength <= 4096 ) );
+            }
+
+            Entry* tryAcquire() {
+                std::lock_guard<std::mutex> lock( mutex );
+
+                if( unused.empty() ) {
+                    return nullptr;
+                }
+
+                Entry* entry = unused.back();
+                unused.pop_back();
+                libcommon::atomics::assign32( &entry->used, Entry::Used );
+
+                return entry;
             }
-            void acquire() {
-                volatile bool _acquired = tryAcquire();
+            Entry* grow( size_t count ) {
+                assert( count > 0 );
 
-                while( !_acquired ) {
-                    _acquired = tryAcquire();
+                std::lock_guard<std::mutex> lock( mutex );
+
+                for( size_t i = 1; count > i; ++i ) {
+                    entries.emplace_back( new Entry( length, this ) );
+                    unused.push_back( entries.back().get() );
                 }
+
+                entries.emplace_back( new Entry( length, this ) );
+                libcommon::atomics::assign32( &entries.back()->used, Entry::Used );
+
+                return entries.back().get();
             }
-            bool tryAcquire() {
-                if( libcommon::atomics::exchange32( &used, 0, 1 ) == 0 ) {
-                    return true;
+            void release( Entry* entry ) {
+                std::lock_guard<std::mutex> lock( mutex );
+
+                libcommon::atomics::assign32( &entry->used, Entry::Unused );
+                unused.push_back( entry );
+            }
+            size_t countUnused() {
+                std::lock_guard<std::mutex> lock( mutex );
+
+                return countUnusedLocked();
+            }
+            size_t countUsed() {
+                std::lock_guard<std::mutex> lock( mutex );
+
+                return entries.size() - countUnusedLocked();
+            }
+            size_t countUnusedLocked() const {
+                size_t cached( 0 );
+
+                for( auto it = entries.begin(); it != entries.end(); ++it ) {
+                    if( libcommon::atomics::equal32( &( *it )->used, Entry::Cached ) ) {
+                        ++cached;
+                    }
                 }
 
-                return false;
+                return unused.size() + cached;
+            }
+            size_t releaseUnused( size_t maxCount ) {
+                std::lock_guard<std::mutex> lock( mutex );
+
+                size_t freed( 0 );
+
+                while( !unused.empty() && ( ( maxCount == 0 ) || ( maxCount > freed ) ) ) {
+                    Entry* entry = unused.back();
+                    unused.pop_back();
+
+                    for( auto it = entries.begin(); it != entries.end(); ++it ) {
+                        if( ( *it ).get() == entry ) {
+                            entries.erase( it );
+                            break;
+                        }
+                    }
+
+                    ++freed;
+                }
+
+                return freed;
+            }
+        };
+
+        /// bins and counters, shared with the thread caches.
+        struct State : libcommon::INonCopyable {
+            std::shared_timed_mutex                 mutex;      /** guards the bin map **/
+            std::map< size_t, std::unique_ptr<Bin> > bins;
+            std::atomic<size_t>                     size;
+            std::atomic<size_t>                     capacity;
+
+            State() : size( 0 ), capacity( 0 ) {}
+
+            Bin* find( size_t length ) {
+                std::shared_lock<std::shared_timed_mutex> lock( mutex );
+
+                const auto it = bins.find( length );
+                return ( it != bins.end() ) ? ( *it ).second.get() : nullptr;
+            }
+            Bin* findOrCreate( size_t length, const Policy& policy ) {
+                Bin* bin = find( length );
+
+                if( bin != nullptr ) {
+                    return bin;
+                }
+
+                std::unique_lock<std::shared_timed_mutex> lock( mutex );
+                auto& slot = bins[length];
+
+                if( !slot ) {
+                    slot.reset( new Bin( length, policy.getAlignment(), policy.useHugePages( length ) ) );
+                }
+
+                return slot.get();
             }
-            void release() {
-                libcommon::atomics::exchange32( &used, 1, 0 );
+            template < class _t_function >
+            void forEachBin( _t_function function ) {
+                std::shared_lock<std::shared_timed_mutex> lock( mutex );
+
+                for( auto it = bins.begin(); it != bins.end(); ++it ) {
+                    function( ( *it ).first, *( *it ).second );
+                }
             }
         };
 
         explicit DynamicPoolAllocator( Policy _policy = Policy() ) :
-            m_Size( 0 ), m_Capacity( 0 ), m_AllocatorPolicy( _policy ) {}
+            m_State( new State() ), m_AllocatorPolicy( _policy ) {}
         template < class _t_other_policy >
         DynamicPoolAllocator( DynamicPoolAllocator<_t_other_policy>&& rhs ) :
-            m_Entries( std::move( rhs.m_Entries ) ),
-            m_Size( rhs.m_Size ),
-            m_Capacity( rhs.m_Capacity ) {
+            m_State( std::move( rhs.m_State ) ) {
+            rhs.m_State.reset( new State() );
         }
         template < class _t_other_policy >
         void assign( DynamicPoolAllocator<_t_other_policy>&& rhs ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-            std::lock_guard<std::recursive_mutex> other( rhs.m_Mutex );
-
-            m_Entries   = std::move( rhs.m_Entries );
-            m_Size      = rhs.m_Size;
-            m_Capacity  = rhs.m_Capacity;
+            m_State             = std::move( rhs.m_State );
             m_AllocatorPolicy   = rhs.m_AllocatorPolicy;
+
+            rhs.m_State.reset( new State() );
         }
 
         /// container properties
         bool empty() const {
-            return m_Entries.empty();
+            return m_State->capacity == 0;
         }
         size_t size() const {
-            return m_Size;
+            return m_State->size;
         }
         size_t capacity() const {
-            return m_Capacity;
+            return m_State->capacity;
         }
 
         /// policy management
@@ -279,36 +442,36 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         friend struct Blob;
 
         std::shared_ptr<Blob> alloc( size_t length ) {
-            const auto& entry = acquireEntry(
-                                    length
-                                );
+            Entry* entry = acquireEntry(
+                               length
+                           );
             return std::shared_ptr<Blob>(
-                       new Blob( entry.data, this )
+                       new Blob( entry->data, this )
                    );
         }
         template < class _t_type >
         std::shared_ptr<_t_type> emplace() {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
-            _allocator.inplaceAlloc( entry.data )
+            _allocator.inplaceAlloc( entry->data )
                    );
         }
         template < class _t_type, class _t_arg0 >
         std::shared_ptr<_t_type> emplace( _t_arg0 arg0 ) {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
             _allocator.inplaceAlloc(
-                entry.data,
+                entry->data,
                 std::forward<_t_arg0>( arg0 )
             )
                    );
@@ -316,14 +479,14 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         template < class _t_type, class _t_arg0, class _t_arg1 >
         std::shared_ptr<_t_type> emplace( _t_arg0 arg0, _t_arg1 arg1 ) {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
             _allocator.inplaceAlloc(
-                entry.data,
+                entry->data,
                 std::forward<_t_arg0>( arg0 ),
                 std::forward<_t_arg1>( arg1 )
             )
@@ -332,14 +495,14 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         template < class _t_type, class _t_arg0, class _t_arg1, class _t_arg2 >
         std::shared_ptr<_t_type> emplace( _t_arg0 arg0, _t_arg1 arg1, _t_arg2 arg2 ) {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
             _allocator.inplaceAlloc(
-                entry.data,
+                entry->data,
                 std::forward<_t_arg0>( arg0 ),
                 std::forward<_t_arg1>( arg1 ),
                 std::forward<_t_arg2>( arg2 )
@@ -349,14 +512,14 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         template < class _t_type, class _t_arg0, class _t_arg1, class _t_arg2, class _t_arg3 >
         std::shared_ptr<_t_type> emplace( _t_arg0 arg0, _t_arg1 arg1, _t_arg2 arg2, _t_arg3 arg3 ) {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
             _allocator.inplaceAlloc(
-                entry.data,
+                entry->data,
                 std::forward<_t_arg0>( arg0 ),
                 std::forward<_t_arg1>( arg1 ),
                 std::forward<_t_arg2>( arg2 ),
@@ -367,14 +530,14 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         template < class _t_type, class _t_arg0, class _t_arg1, class _t_arg2, class _t_arg3, class _t_arg4 >
         std::shared_ptr<_t_type> emplace( _t_arg0 arg0, _t_arg1 arg1, _t_arg2 arg2, _t_arg3 arg3, _t_arg4 arg4 ) {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
             _allocator.inplaceAlloc(
-                entry.data,
+                entry->data,
                 std::forward<_t_arg0>( arg0 ),
                 std::forward<_t_arg1>( arg1 ),
                 std::forward<_t_arg2>( arg2 ),
@@ -386,14 +549,14 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         template < class _t_type, class _t_arg0, class _t_arg1, class _t_arg2, class _t_arg3, class _t_arg4, class _t_arg5 >
         std::shared_ptr<_t_type> emplace( _t_arg0 arg0, _t_arg1 arg1, _t_arg2 arg2, _t_arg3 arg3, _t_arg4 arg4, _t_arg5 arg5 ) {
             static Allocator<_t_type> _allocator;
-            const auto entry = acquireEntry(
+            Entry* entry = acquireEntry(
                                    sizeof( _t_type )
                                );
 
             return std::shared_ptr<_t_type>(
             [this]( _t_type * p ) { this->dealloc( p ); },
             _allocator.inplaceAlloc(
-                entry.data,
+                entry->data,
                 std::forward<_t_arg0>( arg0 ),
                 std::forward<_t_arg1>( arg1 ),
                 std::forward<_t_arg2>( arg2 ),
@@ -406,17 +569,14 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         void dealloc( void* p ) {
             assert( p );
 
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
+            Entry* entry = Entry::fromData( p );
+            assert( entry->data == p );
+            assert( libcommon::atomics::equal32( &entry->used, Entry::Used ) );
 
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                if( ( ( size_t )( *it ).data == ( size_t )p ) ) {
-                    if( ( libcommon::atomics::exchange32( &( *it ).used, 1, 0 ) == 1 ) ) {
-                        --m_Size;
-                        break;
-                    } else {
-                        assert( false );
-                    }
-                }
+            --m_State->size;
+
+            if( ( entry->length > SmallBlobLength ) || !cacheEntry( entry ) ) {
+                entry->bin->release( entry );
             }
         }
         template < class _t_type >
@@ -431,26 +591,20 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
 
         /// info
         size_t queryMemoryCapacity() {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
             size_t capacity( 0 );
 
-            for( auto it = this->m_Entries.begin(); it != this->m_Entries.end(); ++it ) {
-                capacity += ( *it ).length;
-            }
+            m_State->forEachBin( [&capacity]( size_t length, Bin & bin ) {
+                capacity += length * ( bin.countUsed() + bin.countUnused() );
+            } );
 
             return capacity;
         }
         size_t queryMemoryConsumption() {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
             size_t consumption( 0 );
 
-            for( auto it = this->m_Entries.begin(); it != this->m_Entries.end(); ++it ) {
-                if( it->used == 1 ) {
-                    consumption += it->length;
-                }
-            }
+            m_State->forEachBin( [&consumption]( size_t length, Bin & bin ) {
+                consumption += length * bin.countUsed();
+            } );
 
             return consumption;
         }
@@ -464,21 +618,12 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
                 return;
             }
 
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
+            Bin* bin = m_State->findOrCreate( binLength( entrySize ), m_AllocatorPolicy );
+            bin->release( bin->grow( entryCount ) );
 
-            for( size_t i = 0; entryCount > i; ++i ) {
-                m_Entries.emplace_back(
-                    entrySize
-                );
-            }
-
-            m_Capacity += entryCount;
-
-            sort();
+            m_State->capacity += entryCount;
         }
         void ensureCapacity( size_t capacity, size_t entrySize ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
             size_t totalCapacity = countUnusedOfSize( entrySize ) + countUsedOfSize( entrySize );
 
             if( totalCapacity < capacity ) {
@@ -486,8 +631,6 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
             }
         }
         void ensureUnused( size_t capacity, size_t entrySize ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
             size_t unusedOfSize = countUnusedOfSize( entrySize );
 
             if( unusedOfSize < capacity ) {
@@ -496,127 +639,77 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         }
 
         size_t countUsedOfSize( size_t entrySize ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
+            Bin* bin = m_State->find( binLength( entrySize ) );
 
-            size_t count( 0 );
-
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                if( ( ( *it ).length == entrySize ) && ( libcommon::atomics::equal32( &( *it ).used, 1 ) ) ) {
-                    ++count;
-                }
-            }
-
-            return count;
+            return ( bin != nullptr ) ? bin->countUsed() : 0;
         }
         size_t countUsedOfCompatibleSize( size_t entrySize ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
+            const size_t length = binLength( entrySize );
             size_t count( 0 );
 
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                if( ( ( *it ).length >= entrySize ) && ( libcommon::atomics::equal32( &( *it ).used, 1 ) ) ) {
-                    ++count;
+            m_State->forEachBin( [&count, length]( size_t binLength, Bin & bin ) {
+                if( binLength >= length ) {
+                    count += bin.countUsed();
                 }
-            }
+            } );
 
             return count;
         }
 
         size_t countUnusedOfSize( size_t entrySize ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
-            size_t count( 0 );
-
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                if( ( ( *it ).length == entrySize ) && ( libcommon::atomics::equal32( &( *it ).used, 0 ) ) ) {
-                    ++count;
-                }
-            }
+            Bin* bin = m_State->find( binLength( entrySize ) );
 
-            return count;
+            return ( bin != nullptr ) ? bin->countUnused() : 0;
         }
         size_t countUnusedOfCompatibleSize( size_t entrySize ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
+            const size_t length = binLength( entrySize );
             size_t count( 0 );
 
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                if( ( ( *it ).length >= entrySize ) && ( libcommon::atomics::equal32( &( *it ).used, 0 ) ) ) {
-                    ++count;
+            m_State->forEachBin( [&count, length]( size_t binLength, Bin & bin ) {
+                if( binLength >= length ) {
+                    count += bin.countUnused();
                 }
-            }
+            } );
 
             return count;
         }
 
+        /// entries held by thread caches are not released.
         size_t releaseUnusedOfSize( size_t entries, size_t entryLength ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
-            size_t freed( 0 );
-
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ) {
-                if( libcommon::atomics::equal32( &( *it ).used, 0 ) && ( ( *it ).length == entryLength ) ) {
-                    it = m_Entries.erase( it );
-                    ++freed;
-                } else {
-                    ++it;
-                }
-
-                if( freed >= entries ) {
-                    break;
-                }
-            }
+            Bin* bin = m_State->find( binLength( entryLength ) );
+            const size_t freed = ( bin != nullptr ) ? bin->releaseUnused( entries ) : 0;
 
-            m_Capacity      -= freed;
+            m_State->capacity -= freed;
 
             return freed;
         }
         size_t releaseUnusedOfCompatibleSize( size_t entries, size_t size ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
+            const size_t length = binLength( size );
             size_t freed( 0 );
 
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ) {
-                if( libcommon::atomics::equal32( &( *it ).used, 0 ) && ( ( *it ).length >= size ) ) {
-                    it = m_Entries.erase( it );
-                    ++freed;
-                } else {
-                    ++it;
-                }
-
-                if( freed >= entries ) {
-                    break;
+            m_State->forEachBin( [&freed, entries, length]( size_t binLength, Bin & bin ) {
+                if( ( binLength >= length ) && ( entries > freed ) ) {
+                    freed += bin.releaseUnused( entries - freed );
                 }
-            }
+            } );
 
-            m_Capacity      -= freed;
+            m_State->capacity -= freed;
 
             return freed;
         }
 
         size_t releaseUnused( size_t entries = 0 ) {
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
-
             size_t freed( 0 );
 
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ) {
-                if( libcommon::atomics::equal32( &( *it ).used, 0 ) ) {
-                    it = m_Entries.erase( it );
-                    ++freed;
-
-                    if( it == m_Entries.end() ) {
-                        break;
-                    }
-                } else {
-                    ++it;
+            m_State->forEachBin( [&freed, entries]( size_t, Bin & bin ) {
+                if( entries == 0 ) {
+                    freed += bin.releaseUnused( 0 );
+                } else if( entries > freed ) {
+                    freed += bin.releaseUnused( entries - freed );
                 }
+            } );
 
-                if( ( freed >= entries ) && ( entries != 0 ) ) {
-                    break;
-                }
-            }
-
-            m_Capacity      -= freed;
+            m_State->capacity -= freed;
 
             return freed;
         }
@@ -627,124 +720,183 @@ struct DynamicPoolAllocator : libcommon::INonCopyable {
         bool containsEntriesOfCompatibleSize( size_t length ) {
             return ( countUnusedOfCompatibleSize( length ) > 0 );
         }
+    private:
+        template < class _t_other_policy > friend struct DynamicPoolAllocator;
+
+        /// per thread stacks of released small entries, one per
+        /// size class. a class is bound to the allocator which
+        /// released the entries last.
+        struct ThreadCache {
+            struct Slot {
+                std::weak_ptr<State>    state;
+                State*                  owner;
+                Entry*                  entries[ThreadCacheDepth];
+                size_t                  count;
+
+                Slot() : owner( nullptr ), count( 0 ) {}
+
+                void flush() {
+                    const auto alive = state.lock();
+
+                    if( alive && ( alive.get() == owner ) ) {
+                        for( size_t i = 0; count > i; ++i ) {
+                            entries[i]->bin->release( entries[i] );
+                        }
+                    }
 
-        /// container management
-        typedef typename std::vector<Entry>::iterator Iterator;
-        typedef typename std::vector<Entry>::const_iterator ConstIterator;
+                    count = 0;
+                    owner = nullptr;
+                    state.reset();
+                }
+            };
 
-        Iterator begin() {
-            return m_Entries.begin();
-        }
-        ConstIterator begin() const {
-            return m_Entries.begin();
-        }
-        ConstIterator constBegin() const {
-            return m_Entries.cbegin();
-        }
+            Slot    classes[SmallClassCount];
 
-        Iterator end() {
-            return m_Entries.end();
-        }
-        ConstIterator end() const {
-            return m_Entries.end();
-        }
-        ConstIterator constEnd() const {
-            return m_Entries.cend();
-        }
+            ~ThreadCache() {
+                for( size_t i = 0; SmallClassCount > i; ++i ) {
+                    classes[i].flush();
+                }
+            }
+        };
 
-        Entry& front() {
-            return m_Entries.front();
+        static ThreadCache& threadCache() {
+            static thread_local ThreadCache cache;
+            return cache;
         }
-        const Entry& front() const {
-            return m_Entries.front();
+
+        static size_t smallClassIndex( size_t length ) {
+            size_t index( 0 );
+            size_t classLength( MinSmallBlobLength );
+
+            while( classLength < length ) {
+                classLength <<= 1;
+                ++index;
+            }
+
+            assert( index < SmallClassCount );
+            return index;
         }
 
-        Entry& back() {
-            return m_Entries.back();
+        /// length of the entries, which serve a request of
+        /// length bytes.
+        size_t binLength( size_t length ) const {
+            if( length <= SmallBlobLength ) {
+                return MinSmallBlobLength << smallClassIndex( length );
+            }
+
+            return m_AllocatorPolicy.getAlignedLength( length );
         }
-        const Entry& back() const {
-            return m_Entries.back();
+
+        bool cacheEntry( Entry* entry ) {
+            typename ThreadCache::Slot& slot = threadCache().classes[smallClassIndex( entry->length )];
+
+            if( slot.owner != m_State.get() || slot.state.expired() ) {
+                slot.flush();
+                slot.state = m_State;
+                slot.owner = m_State.get();
+            }
+
+            if( slot.count == ThreadCacheDepth ) {
+                return false;
+            }
+
+            libcommon::atomics::assign32( &entry->used, Entry::Cached );
+            slot.entries[slot.count++] = entry;
+
+            return true;
         }
-    private:
-        void sort() {
-            std::sort(
-                begin(),
-                end(),
-            []( const Entry & first, const Entry & second ) {
-                return ( first.length > second.length );
+        Entry* takeCachedEntry( size_t length ) {
+            typename ThreadCache::Slot& slot = threadCache().classes[smallClassIndex( length )];
+
+            if( ( slot.count == 0 ) || ( slot.owner != m_State.get() ) || slot.state.expired() ) {
+                return nullptr;
             }
-            );
+
+            Entry* entry = slot.entries[--slot.count];
+            libcommon::atomics::assign32( &entry->used, Entry::Used );
+
+            return entry;
         }
 
-        Entry& acquireEntry( size_t length ) {
-            const auto alignedLength            = m_AllocatorPolicy.getAlignedLength( length );
+        Entry* acquireEntry( size_t length ) {
+            const auto alignedLength            = binLength( length );
             const auto fastAlloc                = m_AllocatorPolicy.fastAlloc();
             const auto defaultReallocationCount = m_AllocatorPolicy.getDefaultReallocationCount( alignedLength );
 
             assert( defaultReallocationCount > 0 );
             assert( alignedLength != 0 );
 
-            std::lock_guard<std::recursive_mutex> lock( m_Mutex );
+            Entry* entry( nullptr );
 
-            if( m_Capacity > m_Size ) {
-                if( fastAlloc ) {
-                    for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                        if( ( ( *it ).length >= alignedLength ) && ( libcommon::atomics::exchange32( &( *it ).used, 0, 1 ) == 0 ) ) {
-                            ++m_Size;
-                            return ( *it );
-                        }
-                    }
-                } else {
-                    for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                        if( ( ( *it ).length == alignedLength ) && ( libcommon::atomics::exchange32( &( *it ).used, 0, 1 ) == 0 ) ) {
-                            ++m_Size;
-                            return ( *it );
-                        }
-                    }
+            if( alignedLength <= SmallBlobLength ) {
+                entry = takeCachedEntry( alignedLength );
+            }
+
+            if( entry == nullptr ) {
+                Bin* bin = m_State->find( alignedLength );
+
+                if( bin != nullptr ) {
+                    entry = bin->tryAcquire();
                 }
             }
 
-            reserve( defaultReallocationCount, alignedLength );
+            if( ( entry == nullptr ) && fastAlloc ) {
+                /** the smallest larger entry, the bin map is sorted by length **/
+                std::shared_lock<std::shared_timed_mutex> lock( m_State->mutex );
 
-            for( auto it = m_Entries.begin(); it != m_Entries.end(); ++it ) {
-                if( ( ( *it ).length == alignedLength ) && ( libcommon::atomics::exchange32( &( *it ).used, 0, 1 ) == 0 ) ) {
-                    ++m_Size;
-                    return ( *it );
+                for( auto it = m_State->bins.upper_bound( alignedLength ); ( entry == nullptr ) && ( it != m_State->bins.end() ); ++it ) {
+                    entry = ( *it ).second->tryAcquire();
                 }
             }
 
-            assert( false );
-            return m_Entries.front();
+            if( entry == nullptr ) {
+                entry = m_State->findOrCreate( alignedLength, m_AllocatorPolicy )->grow( defaultReallocationCount );
+                m_State->capacity += defaultReallocationCount;
+            }
+
+            ++m_State->size;
+
+            return entry;
         }
 
-        libcommon::Int32  m_Size;
-        libcommon::Int32  m_Capacity;
+        std::shared_ptr<State>  m_State;
         Policy  m_AllocatorPolicy;
-        std::vector<Entry>  m_Entries;
-        std::recursive_mutex m_Mutex;
 };
 
+/// the alignment is a power of two, which the data of every
+/// entry starts at. entries of at least hugePageThreshold bytes
+/// are mapped in huge pages, a threshold of 0 disables them.
 struct AllocatorPolicy {
+        static const size_t DefaultAlignment            = 64;
+        static const size_t DefaultHugePageThreshold    = 32 * 1024 * 1024;
+
         explicit AllocatorPolicy(
             size_t _defaultReallocationCount = 1,
-            size_t _alignment = 32,
-            bool _fastAlloc = true
+            size_t _alignment = DefaultAlignment,
+            bool _fastAlloc = true,
+            size_t _hugePageThreshold = 0
         ) : m_FastAlloc( _fastAlloc ), m_DefaultReallocationCount( _defaultReallocationCount ),
-            m_Alignment( _alignment ) {}
+            m_Alignment( _alignment ), m_HugePageThreshold( _hugePageThreshold ) {
+            assert( ( m_Alignment != 0 ) && ( ( m_Alignment & ( m_Alignment - 1 ) ) == 0 ) );
+        }
 
         bool fastAlloc() const { return m_FastAlloc; }
         size_t getDefaultReallocationCount( size_t ) const { return m_DefaultReallocationCount; }
-        size_t getAlignedLength( size_t length ) const { return length + ( length % m_Alignment ); }
+        size_t getAlignment() const { return m_Alignment; }
+        size_t getAlignedLength( size_t length ) const { return ( length + m_Alignment - 1 ) & ~( m_Alignment - 1 ); }
+        size_t getHugePageThreshold() const { return m_HugePageThreshold; }
+        bool useHugePages( size_t length ) const { return ( m_HugePageThreshold != 0 ) && ( length >= m_HugePageThreshold ); }
     private:
         bool m_FastAlloc;
         size_t m_DefaultReallocationCount;
         size_t m_Alignment;
+        size_t m_HugePageThreshold;
 };
-template < size_t _defaultReallocationCount, size_t _alignment, bool _fastAlloc >
+template < size_t _defaultReallocationCount, size_t _alignment, bool _fastAlloc, size_t _hugePageThreshold = 0 >
 struct GenericAllocatorPolicy : AllocatorPolicy {
-    GenericAllocatorPolicy() : AllocatorPolicy( _defaultReallocationCount, _alignment, _fastAlloc ) {}
+    GenericAllocatorPolicy() : AllocatorPolicy( _defaultReallocationCount, _alignment, _fastAlloc, _hugePageThreshold ) {}
 };
-typedef GenericAllocatorPolicy<8, 32, true> DefaultAllocatorPolicy;
+typedef GenericAllocatorPolicy<8, AllocatorPolicy::DefaultAlignment, true> DefaultAllocatorPolicy;
 typedef DynamicPoolAllocator<AllocatorPolicy> StdDynamicPoolAllocator;
 
 template < class _t_value >
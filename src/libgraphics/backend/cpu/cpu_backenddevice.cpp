@@ -1,9 +1,12 @@
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
+#include <libgraphics/backend/cpu/cpu_scheduler.hpp>
 
 #include <QThreadPool>
 #include <QDebug>
 
+#include <mutex>
+
 namespace libgraphics {
 namespace backend {
 namespace cpu {
@@ -245,6 +248,9 @@ struct BackendDevice::Private {
     std::vector< std::unique_ptr<ImageObject> >        imageObjects;
     std::shared_ptr<libgraphics::StdDynamicPoolAllocator>   allocator;
     QThreadPool threadPool;
+    TileScheduler scheduler;
+    TilePolicy tilePolicy;
+    mutable std::mutex tilePolicyMutex;
 
     Private() : allocator( new libgraphics::StdDynamicPoolAllocator() ) {}
     ~Private() {
@@ -256,6 +262,7 @@ struct BackendDevice::Private {
 
 BackendDevice::BackendDevice() : d( new Private() ) {
     this->threadPool()->setMaxThreadCount( 2 );
+    this->scheduler()->setWorkerCount( 2 );
 }
 
 bool    BackendDevice::initialize() {
@@ -267,10 +274,20 @@ bool    BackendDevice::initialize() {
     const auto idealThreadCount = std::max( 1, QThread::idealThreadCount() - 1 );
     d->threadPool.setMaxThreadCount( idealThreadCount );
 
+    /// the thread waiting for a batch helps executing
+    /// it, so one worker less than cores is enough.
+#ifdef FXAPI_CPU_BACKEND_SINGLETHREADED
+    d->scheduler.setWorkerCount( 0 );
+#else
+    d->scheduler.setWorkerCount( idealThreadCount );
+#endif
+
     return true;
 }
 
 bool    BackendDevice::shutdown() {
+    d->scheduler.stop();
+
     return true;
 }
 
@@ -531,6 +548,22 @@ QThreadPool* BackendDevice::threadPool() {
     return &d->threadPool;
 }
 
+TileScheduler* BackendDevice::scheduler() {
+    return &d->scheduler;
+}
+
+TilePolicy BackendDevice::tilePolicy() const {
+    std::lock_guard<std::mutex> lock( d->tilePolicyMutex );
+
+    return d->tilePolicy;
+}
+
+void BackendDevice::setTilePolicy( const TilePolicy& policy ) {
+    std::lock_guard<std::mutex> lock( d->tilePolicyMutex );
+
+    d->tilePolicy = policy;
+}
+
 }
 }
 }
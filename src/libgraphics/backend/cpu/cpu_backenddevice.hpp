@@ -5,6 +5,7 @@
 #include <libgraphics/base.hpp>
 #include <libgraphics/bitmap.hpp>
 #include <libgraphics/fxapi.hpp>
+#include <libgraphics/backend/cpu/cpu_tileplanner.hpp>
 
 #include <atomic>
 
@@ -17,6 +18,7 @@ namespace cpu {
 class DataRegion;
 class DataRegionRef;
 struct DataRegionEntry;
+class TileScheduler;
 
 class PixelArray : public fxapi::ApiResource {
     public:
@@ -112,6 +114,11 @@ class BackendDevice : public libgraphics::fxapi::ApiBackendDevice {
         /// properties
         virtual const char* name();
         QThreadPool* threadPool();
+        TileScheduler* scheduler();
+
+        /// tile geometry used by the cpu kernels
+        TilePolicy tilePolicy() const;
+        void setTilePolicy( const TilePolicy& policy );
 
         virtual int backendId();
 
@@ -357,6 +357,36 @@ bool ImageObject::create(
     return false;
 }
 
+bool ImageObject::createFromBlob(
+    fxapi::EPixelFormat::t format,
+    size_t width,
+    size_t height,
+    const std::shared_ptr<libgraphics::StdDynamicPoolAllocator::Blob>& blob
+) {
+    assert( blob );
+    LIBGRAPHICS_MEMORY_LOG_SCOPED_RESET( this );
+
+    if( ( this->d->allocator == nullptr ) || ( format == fxapi::EPixelFormat::Empty ) ) {
+        return false;
+    }
+
+    const auto successfullyResetted = d->bitmap.reset(
+                                          this->d->allocator,
+                                          fromCompatibleFormat( format ),
+                                          width,
+                                          height,
+                                          blob
+                                      );
+
+    if( !successfullyResetted ) {
+        return false;
+    }
+
+    d->format = format;
+
+    return true;
+}
+
 /// downloading, retrieving data
 bool ImageObject::retrieve(
     void* buffer
@@ -54,6 +54,15 @@ class ImageObject : public libgraphics::fxapi::ApiImageObject {
             size_t height
         );
 
+        /// uses the blob as pixel buffer instead of copying
+        /// its data, requires an allocator.
+        bool createFromBlob(
+            fxapi::EPixelFormat::t format,
+            size_t width,
+            size_t height,
+            const std::shared_ptr<libgraphics::StdDynamicPoolAllocator::Blob>& blob
+        );
+
         /// downloading, retrieving data
         virtual bool retrieve(
             void* buffer
@@ -0,0 +1,449 @@
+#include <libgraphics/backend/cpu/cpu_scheduler.hpp>
+
+#include <thread>
+#include <vector>
+
+namespace libgraphics {
+namespace backend {
+namespace cpu {
+
+/// TileBatch
+namespace {
+inline size_t countTiles( size_t length, size_t tileLength ) {
+    return ( length + tileLength - 1 ) / tileLength;
+}
+}
+
+TileBatch::TileBatch(
+    const libgraphics::Rect32I& _area,
+    size_t _tileHeight,
+    const kernel_fn& _kernel
+) : TileBatch( _area, 0, _tileHeight, _kernel ) {}
+
+TileBatch::TileBatch(
+    const libgraphics::Rect32I& _area,
+    size_t _tileWidth,
+    size_t _tileHeight,
+    const kernel_fn& _kernel
+) : m_Area( _area ),
+    m_TileWidth( ( _tileWidth == 0 || _tileWidth > ( size_t )std::max( 1, _area.width ) ) ? ( size_t )std::max( 1, _area.width ) : _tileWidth ),
+    m_TileHeight( std::max<size_t>( 1, _tileHeight ) ),
+    m_Columns( countTiles( ( size_t )std::max( 0, _area.width ), m_TileWidth ) ),
+    m_TileCount( ( _area.width > 0 && _area.height > 0 ) ? m_Columns * countTiles( ( size_t )_area.height, m_TileHeight ) : 0 ),
+    m_Kernel( _kernel ), m_Token( libgraphics::currentCancellationToken() ),
+    m_Pending( m_TileCount ), m_Done( m_TileCount == 0 ) {}
+
+TileBatch::~TileBatch() {
+    assert( done() );
+}
+
+size_t TileBatch::tileCount() const {
+    return m_TileCount;
+}
+
+size_t TileBatch::tileWidth() const {
+    return m_TileWidth;
+}
+
+size_t TileBatch::tileHeight() const {
+    return m_TileHeight;
+}
+
+const libgraphics::Rect32I& TileBatch::area() const {
+    return m_Area;
+}
+
+bool TileBatch::done() const {
+    return m_Pending.load() == 0;
+}
+
+bool TileBatch::cancelled() const {
+    return ( m_Token ) && m_Token->cancelled();
+}
+
+libgraphics::Rect32I TileBatch::tileArea( size_t index ) const {
+    assert( index < m_TileCount );
+
+    const size_t offsetX = ( index % m_Columns ) * m_TileWidth;
+    const size_t offsetY = ( index / m_Columns ) * m_TileHeight;
+
+    return libgraphics::Rect32I(
+               m_Area.x + ( int )offsetX,
+               m_Area.y + ( int )offsetY,
+               ( int )std::min<size_t>( m_TileWidth, ( size_t )m_Area.width - offsetX ),
+               ( int )std::min<size_t>( m_TileHeight, ( size_t )m_Area.height - offsetY )
+           );
+}
+
+void TileBatch::execute( size_t index ) {
+    /// cancelled tiles still have to be counted,
+    /// otherwise wait() would never return.
+    if( !cancelled() ) {
+        m_Kernel( tileArea( index ) );
+    }
+
+    if( m_Pending.fetch_sub( 1 ) == 1 ) {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        m_Done = true;
+        m_Finished.notify_all();
+    }
+}
+
+/// TileScheduler
+namespace {
+struct TileRange {
+    TileBatch*  batch;
+    size_t      begin;
+    size_t      end;
+
+    TileRange() : batch( nullptr ), begin( 0 ), end( 0 ) {}
+    TileRange( TileBatch* _batch, size_t _begin, size_t _end ) :
+        batch( _batch ), begin( _begin ), end( _end ) {}
+
+    inline size_t size() const {
+        return end - begin;
+    }
+};
+
+/// fixed-size deque of tile ranges, ordered from
+/// the oldest to the newest entry.
+struct WorkerQueue {
+    static const size_t Capacity = 64;
+
+    std::mutex  mutex;
+    TileRange   ranges[Capacity];
+    size_t      count;
+
+    WorkerQueue() : count( 0 ) {}
+
+    bool push( const TileRange& range ) {
+        std::lock_guard<std::mutex> lock( mutex );
+
+        if( count == Capacity ) {
+            return false;
+        }
+
+        ranges[count++] = range;
+
+        return true;
+    }
+
+    /// owner side: takes the next tile of the newest range.
+    bool pop( TileBatch*& batch, size_t& index ) {
+        std::lock_guard<std::mutex> lock( mutex );
+
+        if( count == 0 ) {
+            return false;
+        }
+
+        TileRange& range = ranges[count - 1];
+
+        batch = range.batch;
+        index = range.begin++;
+
+        if( range.begin == range.end ) {
+            --count;
+        }
+
+        return true;
+    }
+
+    /// thief side: takes the upper half of the oldest range,
+    /// optionally restricted to a single batch.
+    bool steal( TileRange& stolen, const TileBatch* only ) {
+        std::lock_guard<std::mutex> lock( mutex );
+
+        for( size_t i = 0; count > i; ++i ) {
+            TileRange& range = ranges[i];
+
+            if( only != nullptr && range.batch != only ) {
+                continue;
+            }
+
+            if( range.size() == 1 ) {
+                stolen = range;
+
+                for( size_t n = i + 1; count > n; ++n ) {
+                    ranges[n - 1] = ranges[n];
+                }
+
+                --count;
+            } else {
+                const size_t middle = range.begin + ( range.size() / 2 );
+
+                stolen = TileRange( range.batch, middle, range.end );
+                range.end = middle;
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+};
+}
+
+struct TileScheduler::Private {
+    /// the workers read the queue list without the lock, it is
+    /// only rebuilt while no worker is running. submitters and
+    /// waiters hold queuesMutex, because setWorkerCount() and
+    /// stop() may be called from other threads.
+    std::mutex                                  queuesMutex;
+    std::vector<std::unique_ptr<WorkerQueue> >  queues;
+    std::vector<std::thread>                    threads;
+
+    std::mutex                  sleepMutex;
+    std::condition_variable     wakeUp;
+    size_t                      epoch;
+    bool                        stopping;
+
+    std::atomic<size_t>         nextQueue;
+
+    Private() : epoch( 0 ), stopping( false ), nextQueue( 0 ) {}
+
+    inline void notify( bool all ) {
+        {
+            std::lock_guard<std::mutex> lock( sleepMutex );
+            ++epoch;
+        }
+
+        if( all ) {
+            wakeUp.notify_all();
+        } else {
+            wakeUp.notify_one();
+        }
+    }
+
+    bool stealFrom( size_t self, TileRange& stolen, const TileBatch* only ) {
+        const size_t count = queues.size();
+
+        for( size_t i = 1; count >= i; ++i ) {
+            const size_t victim = ( self + i ) % count;
+
+            if( queues[victim]->steal( stolen, only ) ) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void work( size_t self ) {
+        WorkerQueue& queue = *queues[self];
+
+        while( true ) {
+            size_t seen( 0 );
+
+            {
+                std::lock_guard<std::mutex> lock( sleepMutex );
+
+                if( stopping ) {
+                    return;
+                }
+
+                seen = epoch;
+            }
+
+            TileBatch* batch( nullptr );
+            size_t index( 0 );
+
+            if( queue.pop( batch, index ) ) {
+                batch->execute( index );
+                continue;
+            }
+
+            TileRange stolen;
+
+            if( stealFrom( self, stolen, nullptr ) ) {
+                if( stolen.size() > 1 ) {
+                    const TileRange remainder( stolen.batch, stolen.begin + 1, stolen.end );
+
+                    if( queue.push( remainder ) ) {
+                        stolen.end = stolen.begin + 1;
+
+                        /// let sleeping workers split the remainder.
+                        notify( false );
+                    }
+                }
+
+                for( size_t i = stolen.begin; stolen.end > i; ++i ) {
+                    stolen.batch->execute( i );
+                }
+
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock( sleepMutex );
+            wakeUp.wait( lock, [this, seen]() {
+                return stopping || ( epoch != seen );
+            } );
+        }
+    }
+
+    void start( size_t workers ) {
+        assert( threads.empty() );
+
+        std::lock_guard<std::mutex> queuesLock( queuesMutex );
+
+        {
+            std::lock_guard<std::mutex> lock( sleepMutex );
+            stopping = false;
+        }
+
+        queues.clear();
+
+        for( size_t i = 0; workers > i; ++i ) {
+            queues.push_back( std::unique_ptr<WorkerQueue>( new WorkerQueue() ) );
+        }
+
+        for( size_t i = 0; workers > i; ++i ) {
+            threads.push_back( std::thread( &Private::work, this, i ) );
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock( sleepMutex );
+            stopping = true;
+        }
+
+        wakeUp.notify_all();
+
+        for( auto it = threads.begin(); it != threads.end(); ++it ) {
+            ( *it ).join();
+        }
+
+        threads.clear();
+
+        std::vector<std::unique_ptr<WorkerQueue> > detached;
+
+        {
+            std::lock_guard<std::mutex> queuesLock( queuesMutex );
+            detached.swap( queues );
+        }
+
+        drain( detached );
+    }
+
+    /// executes the tiles left in the queues on the calling thread,
+    /// otherwise batches in flight would never finish.
+    static void drain( std::vector<std::unique_ptr<WorkerQueue> >& detached ) {
+        for( auto it = detached.begin(); it != detached.end(); ++it ) {
+            TileBatch* batch( nullptr );
+            size_t index( 0 );
+
+            while( ( *it )->pop( batch, index ) ) {
+                batch->execute( index );
+            }
+        }
+    }
+};
+
+TileScheduler::TileScheduler( size_t workers ) : d( new Private() ) {
+    d->start( workers );
+}
+
+TileScheduler::~TileScheduler() {
+    stop();
+}
+
+void TileScheduler::submit( TileBatch& batch ) {
+    const size_t tiles = batch.tileCount();
+
+    if( tiles == 0 ) {
+        return;
+    }
+
+    size_t workers( 0 );
+    std::vector<TileRange> overflow;
+
+    {
+        std::lock_guard<std::mutex> lock( d->queuesMutex );
+
+        workers = d->queues.size();
+
+        /// hand every worker one contiguous chunk, the rest
+        /// is balanced by stealing.
+        const size_t chunks = std::min( workers, tiles );
+        const size_t first  = d->nextQueue.fetch_add( 1 );
+
+        for( size_t i = 0; chunks > i; ++i ) {
+            const TileRange range(
+                &batch,
+                ( tiles * i ) / chunks,
+                ( tiles * ( i + 1 ) ) / chunks
+            );
+
+            if( !d->queues[( first + i ) % workers]->push( range ) ) {
+                overflow.push_back( range );
+            }
+        }
+    }
+
+    /// tiles are never executed under the lock, kernels
+    /// may submit batches themselves.
+    if( workers == 0 ) {
+        for( size_t i = 0; tiles > i; ++i ) {
+            batch.execute( i );
+        }
+
+        return;
+    }
+
+    d->notify( true );
+
+    for( auto it = overflow.begin(); it != overflow.end(); ++it ) {
+        for( size_t n = ( *it ).begin; ( *it ).end > n; ++n ) {
+            batch.execute( n );
+        }
+    }
+}
+
+void TileScheduler::wait( TileBatch& batch ) {
+    /// help executing the batch instead of blocking
+    /// the current thread.
+    while( !batch.done() ) {
+        TileRange stolen;
+        bool found( false );
+
+        {
+            std::lock_guard<std::mutex> lock( d->queuesMutex );
+            found = !d->queues.empty() && d->stealFrom( 0, stolen, &batch );
+        }
+
+        if( !found ) {
+            break;
+        }
+
+        for( size_t i = stolen.begin; stolen.end > i; ++i ) {
+            batch.execute( i );
+        }
+    }
+
+    std::unique_lock<std::mutex> lock( batch.m_Mutex );
+    batch.m_Finished.wait( lock, [&batch]() {
+        return batch.m_Done;
+    } );
+}
+
+void TileScheduler::run( TileBatch& batch ) {
+    submit( batch );
+    wait( batch );
+}
+
+void TileScheduler::setWorkerCount( size_t workers ) {
+    d->stop();
+    d->start( workers );
+}
+
+void TileScheduler::stop() {
+    d->stop();
+}
+
+size_t TileScheduler::workerCount() const {
+    return d->threads.size();
+}
+
+}
+}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <libgraphics/base.hpp>
+#include <libgraphics/bitmap.hpp>
+#include <libgraphics/cancellation.hpp>
+#include <libcommon/noncopyable.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace libgraphics {
+namespace backend {
+namespace cpu {
+
+class TileScheduler;
+
+/// TileBatch
+/**
+ *  A single parallel-for over an area. The area is cut
+ *  into tiles of tileWidth x tileHeight pixels in row-major
+ *  order; a tileWidth of 0 spans the full area width, which
+ *  turns the tiles into row bands. The kernel is called once
+ *  per tile. Batches are owned by the submitter and usually
+ *  live on its stack, the scheduler does not allocate per tile.
+ *  The cancellation token of the constructing thread is
+ *  captured; once it is cancelled the remaining tiles are
+ *  skipped.
+ */
+class TileBatch : public libcommon::INonCopyable {
+    public:
+        friend class TileScheduler;
+
+        typedef std::function<void( const libgraphics::Rect32I& )> kernel_fn;
+
+        /// constr.
+        TileBatch(
+            const libgraphics::Rect32I& _area,
+            size_t _tileHeight,
+            const kernel_fn& _kernel
+        );
+        TileBatch(
+            const libgraphics::Rect32I& _area,
+            size_t _tileWidth,
+            size_t _tileHeight,
+            const kernel_fn& _kernel
+        );
+
+        /// destr.
+        virtual ~TileBatch();
+
+        /// properties
+        size_t tileCount() const;
+        size_t tileWidth() const;
+        size_t tileHeight() const;
+        const libgraphics::Rect32I& area() const;
+        bool done() const;
+        bool cancelled() const;
+
+        /// returns the area of the specified tile
+        libgraphics::Rect32I tileArea( size_t index ) const;
+    private:
+        void execute( size_t index );
+
+        const libgraphics::Rect32I  m_Area;
+        const size_t                m_TileWidth;
+        const size_t                m_TileHeight;
+        const size_t                m_Columns;
+        const size_t                m_TileCount;
+        const kernel_fn             m_Kernel;
+        const std::shared_ptr<libgraphics::CancellationToken>   m_Token;
+
+        std::atomic<size_t>         m_Pending;
+        bool                        m_Done;
+        std::mutex                  m_Mutex;
+        std::condition_variable     m_Finished;
+};
+
+/// TileScheduler
+/**
+ *  Work-stealing scheduler for tile kernels. Every worker
+ *  owns a fixed-size deque of tile ranges: the owner takes
+ *  single tiles from the newest range, idle workers steal
+ *  the upper half of the oldest range of a victim.
+ *  Threads waiting for a batch help executing it, so nested
+ *  batches cannot deadlock.
+ */
+class TileScheduler : public libcommon::INonCopyable {
+    public:
+        struct Private;
+
+        /// constr.
+        explicit TileScheduler( size_t workers = 0 );
+
+        /// destr.
+        virtual ~TileScheduler();
+
+        /// methods
+        void submit( TileBatch& batch );
+        void wait( TileBatch& batch );
+        void run( TileBatch& batch );
+
+        /// stops all workers and restarts the scheduler
+        /// with the specified number of threads. tiles still
+        /// queued are executed by the calling thread first.
+        void setWorkerCount( size_t workers );
+        void stop();
+
+        /// properties
+        size_t workerCount() const;
+    protected:
+        std::shared_ptr<Private>   d;
+};
+
+}
+}
+}
@@ -0,0 +1,69 @@
+#include <libgraphics/backend/cpu/cpu_tileplanner.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace libgraphics {
+namespace backend {
+namespace cpu {
+
+/// TilePolicy
+TilePolicy::TilePolicy() : TilePolicy( SystemInfo::queryCpuCacheInfo() ) {}
+
+TilePolicy::TilePolicy( const SystemInfo::CpuCacheInfo& _cache ) : cache( _cache ),
+    cacheUsage( 0.5f ), minTilesPerThread( 4 ), minBandHeight( 4 ), minTileWidth( 64 ),
+    fixedTileWidth( 0 ), fixedTileHeight( 0 ) {}
+
+TilePlan TilePolicy::plan(
+    const libgraphics::Rect32I& area,
+    const TileHints& hints,
+    size_t threads
+) const {
+    const size_t width  = ( size_t )std::max( 1, area.width );
+    const size_t height = ( size_t )std::max( 1, area.height );
+
+    if( fixedTileWidth > 0 || fixedTileHeight > 0 ) {
+        return TilePlan(
+                   fixedTileWidth,
+                   ( fixedTileHeight > 0 ) ? fixedTileHeight : height
+               );
+    }
+
+    const size_t pixelSize = ( hints.format == fxapi::EPixelFormat::Empty ) ? 4 :
+                             std::max<size_t>( 1, fxapi::EPixelFormat::getPixelSize( hints.format ) );
+    const size_t buffers   = std::max<size_t>( 1, hints.buffers );
+
+    const size_t budget     = std::max<size_t>( cache.lineSize, ( size_t )( ( float )cache.l2Size * cacheUsage ) );
+    const size_t tilePixels = std::max<size_t>( minTileWidth, budget / ( pixelSize * buffers ) );
+
+    /// enough tiles to balance the load between all threads
+    const size_t wantedTiles = std::max<size_t>( 1, threads ) * std::max<size_t>( 1, minTilesPerThread );
+
+    if( hints.separable || ( width * minBandHeight <= tilePixels ) ) {
+        size_t rows = std::max<size_t>( 1, tilePixels / width );
+        rows = std::min( rows, std::max<size_t>( 1, height / wantedTiles ) );
+
+        return TilePlan( 0, rows );
+    }
+
+    /// rows are too wide, use tiles that are wider than high and
+    /// start on a cache line.
+    const size_t linePixels = std::max<size_t>( 1, cache.lineSize / pixelSize );
+
+    size_t tileWidth = ( size_t )( std::sqrt( ( double )tilePixels ) * 2.0 );
+    tileWidth = std::max( minTileWidth, tileWidth - ( tileWidth % linePixels ) );
+    tileWidth = std::min( tileWidth, width );
+
+    size_t tileHeight = std::max<size_t>( 1, tilePixels / tileWidth );
+
+    const size_t columns    = ( width + tileWidth - 1 ) / tileWidth;
+    const size_t neededRows = ( wantedTiles + columns - 1 ) / columns;
+
+    tileHeight = std::min( tileHeight, std::max<size_t>( 1, height / neededRows ) );
+
+    return TilePlan( tileWidth, tileHeight );
+}
+
+}
+}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <libgraphics/base.hpp>
+#include <libgraphics/bitmap.hpp>
+#include <libgraphics/fxapi.hpp>
+#include <libgraphics/systeminfo.hpp>
+
+namespace libgraphics {
+namespace backend {
+namespace cpu {
+
+/// TileHints
+/**
+ *  Describes the memory behaviour of a kernel, used
+ *  to pick a tile geometry.
+ */
+struct TileHints {
+    fxapi::EPixelFormat::t  format;
+    size_t                  buffers;    /// number of image buffers touched per pixel
+    bool                    separable;  /// one pass of a separable filter, prefers row bands
+
+    TileHints() : format( fxapi::EPixelFormat::Empty ), buffers( 2 ), separable( false ) {}
+    TileHints( fxapi::EPixelFormat::t _format, size_t _buffers = 2, bool _separable = false ) :
+        format( _format ), buffers( _buffers ), separable( _separable ) {}
+};
+
+/// TilePlan
+struct TilePlan {
+    size_t      tileWidth;  /// 0 spans the full area width
+    size_t      tileHeight;
+
+    TilePlan() : tileWidth( 0 ), tileHeight( 1 ) {}
+    TilePlan( size_t _width, size_t _height ) : tileWidth( _width ), tileHeight( _height ) {}
+};
+
+/// TilePolicy
+/**
+ *  Picks tile shapes so that the working set of one tile
+ *  (tile pixels * pixel size * buffers) stays within a
+ *  fraction of the per-core L2 cache, while still producing
+ *  enough tiles to keep all threads busy. Full-width row
+ *  bands are used whenever a few rows fit the budget, and
+ *  always for separable passes.
+ */
+struct TilePolicy {
+    SystemInfo::CpuCacheInfo    cache;
+
+    float       cacheUsage;         /// fraction of L2 used by one tile, default: 0.5
+    size_t      minTilesPerThread;  /// default: 4
+    size_t      minBandHeight;      /// rows needed before row bands are preferred, default: 4
+    size_t      minTileWidth;       /// default: 64
+    size_t      fixedTileWidth;     /// overrides the planner if > 0
+    size_t      fixedTileHeight;    /// overrides the planner if > 0
+
+    /// queries the cache sizes of the current machine.
+    TilePolicy();
+    explicit TilePolicy( const SystemInfo::CpuCacheInfo& _cache );
+
+    /// returns the tile geometry for the area.
+    TilePlan plan(
+        const libgraphics::Rect32I& area,
+        const TileHints& hints,
+        size_t threads
+    ) const;
+};
+
+}
+}
+}
@@ -1634,6 +1634,16 @@ class LIBCOMMON_API Bitmap {
         bool reset( libgraphics::StdDynamicPoolAllocator* allocator, const libgraphics::Format& format, const int width, const int height );
         bool reset( libgraphics::StdDynamicPoolAllocator* allocator, const BitmapInfo& info );
 
+        /**
+            \fn         reset
+            \brief
+                    Resets the internal state and adopts the specified blob as Bitmap buffer instead of
+                    allocating a new one. The blob has to hold width * height pixels of the specified format.
+
+                    The allocator is used for all following resets.
+        */
+        bool reset( libgraphics::StdDynamicPoolAllocator* allocator, const libgraphics::Format& format, const int width, const int height, const std::shared_ptr<libgraphics::StdDynamicPoolAllocator::Blob>& blob );
+
         /**
             \fn         reset
             \brief
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+#include <libgraphics/fxapi.hpp>
+
+#include <string>
+#include <vector>
+
+namespace libgraphics {
+
+/// BufferPlan
+/**
+ *  Liveness plan of the intermediate layers of a render. Every
+ *  stage adds the layers it needs together with the range of
+ *  stages they are alive in. compute() assigns the buffers to
+ *  physical slots, buffers with equal format and size whose
+ *  lifetimes don't overlap share a slot. A render leases one
+ *  layer per slot and hands the layer of a buffer's slot to the
+ *  stages the buffer is alive in.
+ */
+class BufferPlan : public libcommon::INonCopyable {
+    public:
+        BufferPlan();
+        virtual ~BufferPlan() {}
+
+        /// adds a buffer, which is alive from the first to
+        /// the last stage, both inclusive. returns its index.
+        size_t addBuffer(
+            const std::string&      name,
+            fxapi::EPixelFormat::t  format,
+            size_t                  width,
+            size_t                  height,
+            size_t                  firstStage,
+            size_t                  lastStage
+        );
+
+        size_t  bufferCount() const;
+        size_t  stageCount() const;
+
+        /// assigns the buffers to slots.
+        void    compute();
+
+        size_t  slotCount() const;
+
+        /// slot of the buffer, valid after compute()
+        size_t  slot( size_t buffer ) const;
+
+        /// bytes of all slots: the predicted peak memory of
+        /// the intermediate layers.
+        size_t  peakMemory() const;
+
+        /// bytes of the buffers alive during the stage
+        size_t  stageMemory( size_t stage ) const;
+
+        /// bytes, if every buffer got storage of its own
+        size_t  unsharedMemory() const;
+
+        void    clear();
+    protected:
+        struct Buffer {
+            std::string             name;
+            fxapi::EPixelFormat::t  format;
+            size_t                  width;
+            size_t                  height;
+            size_t                  firstStage;
+            size_t                  lastStage;
+            size_t                  slot;
+
+            size_t byteSize() const;
+        };
+        struct Slot {
+            fxapi::EPixelFormat::t  format;
+            size_t                  width;
+            size_t                  height;
+            size_t                  lastStage;  /// of the last buffer assigned
+        };
+
+        std::vector<Buffer> m_Buffers;
+        std::vector<Slot>   m_Slots;
+        size_t              m_StageCount;
+        size_t              m_PeakMemory;
+};
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace libgraphics {
+
+/// CancellationToken
+/**
+ *  Shared flag used to abort a running render. Tile
+ *  batches capture the token of the submitting thread and
+ *  skip their remaining tiles once it was cancelled; filter
+ *  chains check it between their steps. A cancelled render
+ *  leaves its destination in an undefined state.
+ */
+class CancellationToken : public libcommon::INonCopyable {
+    public:
+        CancellationToken();
+        virtual ~CancellationToken() {}
+
+        void cancel();
+        void reset();
+
+        bool cancelled() const;
+    private:
+        std::atomic<bool>   m_Cancelled;
+};
+
+/// returns the token installed for the current thread,
+/// or an empty pointer.
+const std::shared_ptr<CancellationToken>& currentCancellationToken();
+
+/// returns true if the token of the current thread
+/// was cancelled.
+bool isCurrentOperationCancelled();
+
+/// ScopedCancellationToken
+/**
+ *  Installs a token for the current thread and restores
+ *  the previous one on destruction.
+ */
+class ScopedCancellationToken : public libcommon::INonCopyable {
+    public:
+        explicit ScopedCancellationToken( const std::shared_ptr<CancellationToken>& token );
+        virtual ~ScopedCancellationToken();
+    private:
+        std::shared_ptr<CancellationToken>  m_Previous;
+};
+
+}
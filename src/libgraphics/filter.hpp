@@ -1,10 +1,12 @@
 #pragma once
 
 #include <libgraphics/base.hpp>
+#include <libgraphics/bufferplan.hpp>
 #include <libgraphics/filterpreset.hpp>
 #include <libgraphics/filterpresetcollection.hpp>
 #include <libgraphics/image.hpp>
 #include <libgraphics/fxapi.hpp>
+#include <libgraphics/pointoperation.hpp>
 
 namespace libgraphics {
 
@@ -33,12 +35,65 @@ class Filter : public libcommon::INonCopyable {
             libgraphics::ImageLayer*    source
         ) = 0;
 
+        /// renders the pixels in area. the source has to be
+        /// valid in area grown by haloRadius(). by default the
+        /// whole image is rendered.
+        virtual bool process(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+
+        /// number of pixels next to an output pixel, which
+        /// the filter reads from the source.
+        virtual int haloRadius() const;
+
+        /// adds the layers the filter allocates while it renders
+        /// an image of the format and size in the stage. buffers
+        /// kept between renders are alive in the stage only, see
+        /// releaseBuffers().
+        virtual void planBuffers(
+            BufferPlan&                 plan,
+            size_t                      stage,
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            size_t                      width,
+            size_t                      height
+        ) const;
+
+        /// drops the buffers the filter keeps between renders
+        /// to speed up the next one.
+        virtual void releaseBuffers();
+
+        /// returns the per pixel stage of the filter for the
+        /// specified format, or nullptr if the filter reads
+        /// neighbouring pixels or can't be fused. the stage is a
+        /// snapshot of the current parameters.
+        virtual std::shared_ptr<const PointOperation> pointOperation( fxapi::EPixelFormat::t format );
+
+        /// true, if the filter leaves a gray image in all color
+        /// channels, like the b&w mixers do.
+        virtual bool producesMonochrome() const;
+
+        /// true, if the filter renders single channel images on
+        /// the cpu backend, see FilterChain.
+        virtual bool acceptsMonochrome() const;
+
+        /// pixels of the rendered image per pixel of the image the
+        /// parameters are meant for. radii measured in pixels are
+        /// scaled by it, e.g. for scaled down previews. a change
+        /// drops the buffers kept between renders.
+        float pixelScale() const;
+        void setPixelScale( float scale );
+
         virtual Filter* clone() = 0;
         virtual FilterPreset toPreset() const = 0;
         virtual bool fromPreset( const FilterPreset& preset ) = 0;
     protected:
         std::string m_Name;
         fxapi::ApiBackendDevice* m_Device;
+        float m_PixelScale;
 };
 
 /// applies the given filter to the specified
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <libgraphics/base.hpp>
+#include <libgraphics/bufferplan.hpp>
+#include <libgraphics/filter.hpp>
+#include <libgraphics/filterstack.hpp>
+#include <libgraphics/image.hpp>
+#include <libgraphics/fxapi.hpp>
+#include <libgraphics/pointoperation.hpp>
+
+namespace libgraphics {
+
+/// FilterChain
+/**
+ *  Render plan of a filter stack. Runs of consecutive filters,
+ *  which provide a point operation for the pixel format, are
+ *  fused into a single pass that reads and writes each pixel
+ *  once. All other filters keep a pass of their own. Fusing is
+ *  only done for the cpu backend.
+ *  With the monochrome working format, the passes after a b&w
+ *  mixer render single channel layers, as long as their
+ *  filters accept them. The chain returns to the rgb format
+ *  at the first filter that needs the color channels, like
+ *  the split toning. Only used for rgb sources on the cpu
+ *  backend.
+ *  The point operations are snapshots of the filter parameters,
+ *  the chain has to be rebuilt after the filters were changed.
+ */
+class FilterChain : public libcommon::INonCopyable {
+    public:
+        FilterChain(
+            const FilterStack&          stack,
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            bool                        monochromeWorkingFormat = false
+        );
+        virtual ~FilterChain() {}
+
+        size_t  passCount() const;
+
+        /// pixel format the pass reads and writes: the chain
+        /// format or its single channel equivalent.
+        fxapi::EPixelFormat::t passFormat( size_t index ) const;
+
+        /// number of filters rendered by the pass
+        size_t  filterCount( size_t index ) const;
+
+        /// identifies the result of the pass: the source key
+        /// combined with the presets of all filters up to and
+        /// including the pass.
+        unsigned long long passKey( size_t index, unsigned long long sourceKey ) const;
+
+        /// number of pixels next to an output pixel, which
+        /// the pass reads from its source.
+        int     haloRadius( size_t index ) const;
+
+        /// returns the region the pass has to render, so that
+        /// the last pass can render area: area grown by the
+        /// halos of all following passes.
+        Rect32I passArea(
+            size_t          index,
+            const Rect32I&  area,
+            size_t          width,
+            size_t          height
+        ) const;
+
+        /// adds the buffers the filters allocate during a
+        /// whole-chain render to the plan, one stage per pass.
+        /// the layers the passes read and write are planned by
+        /// the caller.
+        void planBuffers(
+            BufferPlan&                 plan,
+            fxapi::ApiBackendDevice*    device,
+            size_t                      width,
+            size_t                      height
+        ) const;
+
+        /// drops the buffers the filters of the pass keep
+        /// between renders.
+        void releaseBuffers( size_t index );
+
+        bool processPass(
+            size_t                      index,
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source
+        );
+        bool processPass(
+            size_t                      index,
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+    protected:
+        struct Pass {
+            FilterStack::ContainerType  filters;
+            PointOperationList          operations;
+            fxapi::EPixelFormat::t      format;
+            unsigned long long          presetKey;
+
+            Pass() : format( fxapi::EPixelFormat::Empty ), presetKey( 0 ) {}
+        };
+
+        std::vector<Pass>   m_Passes;
+};
+
+}
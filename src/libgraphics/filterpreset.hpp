@@ -124,6 +124,11 @@ class FilterPreset {
 
         bool containsValueWithName( const std::string& name ) const;
 
+        /// 64 bit hash of the filter name and all values. equal
+        /// presets have equal hashes, the preset name and category
+        /// are ignored.
+        unsigned long long hash() const;
+
         void clear();
 
         std::string& category();
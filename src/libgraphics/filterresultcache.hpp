@@ -0,0 +1,101 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+#include <libgraphics/fxapi.hpp>
+#include <libgraphics/image.hpp>
+#include <libgraphics/memorygovernor.hpp>
+#include <libgraphics/spillfile.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace libgraphics {
+
+/// FilterResultCache
+/**
+ *  Keeps copies of intermediate filter results, so a render can
+ *  start from the output of the last unchanged filter. The keys
+ *  are computed by the caller, see FilterChain::passKey(). The
+ *  least recently used results are spilled to a scratch file
+ *  as soon as the memory budget is exceeded, or when the
+ *  MemoryGovernor reclaims memory. Spilled results are restored
+ *  from the file and dropped once the spill budget is exceeded.
+ */
+class FilterResultCache : public libcommon::INonCopyable, public MemoryConsumer {
+    public:
+        typedef unsigned long long KeyType;
+
+        static const size_t DefaultMemoryBudget = 256 * 1024 * 1024;
+        static const size_t DefaultSpillBudget  = ( size_t )1024 * 1024 * 1024;
+
+        explicit FilterResultCache( size_t memoryBudget = DefaultMemoryBudget, size_t spillBudget = DefaultSpillBudget );
+        virtual ~FilterResultCache();
+
+        size_t  memoryBudget() const;
+        void    setMemoryBudget( size_t budget );
+
+        /// bytes on disk, 0 disables spilling
+        size_t  spillBudget() const;
+        void    setSpillBudget( size_t budget );
+
+        /// bytes used by the cached layers in memory
+        virtual size_t  memoryUsage() const;
+        size_t  spillUsage() const;
+        size_t  count() const;
+
+        /// spills or drops the least recently used layers.
+        virtual size_t  reclaim( size_t bytes );
+
+        bool contains( KeyType key ) const;
+
+        /// copies the cached result of the key into the
+        /// destination layer. returns false if the key is
+        /// unknown or the formats don't match.
+        bool restore(
+            KeyType                 key,
+            libgraphics::ImageLayer*    destination
+        );
+
+        /// stores a copy of the layer. layers larger than the
+        /// memory budget are not cached.
+        bool store(
+            KeyType                     key,
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    layer
+        );
+
+        void clear();
+    protected:
+        struct Entry {
+            KeyType                                     key;
+            std::shared_ptr<libgraphics::ImageLayer>    layer;      /// nullptr, if spilled
+            size_t                                      byteSize;
+            fxapi::EPixelFormat::t                      format;
+            size_t                                      width;
+            size_t                                      height;
+            SpillFile::Region                           spilled;
+        };
+        typedef std::list<Entry>    EntryList;
+
+        EntryList::iterator find( KeyType key );
+        EntryList::const_iterator find( KeyType key ) const;
+        /// least recently used entry in memory
+        EntryList::iterator leastRecentlyUsed();
+        void evict( size_t requiredBytes );
+        bool spill( Entry& entry );
+        /// drops spilled entries until requiredBytes fit
+        void trimSpill( size_t requiredBytes );
+        void erase( EntryList::iterator it );
+        size_t spilledBytes() const;
+
+        mutable std::mutex          m_Mutex;
+        EntryList                   m_Entries;      /// most recently used first
+        size_t                      m_MemoryBudget;
+        size_t                      m_MemoryUsage;
+        size_t                      m_SpillBudget;
+        std::unique_ptr<SpillFile>  m_SpillFile;    /// created on the first spill
+};
+
+}
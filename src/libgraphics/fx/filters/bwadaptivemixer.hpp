@@ -20,6 +20,14 @@ class BWAdaptiveMixer : public libgraphics::Filter {
             libgraphics::ImageLayer*    destination,
             libgraphics::ImageLayer*    source
         );
+        virtual bool process(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+
+        virtual bool producesMonochrome() const;
 
         virtual FilterPreset toPreset() const;
         virtual bool fromPreset( const FilterPreset& preset );
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <libgraphics/filter.hpp>
+#include <libgraphics/memorygovernor.hpp>
+#include <mutex>
 #include <vector>
 
 namespace libgraphics {
@@ -12,10 +14,16 @@ namespace filters {
     float threshold
 */
 
-class CascadedSharpen : public libgraphics::Filter {
+/// CascadedSharpen
+/**
+ *  Keeps the blurred cascades between renders. The filter is a
+ *  MemoryConsumer: reclaim() drops the cascades unless the filter
+ *  is rendering, the next render blurs them again.
+ */
+class CascadedSharpen : public libgraphics::Filter, public libgraphics::MemoryConsumer {
     public:
         explicit CascadedSharpen( fxapi::ApiBackendDevice* _device );
-        virtual ~CascadedSharpen() {}
+        virtual ~CascadedSharpen();
 
         virtual bool process(
             libgraphics::ImageLayer*    destination,
@@ -26,6 +34,29 @@ class CascadedSharpen : public libgraphics::Filter {
             libgraphics::ImageLayer*    destination,
             libgraphics::ImageLayer*    source
         );
+        virtual bool process(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+
+        virtual int haloRadius() const;
+
+        virtual void planBuffers(
+            BufferPlan&                 plan,
+            size_t                      stage,
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            size_t                      width,
+            size_t                      height
+        ) const;
+        virtual void releaseBuffers();
+        virtual bool acceptsMonochrome() const;
+
+        /// bytes of the cascade buffers
+        virtual size_t memoryUsage() const;
+        virtual size_t reclaim( size_t bytes );
 
         virtual FilterPreset toPreset() const;
         virtual bool fromPreset( const FilterPreset& preset );
@@ -56,20 +87,33 @@ class CascadedSharpen : public libgraphics::Filter {
 
         virtual Filter* clone();
     protected:
+        bool render(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+        void dropBuffers();
+
         void generateBlurBuffer(
-            size_t index, fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius
+            size_t index, fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius, const Rect32I& area
         );
 
         struct CascadeEntry {
             float   blurRadius;
             float   strength;
             std::shared_ptr<libgraphics::ImageLayer> buffer;
+            Rect32I area; /// blurred part of the buffer
 
             CascadeEntry() : blurRadius( 1.0f ), strength( 1.0f ) {}
         };
         std::vector<CascadeEntry>   m_Cascades;
         bool                        m_ShouldUpdateCascades;
         float                       m_Threshold;
+
+        mutable std::recursive_mutex    m_BufferMutex;  /// guards the cascades against reclaim()
+        bool                            m_BuffersInUse;
+        bool                            m_OverBudget;   /// drop the cascades after the render
 };
 
 
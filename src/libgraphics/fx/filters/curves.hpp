@@ -23,6 +23,15 @@ class Curves : public libgraphics::Filter {
             libgraphics::ImageLayer*    destination,
             libgraphics::ImageLayer*    source
         );
+        virtual bool process(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+
+        virtual std::shared_ptr<const PointOperation> pointOperation( fxapi::EPixelFormat::t format );
+        virtual bool acceptsMonochrome() const;
 
         virtual FilterPreset toPreset() const;
         virtual bool fromPreset( const FilterPreset& preset );
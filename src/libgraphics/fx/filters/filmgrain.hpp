@@ -1,15 +1,24 @@
 #pragma once
 
 #include <libgraphics/filter.hpp>
+#include <libgraphics/memorygovernor.hpp>
+#include <mutex>
 
 namespace libgraphics {
 namespace fx {
 namespace filters {
 
-class FilmGrain : public libgraphics::Filter {
+/// FilmGrain
+/**
+ *  Keeps the grain image between renders. The filter is a
+ *  MemoryConsumer: reclaim() drops the grain unless the filter
+ *  is rendering, the next render generates it again from the
+ *  same seed.
+ */
+class FilmGrain : public libgraphics::Filter, public libgraphics::MemoryConsumer {
     public:
         explicit FilmGrain( fxapi::ApiBackendDevice* _device );
-        virtual ~FilmGrain() {}
+        virtual ~FilmGrain();
 
         virtual bool process(
             libgraphics::ImageLayer*    destination,
@@ -20,11 +29,33 @@ class FilmGrain : public libgraphics::Filter {
             libgraphics::ImageLayer*    destination,
             libgraphics::ImageLayer*    source
         );
+        virtual bool process(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+
+        virtual void planBuffers(
+            BufferPlan&                 plan,
+            size_t                      stage,
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            size_t                      width,
+            size_t                      height
+        ) const;
+        virtual void releaseBuffers();
+        virtual bool acceptsMonochrome() const;
+
+        /// bytes of the grain image
+        virtual size_t memoryUsage() const;
+        virtual size_t reclaim( size_t bytes );
 
         virtual FilterPreset toPreset() const;
         virtual bool fromPreset( const FilterPreset& preset );
 
-        /// grain image
+        /// grain image. returns false, if the grain doesn't
+        /// fit into the memory budget.
         bool loadGrainFromData(
             fxapi::ApiBackendDevice* device,
             fxapi::EPixelFormat::t format,
@@ -72,9 +103,30 @@ class FilmGrain : public libgraphics::Filter {
         const float& grainBlurRadius() const;
         void setGrainBlurRadius( float radius );
 
+        /// seed of the grain pattern, a grain image of the same
+        /// size and format is always generated the same way.
+        unsigned int grainSeed() const;
+        void setGrainSeed( unsigned int seed );
+
         virtual Filter* clone();
     protected:
+        bool render(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
         void calculateGrainImage();
+
+        /// converts the grain layer between a color format and
+        /// its single channel format instead of generating it
+        /// again. returns false if it can't be converted.
+        bool convertGrain(
+            fxapi::ApiBackendDevice* device,
+            fxapi::EPixelFormat::t format,
+            size_t width,
+            size_t height
+        );
         void updateCurveData( size_t dataLen );
 
         bool                                    m_ModifiedCurve;
@@ -84,6 +136,11 @@ class FilmGrain : public libgraphics::Filter {
         std::unique_ptr<libgraphics::ImageLayer>   m_GrainLayer;
         bool                                            m_MonoGrain;
         float                                           m_GrainBlurRadius;
+        unsigned int                                    m_GrainSeed;
+
+        mutable std::recursive_mutex                    m_BufferMutex;  /// guards the grain against reclaim()
+        bool                                            m_BuffersInUse;
+        bool                                            m_OverBudget;   /// drop the grain after the render
 };
 
 }
@@ -28,6 +28,22 @@ bool BWAdaptiveMixer::process(
     fxapi::ApiBackendDevice*    device,
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
+) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool BWAdaptiveMixer::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
 ) {
     assert( destination != nullptr );
     assert( source != nullptr );
@@ -58,7 +74,7 @@ bool BWAdaptiveMixer::process(
         device,
         destination,
         source,
-        source->size(),
+        area,
         this->m_HighlightWeights.Values[0],
         this->m_HighlightWeights.Values[1],
         this->m_HighlightWeights.Values[2],
@@ -71,6 +87,10 @@ bool BWAdaptiveMixer::process(
     return true;
 }
 
+bool BWAdaptiveMixer::producesMonochrome() const {
+    return true;
+}
+
 FilterPreset BWAdaptiveMixer::toPreset() const {
     FilterPreset preset;
 
@@ -1,6 +1,7 @@
 
 #include <libgraphics/fx/filters/bwmixer.hpp>
 #include <libgraphics/fx/operations/basic.hpp>
+#include <libgraphics/fx/operations/complex.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -25,6 +26,22 @@ bool BWMixer::process(
     fxapi::ApiBackendDevice*    device,
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
+) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool BWMixer::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
 ) {
     assert( destination != nullptr );
     assert( source != nullptr );
@@ -43,13 +60,31 @@ bool BWMixer::process(
     libgraphics::fx::operations::convertToMonochrome(
         destination,
         source,
-        source->size(),
+        area,
         ( float* )factors
     );
 
     return true;
 }
 
+std::shared_ptr<const PointOperation> BWMixer::pointOperation( fxapi::EPixelFormat::t format ) {
+    ( void )format;
+
+    const float factors[3] = {
+        this->m_RedSensitivity,
+        this->m_GreenSensitivity,
+        this->m_BlueSensitivity
+    };
+
+    return libgraphics::fx::operations::makeMonochromePointOperation(
+               factors
+           );
+}
+
+bool BWMixer::producesMonochrome() const {
+    return true;
+}
+
 FilterPreset BWMixer::toPreset() const {
     FilterPreset preset;
 
@@ -4,15 +4,24 @@
 #include <libgraphics/fx/operations/basic.hpp>
 #include <libgraphics/fx/operations/complex.hpp>
 #include <libgraphics/fx/filters/cascadedsharpen.hpp>
+#include <libgraphics/cancellation.hpp>
+#include <libgraphics/memorygovernor.hpp>
 
 namespace libgraphics {
 namespace fx {
 namespace filters {
 
-CascadedSharpen::CascadedSharpen( fxapi::ApiBackendDevice* _device ) : Filter( "CascadedSharpen", _device ), m_Threshold( 0.0f ), m_ShouldUpdateCascades( true ) {}
+CascadedSharpen::CascadedSharpen( fxapi::ApiBackendDevice* _device ) : Filter( "CascadedSharpen", _device ), m_Threshold( 0.0f ), m_ShouldUpdateCascades( true ),
+    m_BuffersInUse( false ), m_OverBudget( false ) {
+    MemoryGovernor::global().attach( this );
+}
+
+CascadedSharpen::~CascadedSharpen() {
+    MemoryGovernor::global().detach( this );
+}
 
 void CascadedSharpen::generateBlurBuffer(
-    size_t index, fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius
+    size_t index, fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius, const Rect32I& area
 ) {
     assert( width > 0 );
     assert( height > 0 );
@@ -33,6 +42,13 @@ void CascadedSharpen::generateBlurBuffer(
         );
     }
 
+    const size_t byteSize = width * height * libgraphics::fxapi::EPixelFormat::getPixelSize( format );
+
+    if( ( this->m_Cascades[index].buffer->byteSize() != byteSize ) && !MemoryGovernor::global().reserve( byteSize ) ) {
+        /** the render needs the buffer anyway, but it isn't kept **/
+        this->m_OverBudget = true;
+    }
+
     const auto successfullyResetted = this->m_Cascades[index].buffer->reset(
                                           format,
                                           width,
@@ -51,9 +67,10 @@ void CascadedSharpen::generateBlurBuffer(
         device,
         this->m_Cascades[index].buffer.get(),
         baseImage,
-        baseImage->size(),
+        area,
         blurRadius
     );
+    this->m_Cascades[index].area = area;
 }
 
 bool CascadedSharpen::process(
@@ -73,6 +90,11 @@ bool CascadedSharpen::process(
 void CascadedSharpen::generateCascades( const std::vector<float>& cascades,
                                         libgraphics::fxapi::ApiBackendDevice* backend,
                                         libgraphics::ImageLayer* baseImage ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
+    this->m_BuffersInUse    = true;
+    this->m_OverBudget      = false;
+
     this->setCascadeCount(
         cascades.size()
     );
@@ -89,10 +111,17 @@ void CascadedSharpen::generateCascades( const std::vector<float>& cascades,
             baseImage->format(),
             baseImage->width(),
             baseImage->height(),
-            this->m_Cascades[index].blurRadius
+            this->m_Cascades[index].blurRadius,
+            baseImage->size()
         );
         ++index;
     }
+
+    this->m_BuffersInUse = false;
+
+    if( this->m_OverBudget ) {
+        this->dropBuffers();
+    }
 }
 
 void CascadedSharpen::updateCascades() {
@@ -103,11 +132,59 @@ bool CascadedSharpen::process(
     fxapi::ApiBackendDevice*    device,
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
+) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool CascadedSharpen::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
 ) {
     assert( device != nullptr );
     assert( destination != nullptr );
     assert( source != nullptr );
 
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
+    this->m_BuffersInUse    = true;
+    this->m_OverBudget      = false;
+
+    const bool rendered = this->render(
+                              device,
+                              destination,
+                              source,
+                              area
+                          );
+
+    this->m_BuffersInUse = false;
+
+    if( this->m_OverBudget ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "CascadedSharpen::process(): Cascades exceed the memory budget, dropping them.";
+#endif
+        this->dropBuffers();
+    }
+
+    MemoryGovernor::global().touch( this );
+
+    return rendered;
+}
+
+bool CascadedSharpen::render(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
+) {
     std::vector< std::tuple<ImageLayer*, float, float> >  cascades;
     bool    didUpdateCascades( false );
 
@@ -123,11 +200,16 @@ bool CascadedSharpen::process(
                 incompatibleCascades = true;
             } else if( !currentCascadeBuffer->containsDataForBackend( device->backendId() ) ) {
                 incompatibleCascades = true;
+            } else if( !this->m_Cascades[i].area.contains( area ) ) {
+                /** blurred for a smaller region of interest */
+                incompatibleCascades = true;
             }
         } else {
             incompatibleCascades = true;
         }
 
+        const float blurRadius = this->m_Cascades[i].blurRadius * this->m_PixelScale;
+
         if( m_ShouldUpdateCascades || incompatibleCascades ) {
             this->generateBlurBuffer(
                 i,
@@ -136,13 +218,20 @@ bool CascadedSharpen::process(
                 source->format(),
                 source->width(),
                 source->height(),
-                this->m_Cascades[i].blurRadius
+                blurRadius,
+                area
             );
             didUpdateCascades = true;
+
+            if( libgraphics::isCurrentOperationCancelled() ) {
+                /** the blur buffer is incomplete, regenerate all cascades next time */
+                this->m_ShouldUpdateCascades = true;
+                return true;
+            }
         }
 
         cascades.push_back(
-            std::make_tuple( this->m_Cascades[i].buffer.get(), this->m_Cascades[i].blurRadius, this->m_Cascades[i].strength )
+            std::make_tuple( this->m_Cascades[i].buffer.get(), blurRadius, this->m_Cascades[i].strength )
         );
     }
 
@@ -154,7 +243,7 @@ bool CascadedSharpen::process(
         device,
         destination,
         source,
-        source->size(),
+        area,
         cascades,
         this->m_Threshold
     );
@@ -162,6 +251,89 @@ bool CascadedSharpen::process(
     return true;
 }
 
+int CascadedSharpen::haloRadius() const {
+    int halo( 0 );
+
+    for( auto it = this->m_Cascades.begin(); it != this->m_Cascades.end(); ++it ) {
+        halo = std::max( halo, libgraphics::fx::operations::gaussianBlurHalo( ( *it ).blurRadius * this->m_PixelScale ) );
+    }
+
+    return halo;
+}
+
+void CascadedSharpen::planBuffers(
+    BufferPlan&                 plan,
+    size_t                      stage,
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    size_t                      width,
+    size_t                      height
+) const {
+    for( size_t i = 0; this->m_Cascades.size() > i; ++i ) {
+        plan.addBuffer( "CascadedSharpen.Cascade" + std::to_string( i ), format, width, height, stage, stage );
+    }
+
+    plan.addBuffer( "CascadedSharpen.BlurTemporary", format, width, height, stage, stage );
+
+    /// cascadedSharpen_GEN renders cascade counts other than four,
+    /// the cpu backend composites integer formats per tile.
+    const bool compositedPerTile = ( device->backendId() == FXAPI_BACKEND_CPU ) && !fxapi::EPixelFormat::isFloatingPointFormat( format );
+
+    if( ( this->m_Cascades.size() != 4 ) && !compositedPerTile ) {
+        for( size_t i = 0; 7 > i; ++i ) {
+            plan.addBuffer( "CascadedSharpen.Intermediate" + std::to_string( i ), format, width, height, stage, stage );
+        }
+    }
+}
+
+void CascadedSharpen::releaseBuffers() {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
+    this->dropBuffers();
+}
+
+void CascadedSharpen::dropBuffers() {
+    for( auto it = this->m_Cascades.begin(); it != this->m_Cascades.end(); ++it ) {
+        ( *it ).buffer.reset();
+        ( *it ).area = Rect32I();
+    }
+}
+
+size_t CascadedSharpen::memoryUsage() const {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
+    size_t bytes( 0 );
+
+    for( auto it = this->m_Cascades.begin(); it != this->m_Cascades.end(); ++it ) {
+        if( ( *it ).buffer ) {
+            bytes += ( *it ).buffer->byteSize();
+        }
+    }
+
+    return bytes;
+}
+
+size_t CascadedSharpen::reclaim( size_t bytes ) {
+    ( void )bytes;
+
+    /** the cascades are in use while this or another thread renders,
+        the governor is called from there as well **/
+    std::unique_lock<std::recursive_mutex> lock( this->m_BufferMutex, std::try_to_lock );
+
+    if( !lock.owns_lock() || this->m_BuffersInUse ) {
+        return 0;
+    }
+
+    const size_t released = this->memoryUsage();
+    this->dropBuffers();
+
+    return released;
+}
+
+bool CascadedSharpen::acceptsMonochrome() const {
+    return true;
+}
+
 void CascadedSharpen::setThreshold( float threshold ) {
     this->m_Threshold = threshold;
 }
@@ -234,7 +406,7 @@ bool CascadedSharpen::fromPreset( const FilterPreset& preset ) {
             const auto itRadius = preset.floats().find( valRadius );
 
             if( itRadius != preset.floats().end() ) {
-                this->m_Cascades[i].blurRadius = ( *itRadius ).second.value;
+                this->setCascadeBlurRadius( i, ( *itRadius ).second.value );
             } else {
                 break;
             }
@@ -294,6 +466,8 @@ const float& CascadedSharpen::cascadeBlurRadius( size_t index ) const {
 }
 
 void CascadedSharpen::deleteBlurBuffersForBackend( int backendId ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
     for( auto it = this->m_Cascades.begin(); it != this->m_Cascades.end(); ++it ) {
         if( ( *it ).buffer ) {
             ( *it ).buffer->deleteDataForBackend( backendId );
@@ -311,6 +485,8 @@ void CascadedSharpen::setCascadeBlurBuffer( size_t index, libgraphics::fxapi::EP
                                       );
     assert( successfullyResetted );
 
+    this->m_Cascades[index].area = Rect32I( ( int )width, ( int )height );
+
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
 
     if( !successfullyResetted ) {
@@ -324,6 +500,7 @@ void CascadedSharpen::setCascadeBlurBuffer( size_t index, const std::shared_ptr<
     assert( this->m_Cascades.size() > index );
 
     this->m_Cascades[index].buffer = buffer;
+    this->m_Cascades[index].area = buffer ? buffer->size() : Rect32I();
 }
 
 const std::shared_ptr<libgraphics::ImageLayer>& CascadedSharpen::cascadeBlurBuffer( size_t index ) {
@@ -1,6 +1,7 @@
 
 #include <libgraphics/fx/filters/curves.hpp>
 #include <libgraphics/fx/operations/basic.hpp>
+#include <libgraphics/fx/operations/complex.hpp>
 #include <sstream>
 
 #include <QDebug>
@@ -23,9 +24,25 @@ bool Curves::process(
 }
 
 bool Curves::process(
-    fxapi::ApiBackendDevice*    /*device*/,
+    fxapi::ApiBackendDevice*    device,
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
+) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool Curves::process(
+    fxapi::ApiBackendDevice*    /*device*/,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
 ) {
     // assert(device);
     assert( destination );
@@ -47,7 +64,7 @@ bool Curves::process(
     libgraphics::fx::operations::adjustBrightness(
         destination,
         source,
-        source->size(),
+        area,
         this->m_CurveData.data(),
         this->m_CurveData.size()
     );
@@ -55,6 +72,30 @@ bool Curves::process(
     return true;
 }
 
+std::shared_ptr<const PointOperation> Curves::pointOperation( fxapi::EPixelFormat::t format ) {
+    const size_t pixelMax = libgraphics::fxapi::EPixelFormat::getPixelMax( format );
+
+    if( this->m_CurvePoints.empty() ) {
+        return std::shared_ptr<const PointOperation>();
+    }
+
+    if( this->m_ModifiedCurve || ( this->m_CurveData.size() != ( pixelMax + 1 ) ) ) {
+        this->m_ModifiedCurve = true; /** ensure its actually set to true **/
+        this->updateCurveData(
+            pixelMax + 1
+        );
+    }
+
+    return libgraphics::fx::operations::makeCurvePointOperation(
+               this->m_CurveData.data(),
+               this->m_CurveData.size()
+           );
+}
+
+bool Curves::acceptsMonochrome() const {
+    return true;
+}
+
 
 FilterPreset Curves::toPreset() const {
     FilterPreset preset;
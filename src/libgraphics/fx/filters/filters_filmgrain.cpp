@@ -4,13 +4,23 @@
 #include <libgraphics/fx/operations/complex.hpp>
 #include <libgraphics/fx/filters/filmgrain.hpp>
 #include <libgraphics/bezier.hpp>
+#include <libgraphics/cancellation.hpp>
+#include <libgraphics/memorygovernor.hpp>
+#include <libgraphics/scratchlayerpool.hpp>
 #include <sstream>
 
 namespace libgraphics {
 namespace fx {
 namespace filters {
 
-FilmGrain::FilmGrain( fxapi::ApiBackendDevice* _device ) : Filter( "FilmGrain", _device ), m_ModifiedCurve( true ), m_MonoGrain( true ), m_GrainBlurRadius( 1.0f ) {}
+FilmGrain::FilmGrain( fxapi::ApiBackendDevice* _device ) : Filter( "FilmGrain", _device ), m_ModifiedCurve( true ), m_MonoGrain( true ), m_GrainBlurRadius( 1.0f ), m_GrainSeed( 0x6d2b79f5 ),
+    m_BuffersInUse( false ), m_OverBudget( false ) {
+    MemoryGovernor::global().attach( this );
+}
+
+FilmGrain::~FilmGrain() {
+    MemoryGovernor::global().detach( this );
+}
 
 bool FilmGrain::process(
     libgraphics::ImageLayer*    destination,
@@ -28,6 +38,54 @@ bool FilmGrain::process(
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
 ) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool FilmGrain::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
+) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
+    this->m_BuffersInUse    = true;
+    this->m_OverBudget      = false;
+
+    const bool rendered = this->render(
+                              device,
+                              destination,
+                              source,
+                              area
+                          );
+
+    this->m_BuffersInUse = false;
+
+    if( this->m_OverBudget ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "FilmGrain::process(): Grain exceeds the memory budget, dropping it.";
+#endif
+        this->resetGrain();
+    }
+
+    MemoryGovernor::global().touch( this );
+
+    return rendered;
+}
+
+bool FilmGrain::render(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
+) {
 
     assert( device != nullptr );
     assert( destination != nullptr );
@@ -103,6 +161,15 @@ bool FilmGrain::process(
         }
     }
 
+    if( !isCompatibleGrainImage ) {
+        isCompatibleGrainImage = this->convertGrain(
+                                     device,
+                                     pfFormat,
+                                     destination->width(),
+                                     destination->height()
+                                 );
+    }
+
     if( !isCompatibleGrainImage ) {
         this->resetGrain(
             device,
@@ -112,32 +179,35 @@ bool FilmGrain::process(
         );
     }
 
-    std::unique_ptr<ImageLayer> blurredGrainLayer( makeImageLayer( device, destination ) );
+    libgraphics::ScopedScratchLayer blurredGrainLayer( device, destination );
+    const float grainBlurRadius = this->m_GrainBlurRadius * this->m_PixelScale;
 
-    if( ( ( this->m_GrainBlurRadius >= 0.05f ) ) ||
-            ( ( this->m_GrainBlurRadius >= 0.05f ) && !isCompatibleGrainImage ) ) {
+    if( grainBlurRadius >= 0.05f ) {
         libgraphics::fx::operations::gaussianBlur(
             device,
             blurredGrainLayer.get(),
             this->m_GrainLayer.get(),
-            this->m_GrainLayer->size(),
-            this->m_GrainBlurRadius
+            area,
+            grainBlurRadius
         );
     } else {
         libgraphics::fx::operations::blit(
             blurredGrainLayer.get(),
             m_GrainLayer.get(),
-            m_GrainLayer->size(),
-            m_GrainLayer->size()
+            area,
+            area
         );
     }
 
+    if( libgraphics::isCurrentOperationCancelled() ) {
+        return true;
+    }
 
     libgraphics::fx::operations::filmgrain(
         device,
         destination,
         source,
-        source->size(),
+        area,
         blurredGrainLayer.get(),
         this->m_CurveData,
         this->m_MonoGrain
@@ -146,6 +216,57 @@ bool FilmGrain::process(
     return true;
 }
 
+void FilmGrain::planBuffers(
+    BufferPlan&                 plan,
+    size_t                      stage,
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    size_t                      width,
+    size_t                      height
+) const {
+    ( void )device;
+
+    plan.addBuffer( "FilmGrain.Grain", format, width, height, stage, stage );
+    plan.addBuffer( "FilmGrain.BlurredGrain", format, width, height, stage, stage );
+
+    if( ( this->m_GrainBlurRadius * this->m_PixelScale ) >= 0.05f ) {
+        plan.addBuffer( "FilmGrain.BlurTemporary", format, width, height, stage, stage );
+    }
+}
+
+void FilmGrain::releaseBuffers() {
+    /** the grain is generated from a fixed seed, the next render
+        gets the same grain again **/
+    this->resetGrain();
+}
+
+bool FilmGrain::acceptsMonochrome() const {
+    return true;
+}
+
+size_t FilmGrain::memoryUsage() const {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
+    return this->m_GrainLayer ? this->m_GrainLayer->byteSize() : 0;
+}
+
+size_t FilmGrain::reclaim( size_t bytes ) {
+    ( void )bytes;
+
+    /** the grain is in use while this or another thread renders,
+        the governor is called from there as well **/
+    std::unique_lock<std::recursive_mutex> lock( this->m_BufferMutex, std::try_to_lock );
+
+    if( !lock.owns_lock() || this->m_BuffersInUse ) {
+        return 0;
+    }
+
+    const size_t released = this->memoryUsage();
+    this->resetGrain();
+
+    return released;
+}
+
 FilterPreset FilmGrain::toPreset() const {
     FilterPreset preset;
 
@@ -232,20 +353,35 @@ bool FilmGrain::fromPreset( const FilterPreset& preset ) {
     return success;
 }
 
-/// random number generator
+/// random number generator, the value of a sample only depends
+/// on the seed and the index of the sample. a regenerated grain
+/// image is identical to the previous one.
+inline unsigned int grain_hash( unsigned int seed, size_t index ) {
+    unsigned long long x = ( ( unsigned long long )seed << 32 ) ^ ( unsigned long long )index;
+
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return ( unsigned int )( x >> 32 );
+}
 template < class _t_any >
 struct rgen {
     typedef _t_any  ValueType;
 
     rgen(
+        unsigned int _seed,
         const ValueType& _min,
         const ValueType& _max
-    ) : min( _min ), max( _max ), range( _max - _min ) { assert( _max > _min ); }
+    ) : seed( _seed ), min( _min ), max( _max ), range( _max - _min ) { assert( _max > _min ); }
 
-    inline ValueType gen() const {
-        return ( ::rand() % range ) + min;
+    inline ValueType gen( size_t index ) const {
+        return ( ValueType )( grain_hash( seed, index ) % ( unsigned int )range ) + min;
     }
 
+    const unsigned int  seed;
     const ValueType     min;
     const ValueType     max;
     const ValueType     range;
@@ -256,15 +392,17 @@ struct rgen<float> {
     typedef unsigned int    RandomBaseType;
 
     rgen(
+        unsigned int _seed,
         const RandomBaseType& _min,
         const RandomBaseType& _max
-    ) : min( _min ), max( _max ), range( _max - _min ) { assert( _max > _min ); }
+    ) : seed( _seed ), min( _min ), max( _max ), range( _max - _min ) { assert( _max > _min ); }
 
-    inline ValueType gen() const {
-        const auto randomVal = ( ::rand() % range );
+    inline ValueType gen( size_t index ) const {
+        const auto randomVal = ( grain_hash( seed, index ) % range );
         return ( ( float )randomVal / ( float )range );
     }
 
+    const unsigned int       seed;
     const RandomBaseType     min;
     const RandomBaseType     max;
     const RandomBaseType     range;
@@ -283,10 +421,11 @@ struct grain_render {
         bool monoGrain
     ) {
         if( monoGrain ) {
-            for( size_t x = 0; grainWidth > x; ++x ) {
-                for( size_t y = 0; grainHeight > y; ++y ) {
-                    ValueType* currentPixel     = ( ( ValueType* )data + ( ( ( y * grainWidth ) + x ) * channelCount ) );
-                    const auto randomValue      = rgen.gen();
+            for( size_t y = 0; grainHeight > y; ++y ) {
+                for( size_t x = 0; grainWidth > x; ++x ) {
+                    const size_t pixelIndex     = ( y * grainWidth ) + x;
+                    ValueType* currentPixel     = ( ( ValueType* )data + ( pixelIndex * channelCount ) );
+                    const auto randomValue      = rgen.gen( pixelIndex );
 
                     for( size_t i = 0; channelCount > i; ++i ) {
                         *( currentPixel + i ) = randomValue;
@@ -294,12 +433,13 @@ struct grain_render {
                 }
             }
         } else {
-            for( size_t x = 0; grainWidth > x; ++x ) {
-                for( size_t y = 0; grainHeight > y; ++y ) {
-                    ValueType* currentPixel     = ( ( ValueType* )data + ( ( ( y * grainWidth ) + x ) * channelCount ) );
+            for( size_t y = 0; grainHeight > y; ++y ) {
+                for( size_t x = 0; grainWidth > x; ++x ) {
+                    const size_t pixelIndex     = ( y * grainWidth ) + x;
+                    ValueType* currentPixel     = ( ( ValueType* )data + ( pixelIndex * channelCount ) );
 
                     for( size_t i = 0; channelCount > i; ++i ) {
-                        const auto randomValue  = rgen.gen();
+                        const auto randomValue  = rgen.gen( ( pixelIndex * channelCount ) + i );
                         *( currentPixel + i ) = randomValue;
                     }
                 }
@@ -369,6 +509,7 @@ void FilmGrain::calculateGrainImage() {
 
         if( isFloatingPointFormat ) {
             const rgen_float rgen(
+                this->m_GrainSeed,
                 fxapi::EPixelFormat::getPixelMin( fxapi::EPixelFormat::RGB16 ),
                 fxapi::EPixelFormat::getPixelMax( fxapi::EPixelFormat::RGB16 )
             );
@@ -386,6 +527,7 @@ void FilmGrain::calculateGrainImage() {
             );
         } else {
             const rgen_int rgen(
+                this->m_GrainSeed,
                 fxapi::EPixelFormat::getPixelMin( grainFormat ),
                 fxapi::EPixelFormat::getPixelMax( grainFormat )
             );
@@ -491,8 +633,17 @@ bool FilmGrain::loadGrainFromData(
         return false;
     }
 
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
     resetGrain();
 
+    if( !MemoryGovernor::global().reserve( width * height * fxapi::EPixelFormat::getPixelSize( format ) ) ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "FilmGrain::loadGrainFromData(): Grain exceeds the memory budget.";
+#endif
+        return false;
+    }
+
     this->m_GrainLayer.reset(
         makeImageLayer(
             device,
@@ -509,6 +660,8 @@ bool FilmGrain::loadGrainFromData(
 }
 
 void FilmGrain::resetGrain() {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
     this->m_GrainLayer.reset();
 }
 
@@ -527,6 +680,11 @@ void FilmGrain::resetGrain(
 
     resetGrain();
 
+    if( !MemoryGovernor::global().reserve( width * height * fxapi::EPixelFormat::getPixelSize( format ) ) ) {
+        /** the render needs the grain anyway, but it isn't kept **/
+        this->m_OverBudget = true;
+    }
+
     this->m_GrainLayer.reset(
         makeImageLayer(
             device,
@@ -549,6 +707,69 @@ void FilmGrain::resetGrain(
     return;
 }
 
+bool FilmGrain::convertGrain(
+    fxapi::ApiBackendDevice* device,
+    fxapi::EPixelFormat::t format,
+    size_t width,
+    size_t height
+) {
+    assert( device != nullptr );
+
+    if( !this->m_GrainLayer || this->m_GrainLayer->empty() || ( device->backendId() != FXAPI_BACKEND_CPU ) ) {
+        return false;
+    }
+
+    if( ( ( size_t )this->m_GrainLayer->width() != width ) || ( ( size_t )this->m_GrainLayer->height() != height ) ||
+            !this->m_GrainLayer->containsDataForDevice( device ) ) {
+        return false;
+    }
+
+    /** a color grain is packed into the single channel working
+        format, only mono grain can be expanded again **/
+    const fxapi::EPixelFormat::t grainFormat = this->m_GrainLayer->format();
+    const bool pack     = ( fxapi::EPixelFormat::getChannelCount( grainFormat ) >= 3 ) &&
+                          ( fxapi::EPixelFormat::getAssociatedMonoFormat( grainFormat ) == format );
+    const bool expand   = this->m_MonoGrain && ( fxapi::EPixelFormat::getChannelCount( grainFormat ) == 1 ) &&
+                          ( fxapi::EPixelFormat::getAssociatedMonoFormat( format ) == grainFormat );
+
+    if( !pack && !expand ) {
+        return false;
+    }
+
+    if( !MemoryGovernor::global().reserve( width * height * fxapi::EPixelFormat::getPixelSize( format ) ) ) {
+        this->m_OverBudget = true;
+    }
+
+    std::unique_ptr<libgraphics::ImageLayer> convertedGrain(
+        makeImageLayer(
+            device,
+            "default",
+            format,
+            width,
+            height
+        )
+    );
+    assert( convertedGrain.get() != nullptr );
+
+    if( pack ) {
+        libgraphics::fx::operations::packMonochrome(
+            convertedGrain.get(),
+            this->m_GrainLayer.get(),
+            convertedGrain->size()
+        );
+    } else {
+        libgraphics::fx::operations::expandMonochrome(
+            convertedGrain.get(),
+            this->m_GrainLayer.get(),
+            convertedGrain->size()
+        );
+    }
+
+    this->m_GrainLayer = std::move( convertedGrain );
+
+    return true;
+}
+
 std::unique_ptr<libgraphics::ImageLayer>&  FilmGrain::grainLayer() {
     return this->m_GrainLayer;
 }
@@ -692,7 +913,20 @@ void FilmGrain::setGrainBlurRadius( float radius ) {
     this->m_GrainBlurRadius = radius;
 }
 
+unsigned int FilmGrain::grainSeed() const {
+    return this->m_GrainSeed;
+}
+
+void FilmGrain::setGrainSeed( unsigned int seed ) {
+    if( this->m_GrainSeed != seed ) {
+        this->m_GrainSeed = seed;
+        this->resetGrain();
+    }
+}
+
 void FilmGrain::deleteGrainForBackend( int backendId ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_BufferMutex );
+
     if( this->m_GrainLayer ) {
         this->m_GrainLayer->deleteDataForBackend( backendId );
 
@@ -713,6 +947,7 @@ Filter* FilmGrain::clone() {
     clonedFilter->m_ModifiedCurve   = true;
     clonedFilter->m_GrainBlurRadius = m_GrainBlurRadius;
     clonedFilter->m_MonoGrain = m_MonoGrain;
+    clonedFilter->m_GrainSeed = m_GrainSeed;
 
     return ( Filter* )clonedFilter;
 }
@@ -26,6 +26,22 @@ bool SplitTone::process(
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
 ) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool SplitTone::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
+) {
 
     assert( device != nullptr );
     assert( destination != nullptr );
@@ -56,7 +72,7 @@ bool SplitTone::process(
         device,
         destination,
         source,
-        source->size(),
+        area,
         this->m_Highlights.Values[0],
         this->m_Highlights.Values[1],
         this->m_Highlights.Values[2],
@@ -69,6 +85,20 @@ bool SplitTone::process(
     return true;
 }
 
+std::shared_ptr<const PointOperation> SplitTone::pointOperation( fxapi::EPixelFormat::t format ) {
+    ( void )format;
+
+    return libgraphics::fx::operations::makeSplittonePointOperation(
+               this->m_Highlights.Values[0],
+               this->m_Highlights.Values[1],
+               this->m_Highlights.Values[2],
+               this->m_Shadows.Values[0],
+               this->m_Shadows.Values[1],
+               this->m_Shadows.Values[2],
+               this->m_Balance
+           );
+}
+
 FilterPreset SplitTone::toPreset() const {
     FilterPreset preset;
 
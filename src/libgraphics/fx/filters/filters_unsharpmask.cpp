@@ -4,6 +4,7 @@
 #include <libgraphics/fx/filters/unsharpmask.hpp>
 #include <libgraphics/fx/operations/basic.hpp>
 #include <libgraphics/fx/operations/complex.hpp>
+#include <libgraphics/scratchlayerpool.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -26,7 +27,7 @@ bool UnsharpMask::process(
 }
 
 void UnsharpMask::generateBlurBuffer(
-    fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius
+    fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius, const Rect32I& area
 ) {
     assert( width > 0 );
     assert( height > 0 );
@@ -59,7 +60,7 @@ void UnsharpMask::generateBlurBuffer(
         device,
         this->m_BlurBuffer.get(),
         baseImage,
-        baseImage->size(),
+        area,
         blurRadius
     );
 }
@@ -68,6 +69,22 @@ bool UnsharpMask::process(
     fxapi::ApiBackendDevice*    device,
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
+) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool UnsharpMask::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
 ) {
     assert( device );
     assert( destination );
@@ -100,7 +117,8 @@ bool UnsharpMask::process(
         destination->format(),
         destination->width(),
         destination->height(),
-        this->m_BlurRadius
+        this->m_BlurRadius * this->m_PixelScale,
+        area
     );
 
     assert( !this->m_BlurBuffer.empty() );
@@ -113,25 +131,17 @@ bool UnsharpMask::process(
     }
 
     /// run the filter
-    std::unique_ptr<libgraphics::ImageLayer>   baseLayer(
-        new libgraphics::ImageLayer(
-            device
-        )
-    );
-    std::unique_ptr<libgraphics::ImageLayer>   sharpMask(
-        new libgraphics::ImageLayer(
-            device
-        )
-    );
+    libgraphics::ScopedScratchLayer    baseLayer( device, destination );
+    libgraphics::ScopedScratchLayer    sharpMask( device, destination );
 
-    if( !baseLayer->reset( destination->format(), destination->width(), destination->height() ) ) {
+    if( baseLayer.empty() ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
         qDebug() << "Failed to create base image layer.";
 #endif
         return false;
     }
 
-    if( !sharpMask->reset( destination->format(), destination->width(), destination->height() ) ) {
+    if( sharpMask.empty() ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
         qDebug() << "Failed to create intermediate destination image layer.";
 #endif
@@ -142,24 +152,52 @@ bool UnsharpMask::process(
         sharpMask.get(),
         this->m_BlurBuffer.get(),
         source,
-        baseLayer->size()
+        area
     );
     libgraphics::fx::operations::multiply(
         baseLayer.get(),
         sharpMask.get(),
-        sharpMask->size(),
+        area,
         this->m_Strength
     );
     libgraphics::fx::operations::subtract(
         destination,
         source,
         baseLayer.get(),
-        source->size()
+        area
     );
 
     return true;
 }
 
+int UnsharpMask::haloRadius() const {
+    return libgraphics::fx::operations::gaussianBlurHalo( this->m_BlurRadius * this->m_PixelScale );
+}
+
+void UnsharpMask::planBuffers(
+    BufferPlan&                 plan,
+    size_t                      stage,
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    size_t                      width,
+    size_t                      height
+) const {
+    ( void )device;
+
+    plan.addBuffer( "UnsharpMask.BlurBuffer", format, width, height, stage, stage );
+    plan.addBuffer( "UnsharpMask.BlurTemporary", format, width, height, stage, stage );
+    plan.addBuffer( "UnsharpMask.SharpMask", format, width, height, stage, stage );
+    plan.addBuffer( "UnsharpMask.BaseLayer", format, width, height, stage, stage );
+}
+
+void UnsharpMask::releaseBuffers() {
+    this->m_BlurBuffer.reset();
+}
+
+bool UnsharpMask::acceptsMonochrome() const {
+    return true;
+}
+
 FilterPreset UnsharpMask::toPreset() const {
     FilterPreset preset;
 
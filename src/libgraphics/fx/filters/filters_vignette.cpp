@@ -28,6 +28,22 @@ bool Vignette::process(
     fxapi::ApiBackendDevice*    device,
     libgraphics::ImageLayer*    destination,
     libgraphics::ImageLayer*    source
+) {
+    assert( source != nullptr );
+
+    return this->process(
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool Vignette::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
 ) {
     assert( device != nullptr );
     assert( destination != nullptr );
@@ -58,7 +74,7 @@ bool Vignette::process(
         device,
         destination,
         source,
-        source->size(),
+        area,
         this->center(),
         this->radius(),
         this->strength()
@@ -67,6 +83,20 @@ bool Vignette::process(
     return true;
 }
 
+std::shared_ptr<const PointOperation> Vignette::pointOperation( fxapi::EPixelFormat::t format ) {
+    ( void )format;
+
+    return libgraphics::fx::operations::makeVignettePointOperation(
+               this->center(),
+               this->radius(),
+               this->strength()
+           );
+}
+
+bool Vignette::acceptsMonochrome() const {
+    return true;
+}
+
 
 FilterPreset Vignette::toPreset() const {
     FilterPreset preset;
@@ -20,6 +20,25 @@ class UnsharpMask : public libgraphics::Filter {
             libgraphics::ImageLayer*    destination,
             libgraphics::ImageLayer*    source
         );
+        virtual bool process(
+            fxapi::ApiBackendDevice*    device,
+            libgraphics::ImageLayer*    destination,
+            libgraphics::ImageLayer*    source,
+            const Rect32I&              area
+        );
+
+        virtual int haloRadius() const;
+
+        virtual void planBuffers(
+            BufferPlan&                 plan,
+            size_t                      stage,
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            size_t                      width,
+            size_t                      height
+        ) const;
+        virtual void releaseBuffers();
+        virtual bool acceptsMonochrome() const;
 
         virtual FilterPreset toPreset() const;
         virtual bool fromPreset( const FilterPreset& preset );
@@ -39,7 +58,7 @@ class UnsharpMask : public libgraphics::Filter {
         virtual Filter* clone();
     protected:
         void generateBlurBuffer(
-            fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius
+            fxapi::ApiBackendDevice* device, libgraphics::ImageLayer* baseImage, const libgraphics::fxapi::EPixelFormat::t format, size_t width, size_t height, const float& blurRadius, const Rect32I& area
         );
 
         std::shared_ptr<libgraphics::ImageLayer>   m_BlurBuffer;
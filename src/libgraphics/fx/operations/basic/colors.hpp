@@ -51,6 +51,26 @@ void convertToMonochrome(
     float* darkColorFactors
 );
 
+/**
+ *  copies the first channel of a gray rgb image into
+ *  a single channel image of the same channel type.
+ */
+void packMonochrome(
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area
+);
+
+/**
+ *  writes a single channel image to all color channels
+ *  of the destination. alpha channels are set to opaque.
+ */
+void expandMonochrome(
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area
+);
+
 }
 }
 }
@@ -44,6 +44,22 @@ void convertToMonochrome_CPU(
     Rect32I area
 );
 
+/// operation: packMonochrome
+void packMonochrome_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area
+);
+
+/// operation: expandMonochrome
+void expandMonochrome_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area
+);
+
 }
 }
 }
@@ -64,7 +64,7 @@ void adjustBrightness(
         adjustBrightness_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             values,
             length
@@ -72,11 +72,11 @@ void adjustBrightness(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         adjustBrightness_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             values,
             length
@@ -105,18 +105,18 @@ void adjustBrightness(
         adjustBrightness_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             value
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         adjustBrightness_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             value
         );
@@ -1,6 +1,7 @@
 #include <libgraphics/fx/operations/basic/colors/gl.hpp>
 #include <libgraphics/fx/operations/basic/colors/cpu.hpp>
 #include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_lut.hpp>
 
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
@@ -107,6 +108,88 @@ void kernel_curve_adjustment(
 
 }
 
+template < class _t_pixel_type >
+struct kernel_curve_lookup_pack {
+    explicit kernel_curve_lookup_pack( const std::shared_ptr<const PixelLookupTable<_t_pixel_type> >& _table ) :
+        table( _table ) {}
+
+    std::shared_ptr<const PixelLookupTable<_t_pixel_type> > table;
+};
+
+/// integer formats gather the pre-quantised result
+/// from the baked curve table.
+template < class _t_pixel_type >
+void kernel_curve_lookup(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_curve_lookup_pack<_t_pixel_type>& params
+) {
+    ( void )device;
+
+    const _t_pixel_type* values = params.table->entry( 0 );
+
+    const size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
+                                    destination->format()
+                                );
+    const size_t rowLength = ( size_t )area.width * channelCount;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + area.x ) * channelCount );
+        const _t_pixel_type* srcRow = ( const _t_pixel_type* )source->data() + ( ( ( size_t )y * source->width() + area.x ) * channelCount );
+
+        for( size_t n = 0; rowLength > n; ++n ) {
+            dstRow[n] = values[srcRow[n]];
+        }
+    }
+}
+
+template < class _t_pixel_type >
+void executeCurveAdjustment(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject*     destination,
+    libgraphics::fxapi::ApiImageObject*     source,
+    libgraphics::Rect32I   area,
+    float* curveData,
+    size_t curveLength
+) {
+    assert( std::numeric_limits<_t_pixel_type>::max() <= curveLength );
+
+    if( curveLength >= PixelLookupTable<_t_pixel_type>::Length ) {
+        fx::operations::cpuExecuteTileBased(
+            device,
+            ( backend::cpu::ImageObject* )destination,
+            ( backend::cpu::ImageObject* )source,
+            area,
+            std::bind(
+                &kernel_curve_lookup<_t_pixel_type>,
+                std::placeholders::_1,
+                std::placeholders::_2,
+                std::placeholders::_3,
+                std::placeholders::_4,
+                kernel_curve_lookup_pack<_t_pixel_type>( curveLookupTable<_t_pixel_type>( curveData, curveLength ) )
+            )
+        );
+        return;
+    }
+
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )destination,
+        ( backend::cpu::ImageObject* )source,
+        area,
+        std::bind(
+            &kernel_curve_adjustment<_t_pixel_type>,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            kernel_curve_adjustment_pack( curveData, curveLength )
+        )
+    );
+}
+
 /** impl: curve based **/
 void adjustBrightness_CPU(
     libgraphics::fxapi::ApiBackendDevice* device,
@@ -120,117 +203,15 @@ void adjustBrightness_CPU(
 
     switch( destination->format() ) {
         case fxapi::EPixelFormat::Mono8:
-            assert( std::numeric_limits<unsigned char>::max() <= curveLength );
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_curve_adjustment<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_curve_adjustment_pack( curveData, curveLength )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::Mono16:
-            assert( std::numeric_limits<unsigned short>::max() <= curveLength );
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_curve_adjustment<unsigned short>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_curve_adjustment_pack( curveData, curveLength )
-                )
-            );
-
         case fxapi::EPixelFormat::RGB8:
-            assert( std::numeric_limits<unsigned char>::max() <= curveLength );
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_curve_adjustment<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_curve_adjustment_pack( curveData, curveLength )
-                )
-            );
-
-            break;
-
-        case fxapi::EPixelFormat::RGB16:
-            assert( std::numeric_limits<unsigned short>::max() <= curveLength );
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_curve_adjustment<unsigned short>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_curve_adjustment_pack( curveData, curveLength )
-                )
-            );
-            break;
-
         case fxapi::EPixelFormat::RGBA8:
-            assert( std::numeric_limits<unsigned char>::max() <= curveLength );
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_curve_adjustment<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_curve_adjustment_pack( curveData, curveLength )
-                )
-            );
+            executeCurveAdjustment<unsigned char>( device, destination, source, area, curveData, curveLength );
             break;
 
+        case fxapi::EPixelFormat::Mono16:
+        case fxapi::EPixelFormat::RGB16:
         case fxapi::EPixelFormat::RGBA16:
-            assert( std::numeric_limits<unsigned short>::max() <= curveLength );
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_curve_adjustment<unsigned short>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_curve_adjustment_pack( curveData, curveLength )
-                )
-            );
+            executeCurveAdjustment<unsigned short>( device, destination, source, area, curveData, curveLength );
             break;
 
         default:
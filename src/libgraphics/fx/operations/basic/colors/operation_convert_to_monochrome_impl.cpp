@@ -24,20 +24,20 @@ void convertToMonochrome(
         convertToMonochrome_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         assert( false );
         convertToMonochrome_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -77,7 +77,7 @@ void convertToMonochrome(
         convertToMonochrome_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             channelFactors
         );
@@ -85,11 +85,11 @@ void convertToMonochrome(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         convertToMonochrome_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             channelFactors
         );
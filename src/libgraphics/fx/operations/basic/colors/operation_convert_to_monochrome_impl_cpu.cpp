@@ -300,6 +300,7 @@ void convertToMonochrome_CPU(
                     kernel_to_monochrome_pack( channelFactors )
                 )
             );
+            break;
 
         case fxapi::EPixelFormat::RGB8:
             fx::operations::cpuExecuteTileBased(
@@ -0,0 +1,86 @@
+#include <libgraphics/fx/operations/basic/colors/cpu.hpp>
+
+#include <QDebug>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+void packMonochrome(
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area
+) {
+    assert( dst );
+    assert( src );
+    assert( dst->width() >= area.width + area.x );
+    assert( dst->height() >= area.height + area.y );
+
+    if( !dst || !src ) {
+        return;
+    }
+
+    bool rendered( false );
+
+    /** the single channel working format is cpu only **/
+    if( dst->containsDataForBackend( FXAPI_BACKEND_CPU ) && src->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+        packMonochrome_CPU(
+            dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
+            dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            area
+        );
+
+        rendered = true;
+    }
+
+    assert( rendered );
+#if LIBGRAPHICS_DEBUG_OUTPUT
+
+    if( !rendered ) {
+        qDebug() << "packMonochrome(): Failed to apply operation to ImageLayer.";
+    }
+
+#endif
+}
+
+void expandMonochrome(
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area
+) {
+    assert( dst );
+    assert( src );
+    assert( dst->width() >= area.width + area.x );
+    assert( dst->height() >= area.height + area.y );
+
+    if( !dst || !src ) {
+        return;
+    }
+
+    bool rendered( false );
+
+    if( dst->containsDataForBackend( FXAPI_BACKEND_CPU ) && src->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+        expandMonochrome_CPU(
+            dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
+            dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            area
+        );
+
+        rendered = true;
+    }
+
+    assert( rendered );
+#if LIBGRAPHICS_DEBUG_OUTPUT
+
+    if( !rendered ) {
+        qDebug() << "expandMonochrome(): Failed to apply operation to ImageLayer.";
+    }
+
+#endif
+}
+
+}
+}
+}
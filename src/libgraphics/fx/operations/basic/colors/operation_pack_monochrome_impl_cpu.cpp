@@ -0,0 +1,169 @@
+#include <libgraphics/fx/operations/basic/colors/cpu.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+
+#include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
+#include <libgraphics/backend/cpu/cpu_imageobject.hpp>
+
+#include <QDebug>
+
+#include <limits>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+/// value of an opaque alpha channel
+template < class _t_pixel_type >
+inline _t_pixel_type opaqueValue() {
+    return std::numeric_limits<_t_pixel_type>::max();
+}
+template <>
+inline float opaqueValue<float>() {
+    return 1.0f;
+}
+
+/// copies the first channel of each source pixel
+template < class _t_pixel_type >
+void kernel_pack_monochrome(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area
+) {
+    ( void )device;
+
+    const size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
+                                    source->format()
+                                );
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* __restrict dstRow = ( _t_pixel_type* )destination->data() + ( ( size_t )y * destination->width() + area.x );
+        const _t_pixel_type* __restrict srcRow = ( const _t_pixel_type* )source->data() + ( ( size_t )y * source->width() + area.x ) * channelCount;
+
+        for( size_t x = 0; ( size_t )area.width > x; ++x, srcRow += channelCount ) {
+            dstRow[x] = *srcRow;
+        }
+    }
+}
+
+/// writes each source pixel to all color channels
+template < class _t_pixel_type >
+void kernel_expand_monochrome(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area
+) {
+    ( void )device;
+
+    const size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
+                                    destination->format()
+                                );
+    const _t_pixel_type opaque = opaqueValue<_t_pixel_type>();
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* __restrict dstRow = ( _t_pixel_type* )destination->data() + ( ( size_t )y * destination->width() + area.x ) * channelCount;
+        const _t_pixel_type* __restrict srcRow = ( const _t_pixel_type* )source->data() + ( ( size_t )y * source->width() + area.x );
+
+        for( size_t x = 0; ( size_t )area.width > x; ++x, dstRow += channelCount ) {
+            GetR( dstRow ) = srcRow[x];
+            GetG( dstRow ) = srcRow[x];
+            GetB( dstRow ) = srcRow[x];
+
+            if( channelCount > 3 ) {
+                dstRow[3] = opaque;
+            }
+        }
+    }
+}
+
+template < class _t_pixel_type >
+void executeMonochromeConversion(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area,
+    bool pack
+) {
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )dst,
+        ( backend::cpu::ImageObject* )src,
+        area,
+        pack ? &kernel_pack_monochrome<_t_pixel_type> : &kernel_expand_monochrome<_t_pixel_type>,
+        backend::cpu::TileHints( pack ? src->format() : dst->format(), 2 )
+    );
+}
+
+/// dispatches on the channel type of the rgb layer
+void executeMonochromeConversion(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area,
+    bool pack
+) {
+    assert( device != nullptr );
+    assert( dst != nullptr );
+    assert( src != nullptr );
+
+    const auto colorFormat  = pack ? src->format() : dst->format();
+    const auto monoFormat   = pack ? dst->format() : src->format();
+
+    assert( fxapi::EPixelFormat::getChannelCount( colorFormat ) >= 3 );
+    assert( fxapi::EPixelFormat::getAssociatedMonoFormat( colorFormat ) == monoFormat );
+
+    if( fxapi::EPixelFormat::getChannelCount( colorFormat ) < 3 ) {
+        throw std::runtime_error(
+            "Error: unknown or incompatible pixel format!"
+        );
+    }
+
+    switch( monoFormat ) {
+        case fxapi::EPixelFormat::Mono8:
+            executeMonochromeConversion<unsigned char>( device, dst, src, area, pack );
+            break;
+
+        case fxapi::EPixelFormat::Mono16:
+            executeMonochromeConversion<unsigned short>( device, dst, src, area, pack );
+            break;
+
+        case fxapi::EPixelFormat::Mono16S:
+            executeMonochromeConversion<signed short>( device, dst, src, area, pack );
+            break;
+
+        case fxapi::EPixelFormat::Mono32F:
+            executeMonochromeConversion<float>( device, dst, src, area, pack );
+            break;
+
+        default:
+            assert( false );
+            throw std::runtime_error(
+                "Error: unknown or incompatible pixel format!"
+            );
+    }
+}
+
+/// operation: packMonochrome
+void packMonochrome_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area
+) {
+    executeMonochromeConversion( device, dst, src, area, true );
+}
+
+/// operation: expandMonochrome
+void expandMonochrome_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area
+) {
+    executeMonochromeConversion( device, dst, src, area, false );
+}
+
+}
+}
+}
@@ -22,17 +22,17 @@ void normalize(
         normalize_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         normalize_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -58,18 +58,18 @@ void maxThreshold(
         maxThreshold_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             maximalValue
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         maxThreshold_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             maximalValue
         );
@@ -95,18 +95,18 @@ void minThreshold(
         minThreshold_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             minimalValue
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         minThreshold_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             minimalValue
         );
@@ -131,17 +131,17 @@ void negate(
         negate_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         negate_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -168,19 +168,19 @@ void min(
         min_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         min_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -205,18 +205,18 @@ void min(
         min_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             minimalChannelValue
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         min_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             minimalChannelValue
         );
@@ -243,19 +243,19 @@ void max(
         max_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         max_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -280,18 +280,18 @@ void max(
         max_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             maxChannelValue
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         max_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             maxChannelValue
         );
@@ -317,19 +317,19 @@ void add(
         add_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         add_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -354,18 +354,18 @@ void add(
         add_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             value
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         add_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             value
         );
@@ -391,18 +391,18 @@ void add(
         add_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             color
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         add_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             color
         );
@@ -428,19 +428,19 @@ void subtract(
         subtract_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         subtract_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -465,18 +465,18 @@ void subtract(
         subtract_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             value
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         subtract_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             value
         );
@@ -502,18 +502,18 @@ void subtract(
         subtract_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             color
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         subtract_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             color
         );
@@ -539,19 +539,19 @@ void multiply(
         multiply_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         multiply_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -576,18 +576,18 @@ void multiply(
         multiply_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             value
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         multiply_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             value
         );
@@ -613,18 +613,18 @@ void multiply(
         multiply_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             color
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         multiply_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             color
         );
@@ -650,19 +650,19 @@ void divide(
         divide_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         divide_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -687,18 +687,18 @@ void divide(
         divide_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             value
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         divide_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             value
         );
@@ -724,18 +724,18 @@ void divide(
         divide_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             color
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         divide_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             color
         );
@@ -761,19 +761,19 @@ void grainMultiply(
         grainMultiply_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         grainMultiply_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -798,18 +798,18 @@ void grainMultiply(
         grainMultiply_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             value
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         grainMultiply_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             value
         );
@@ -836,19 +836,19 @@ void applyGrainSubtract(
         applyGrainSubtract_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         applyGrainSubtract_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -874,19 +874,19 @@ void applyGrainAdd(
         applyGrainAdd_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         applyGrainAdd_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -912,19 +912,19 @@ void grainMerge(
         grainMerge_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         grainMerge_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -951,20 +951,20 @@ void alphaBlend(
         alphaBlend_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             opacity
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         alphaBlend_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             opacity
         );
@@ -991,19 +991,19 @@ void alphaBlend(
         alphaBlend_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         alphaBlend_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1029,19 +1029,19 @@ void screen(
         screen_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         screen_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1067,18 +1067,18 @@ void overlay(
         overlay_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             color
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         overlay_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             color
         );
@@ -1105,19 +1105,19 @@ void overlay(
         overlay_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         overlay_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1143,19 +1143,19 @@ void dodge(
         dodge_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL )  && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         dodge_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1181,19 +1181,19 @@ void burn(
         burn_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         burn_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1219,19 +1219,19 @@ void hardLight(
         hardLight_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         hardLight_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1258,19 +1258,19 @@ void grainExtract(
         grainExtract_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         grainExtract_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -1296,19 +1296,19 @@ void difference(
         difference_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src0->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src1->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area
         );
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src0->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src1->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         difference_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src0->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src1->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src0->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src1->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area
         );
         rendered = true;
@@ -3,6 +3,7 @@
 
 #include <libgraphics/fx/operations/basic/general/cpu.hpp>
 #include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_simd.hpp>
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
 #include <libgraphics/backend/cpu/cpu_imageoperation.hpp>
@@ -413,12 +414,12 @@ struct op_grain_merge : op_base<_t_any> {
 
     inline ValueType operator()( const ValueType& first, ValueType second ) const {
         const auto max_value = op_base<_t_any>::maxVal;
-        return OP_MIN_MAX( static_cast<ValueType>( ( int )first + ( int )second - ( max_value / 2 ) ) );
+        return OP_MIN_MAX( ( int )first + ( int )second - ( max_value / 2 ) );
     }
     inline ValueType operator()( const ValueType& first, float second ) const {
         const auto max_value = op_base<_t_any>::maxVal;
         const auto isecond   = std::ceil( max_value * second );
-        return OP_MIN_MAX( static_cast<ValueType>( ( int )first + ( int )isecond - ( max_value / 2 ) ) );
+        return OP_MIN_MAX( ( int )first + ( int )isecond - ( max_value / 2 ) );
     }
 };
 template <>
@@ -428,7 +429,7 @@ struct op_grain_merge<float> : op_base<float> {
     op_grain_merge() {}
 
     inline ValueType operator()( float first, float second ) const {
-        return static_cast<ValueType>( first + second - ( 1.0 / 2 ) );
+        return first + second - 0.5f;
     }
 };
 
@@ -604,6 +605,263 @@ struct op_apply_grain_add<float> : op_base<float> {
     }
 };
 
+/// the kernels below walk the area row by row. the
+/// channel count is a template parameter, so the inner
+/// loops have a fixed stride and can be vectorized. they
+/// may run in place (dst == src), every element is read
+/// before it is written at the same position.
+template < class _t_op, class _t_pixel_type, size_t _channels >
+void generic_operation_rows_img(
+    libgraphics::backend::cpu::ImageObject*   dst,
+    libgraphics::backend::cpu::ImageObject*   src1,
+    libgraphics::backend::cpu::ImageObject*   src2,
+    const libgraphics::Rect32I& area
+) {
+    static const _t_op op;
+
+    const size_t rowLength = ( size_t )area.width * _channels;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )dst->data() + ( ( ( size_t )y * dst->width() ) + area.x ) * _channels;
+        const _t_pixel_type* srcRow0 = ( const _t_pixel_type* )src1->data() + ( ( ( size_t )y * src1->width() ) + area.x ) * _channels;
+        const _t_pixel_type* srcRow1 = ( const _t_pixel_type* )src2->data() + ( ( ( size_t )y * src2->width() ) + area.x ) * _channels;
+
+        for( size_t i = 0; rowLength > i; ++i ) {
+            dstRow[i] = op( srcRow0[i], srcRow1[i] );
+        }
+    }
+}
+
+template < class _t_op, class _t_pixel_type, size_t _channels >
+void generic_operation_rows_img_single(
+    libgraphics::backend::cpu::ImageObject*   dst,
+    libgraphics::backend::cpu::ImageObject*   src0,
+    const libgraphics::Rect32I& area
+) {
+    static const _t_op op;
+
+    const size_t rowLength = ( size_t )area.width * _channels;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )dst->data() + ( ( ( size_t )y * dst->width() ) + area.x ) * _channels;
+        const _t_pixel_type* srcRow0 = ( const _t_pixel_type* )src0->data() + ( ( ( size_t )y * src0->width() ) + area.x ) * _channels;
+
+        for( size_t i = 0; rowLength > i; ++i ) {
+            dstRow[i] = op( srcRow0[i] );
+        }
+    }
+}
+
+template < class _t_op, class _t_pixel_type, size_t _channels >
+void generic_operation_rows_value(
+    libgraphics::backend::cpu::ImageObject*   dst,
+    libgraphics::backend::cpu::ImageObject*   src,
+    const libgraphics::Rect32I& area,
+    float value
+) {
+    static const _t_op op;
+
+    const size_t rowLength = ( size_t )area.width * _channels;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )dst->data() + ( ( ( size_t )y * dst->width() ) + area.x ) * _channels;
+        const _t_pixel_type* srcRow0 = ( const _t_pixel_type* )src->data() + ( ( ( size_t )y * src->width() ) + area.x ) * _channels;
+
+        for( size_t i = 0; rowLength > i; ++i ) {
+            dstRow[i] = op( srcRow0[i], value );
+        }
+    }
+}
+
+template < class _t_op, class _t_pixel_type, size_t _channels >
+void generic_operation_rows_color(
+    libgraphics::backend::cpu::ImageObject*   dst,
+    libgraphics::backend::cpu::ImageObject*   src,
+    const libgraphics::Rect32I& area,
+    const libgraphics::formats::RGBA32F::t& color
+) {
+    static const _t_op op;
+    static const size_t colorChannels = std::min<size_t>( _channels, ( size_t )libgraphics::formats::RGBA32F::t::Count );
+
+    float values[colorChannels];
+
+    for( size_t c = 0; colorChannels > c; ++c ) {
+        values[c] = color.Values[c];
+    }
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstPixel = ( _t_pixel_type* )dst->data() + ( ( ( size_t )y * dst->width() ) + area.x ) * _channels;
+        const _t_pixel_type* srcPixel0 = ( const _t_pixel_type* )src->data() + ( ( ( size_t )y * src->width() ) + area.x ) * _channels;
+
+        for( int x = 0; area.width > x; ++x, dstPixel += _channels, srcPixel0 += _channels ) {
+            for( size_t c = 0; colorChannels > c; ++c ) {
+                dstPixel[c] = op( srcPixel0[c], values[c] );
+            }
+        }
+    }
+}
+
+/// maps the operations that have a vectorized row kernel
+/// in cpu_simd.cpp to its table, all other operations stay
+/// on the scalar kernels above.
+template < class _t_op >
+struct simd_binary_operation {
+    static const int value = -1;
+};
+template < class _t_any >
+struct simd_binary_operation< op_add<_t_any> > {
+    static const int value = simd::EBinaryOperation::Add;
+};
+template < class _t_any >
+struct simd_binary_operation< op_sub<_t_any> > {
+    static const int value = simd::EBinaryOperation::Subtract;
+};
+template < class _t_any >
+struct simd_binary_operation< op_mul<_t_any> > {
+    static const int value = simd::EBinaryOperation::Multiply;
+};
+template < class _t_any >
+struct simd_binary_operation< op_min<_t_any> > {
+    static const int value = simd::EBinaryOperation::Min;
+};
+template < class _t_any >
+struct simd_binary_operation< op_max<_t_any> > {
+    static const int value = simd::EBinaryOperation::Max;
+};
+template < class _t_any >
+struct simd_binary_operation< op_grain_extract<_t_any> > {
+    static const int value = simd::EBinaryOperation::GrainExtract;
+};
+template < class _t_any >
+struct simd_binary_operation< op_grain_merge<_t_any> > {
+    static const int value = simd::EBinaryOperation::GrainMerge;
+};
+template < class _t_any >
+struct simd_binary_operation< op_difference<_t_any> > {
+    static const int value = simd::EBinaryOperation::Difference;
+};
+template < class _t_any >
+struct simd_binary_operation< op_screen<_t_any> > {
+    static const int value = simd::EBinaryOperation::Screen;
+};
+template < class _t_any >
+struct simd_binary_operation< op_overlay<_t_any> > {
+    static const int value = simd::EBinaryOperation::Overlay;
+};
+template < class _t_any >
+struct simd_binary_operation< op_dodge<_t_any> > {
+    static const int value = simd::EBinaryOperation::Dodge;
+};
+template < class _t_any >
+struct simd_binary_operation< op_burn<_t_any> > {
+    static const int value = simd::EBinaryOperation::Burn;
+};
+
+template < class _t_op >
+struct simd_unary_operation {
+    static const int value = -1;
+};
+template < class _t_any >
+struct simd_unary_operation< op_negate<_t_any> > {
+    static const int value = simd::EUnaryOperation::Negate;
+};
+
+template < class _t_pixel_type >
+struct simd_element_type {
+    static const int value = -1;
+};
+template <>
+struct simd_element_type<unsigned char> {
+    static const int value = simd::EElementType::UInt8;
+};
+template <>
+struct simd_element_type<unsigned short> {
+    static const int value = simd::EElementType::UInt16;
+};
+template <>
+struct simd_element_type<float> {
+    static const int value = simd::EElementType::Float32;
+};
+
+template < class _t_op, class _t_pixel_type >
+simd::BinaryRowKernel selectBinaryRowKernel() {
+    if( simd_binary_operation<_t_op>::value < 0 || simd_element_type<_t_pixel_type>::value < 0 ) {
+        return nullptr;
+    }
+
+    return simd::binaryRowKernel(
+               ( simd::EBinaryOperation::t )simd_binary_operation<_t_op>::value,
+               ( simd::EElementType::t )simd_element_type<_t_pixel_type>::value
+           );
+}
+
+template < class _t_op, class _t_pixel_type >
+simd::UnaryRowKernel selectUnaryRowKernel() {
+    if( simd_unary_operation<_t_op>::value < 0 || simd_element_type<_t_pixel_type>::value < 0 ) {
+        return nullptr;
+    }
+
+    return simd::unaryRowKernel(
+               ( simd::EUnaryOperation::t )simd_unary_operation<_t_op>::value,
+               ( simd::EElementType::t )simd_element_type<_t_pixel_type>::value
+           );
+}
+
+/// the vectorized kernels see a row as one run of
+/// interleaved elements.
+template < class _t_pixel_type >
+void simd_operation_rows_img(
+    simd::BinaryRowKernel kernel,
+    libgraphics::backend::cpu::ImageObject*   dst,
+    libgraphics::backend::cpu::ImageObject*   src1,
+    libgraphics::backend::cpu::ImageObject*   src2,
+    const libgraphics::Rect32I& area
+) {
+    const size_t channels   = libgraphics::fxapi::EPixelFormat::getChannelCount( dst->format() );
+    const size_t rowLength  = ( size_t )area.width * channels;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        kernel(
+            ( _t_pixel_type* )dst->data() + ( ( ( size_t )y * dst->width() ) + area.x ) * channels,
+            ( const _t_pixel_type* )src1->data() + ( ( ( size_t )y * src1->width() ) + area.x ) * channels,
+            ( const _t_pixel_type* )src2->data() + ( ( ( size_t )y * src2->width() ) + area.x ) * channels,
+            rowLength
+        );
+    }
+}
+
+template < class _t_pixel_type >
+void simd_operation_rows_img_single(
+    simd::UnaryRowKernel kernel,
+    libgraphics::backend::cpu::ImageObject*   dst,
+    libgraphics::backend::cpu::ImageObject*   src0,
+    const libgraphics::Rect32I& area
+) {
+    const size_t channels   = libgraphics::fxapi::EPixelFormat::getChannelCount( dst->format() );
+    const size_t rowLength  = ( size_t )area.width * channels;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        kernel(
+            ( _t_pixel_type* )dst->data() + ( ( ( size_t )y * dst->width() ) + area.x ) * channels,
+            ( const _t_pixel_type* )src0->data() + ( ( ( size_t )y * src0->width() ) + area.x ) * channels,
+            rowLength
+        );
+    }
+}
+
+/// selects the row kernel for the channel
+/// count of the destination format.
+#define GENERIC_OPERATION_DISPATCH_CHANNELS(kernel, format, ...) \
+    switch( libgraphics::fxapi::EPixelFormat::getChannelCount( format ) ) { \
+        case 1: kernel<_t_op, _t_pixel_type, 1>( __VA_ARGS__ ); break; \
+        case 3: kernel<_t_op, _t_pixel_type, 3>( __VA_ARGS__ ); break; \
+        case 4: kernel<_t_op, _t_pixel_type, 4>( __VA_ARGS__ ); break; \
+        default: \
+            assert( false ); \
+            qDebug() << "Error: unknown or incompatible pixel format!"; \
+            break; \
+    }
+
 template < class _t_op, class _t_pixel_type >
 void generic_operation_kernel_img(
     libgraphics::fxapi::ApiBackendDevice* device,
@@ -612,8 +870,6 @@ void generic_operation_kernel_img(
     libgraphics::backend::cpu::ImageObject*   src2,
     libgraphics::Rect32I area
 ) {
-    static const _t_op op;
-
     ( void )device;
 
     assert( dst );
@@ -621,29 +877,14 @@ void generic_operation_kernel_img(
     assert( src1 );
     assert( src2 );
 
-    void*   destinationBuffer = dst->data();
-    void*   sourceBuffer0 = src1->data();
-    void*   sourceBuffer1 = src2->data();
+    const simd::BinaryRowKernel rowKernel = selectBinaryRowKernel<_t_op, _t_pixel_type>();
 
-    size_t pixelLength = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                             dst->format()
-                         );
-    size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                              dst->format()
-                          );
-
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-
-        _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * dst->width() ) + x + area.x ) * pixelLength );
-        _t_pixel_type* srcPixel0 = ( _t_pixel_type* )( ( ( char* )sourceBuffer0 ) + ( ( ( area.y + y ) * src1->width() ) + x + area.x ) * pixelLength );
-        _t_pixel_type* srcPixel1 = ( _t_pixel_type* )( ( ( char* )sourceBuffer1 ) + ( ( ( area.y + y ) * src2->width() ) + x + area.x ) * pixelLength );
-
-        for( size_t i = 0; channelCount > i; ++i ) {
-            *( dstPixel + i ) = op( *( srcPixel0 + i ), *( srcPixel1 + i ) );
-        }
+    if( rowKernel ) {
+        simd_operation_rows_img<_t_pixel_type>( rowKernel, dst, src1, src2, area );
+        return;
     }
+
+    GENERIC_OPERATION_DISPATCH_CHANNELS( generic_operation_rows_img, dst->format(), dst, src1, src2, area )
 }
 
 template < class _t_op, class _t_pixel_type >
@@ -653,34 +894,20 @@ void generic_operation_kernel_img_single(
     libgraphics::backend::cpu::ImageObject*   src0,
     libgraphics::Rect32I area
 ) {
-    static const _t_op op;
-
     ( void )device;
 
     assert( dst );
     assert( device );
     assert( src0 );
 
-    void*   destinationBuffer = dst->data();
-    void*   sourceBuffer0 = src0->data();
-
-    size_t pixelLength = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                             dst->format()
-                         );
-    size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                              dst->format()
-                          );
-
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-        _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * dst->width() ) + x + area.x ) * pixelLength );
-        _t_pixel_type* srcPixel0 = ( _t_pixel_type* )( ( ( char* )sourceBuffer0 ) + ( ( ( area.y + y ) * src0->width() ) + x + area.x ) * pixelLength );
+    const simd::UnaryRowKernel rowKernel = selectUnaryRowKernel<_t_op, _t_pixel_type>();
 
-        for( size_t i = 0; channelCount > i; ++i ) {
-            *( dstPixel + i ) = op( *( srcPixel0 + i ) );
-        }
+    if( rowKernel ) {
+        simd_operation_rows_img_single<_t_pixel_type>( rowKernel, dst, src0, area );
+        return;
     }
+
+    GENERIC_OPERATION_DISPATCH_CHANNELS( generic_operation_rows_img_single, dst->format(), dst, src0, area )
 }
 
 template < class _t_op, class _t_pixel_type >
@@ -691,35 +918,13 @@ void generic_operation_kernel_value(
     libgraphics::Rect32I area,
     float value
 ) {
-    static const _t_op op;
-
     ( void )device;
 
     assert( dst );
     assert( device );
     assert( src );
 
-    void*   destinationBuffer = dst->data();
-    void*   sourceBuffer0 = src->data();
-
-    size_t pixelLength = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                             dst->format()
-                         );
-    size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                              dst->format()
-                          );
-
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-        _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * dst->width() ) + x + area.x ) * pixelLength );
-        _t_pixel_type* srcPixel0 = ( _t_pixel_type* )( ( ( char* )sourceBuffer0 ) + ( ( ( area.y + y ) * src->width() ) + x + area.x ) * pixelLength );
-
-        for( size_t i = 0; channelCount > i; ++i ) {
-            *( dstPixel + i ) = op( *( srcPixel0 + i ), value );
-        }
-    }
-
+    GENERIC_OPERATION_DISPATCH_CHANNELS( generic_operation_rows_value, dst->format(), dst, src, area, value )
 }
 
 template < class _t_op, class _t_pixel_type >
@@ -730,37 +935,13 @@ void generic_operation_kernel_color(
     libgraphics::Rect32I area,
     const libgraphics::formats::RGBA32F::t& color
 ) {
-    static const _t_op op;
-
     ( void )device;
 
     assert( dst );
     assert( device );
     assert( src );
 
-    void*   destinationBuffer = dst->data();
-    void*   sourceBuffer0 = src->data();
-
-    size_t pixelLength = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                             dst->format()
-                         );
-    size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                              dst->format()
-                          );
-
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-        _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * dst->width() ) + x + area.x ) * pixelLength );
-        _t_pixel_type* srcPixel0 = ( _t_pixel_type* )( ( ( char* )sourceBuffer0 ) + ( ( ( area.y + y ) * src->width() ) + x + area.x ) * pixelLength );
-
-        const auto iterMax = std::min<size_t>( channelCount, ( size_t )color.Count );
-
-        for( size_t i = 0; iterMax > i; ++i ) {
-            *( dstPixel + i ) = op( *( srcPixel0 + i ), color.Values[i] );
-        }
-    }
-
+    GENERIC_OPERATION_DISPATCH_CHANNELS( generic_operation_rows_color, dst->format(), dst, src, area, color )
 }
 
 /// operation: maxThreshold
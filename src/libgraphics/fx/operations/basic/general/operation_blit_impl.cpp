@@ -41,7 +41,7 @@ void blit(
         blit_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             sourceArea,
             destArea
         );
@@ -51,7 +51,7 @@ void blit(
         blit_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             sourceArea,
             destArea
         );
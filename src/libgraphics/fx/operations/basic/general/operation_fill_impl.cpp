@@ -42,7 +42,7 @@ void fill(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         fill_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
@@ -99,7 +99,7 @@ void fill(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         fill_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
@@ -157,7 +157,7 @@ void fillChannel(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         fillChannel_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
@@ -215,7 +215,7 @@ void fillChannel(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         fillChannel_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
@@ -273,7 +273,7 @@ void fillChannel(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         fillChannel_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
@@ -331,7 +331,7 @@ void fillChannel(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         fillChannel_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
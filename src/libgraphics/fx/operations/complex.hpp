@@ -4,6 +4,7 @@
 #include <libgraphics/bitmap.hpp>
 #include <libgraphics/fxapi.hpp>
 #include <libgraphics/image.hpp>
+#include <libgraphics/pointoperation.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -31,6 +32,28 @@ void gaussianBlur(
     float radius
 );
 
+/// radius from which gaussianBlur() renders
+/// fastGaussianBlur() on the cpu backend.
+static const float FastGaussianBlurMinRadius = 4.0f;
+
+/**
+ *  renders an approximated gaussian blur in constant
+ *  time per pixel, using four stacked extended box blurs
+ *  per direction with the variance of gaussianBlur().
+ *  for radius >= FastGaussianBlurMinRadius the 1d kernel
+ *  differs from the gaussian by less than 4.2% of its peak
+ *  weight and by less than 5% in L1 distance, so a single
+ *  pass is off by at most 5% of the value range. the
+ *  opengl backend always renders the exact gaussian.
+ */
+void fastGaussianBlur(
+    fxapi::ApiBackendDevice* backend,
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area,
+    float radius
+);
+
 /**
  *  renders a vertical gaussian
  *  blur.
@@ -55,6 +78,20 @@ void horizontalGaussianBlur(
     float radius
 );
 
+/// number of pixels next to an output pixel, which
+/// gaussianBlur() and fastGaussianBlur() read per direction.
+int gaussianBlurHalo( float radius );
+
+/// returns area grown by halo pixels on each side. the
+/// blurs wrap around at the image borders, so an axis that
+/// reaches a border is extended over the whole image.
+Rect32I expandArea(
+    const Rect32I& area,
+    int halo,
+    size_t width,
+    size_t height
+);
+
 
 /// operation: adaptiveBwMixer
 void adaptiveBWMixer(
@@ -107,6 +144,42 @@ void cascadedSharpen(
     float threshold
 );
 
+/// operation: pointChain
+/// runs the point operations one after another in a single
+/// pass over the area. cpu backend only, every operation has
+/// to support the format of the layers.
+void pointChain(
+    fxapi::ApiBackendDevice* backend,
+    ImageLayer*                 dst,
+    ImageLayer*                 src,
+    Rect32I                     area,
+    const PointOperationList&   operations
+);
+
+/// point operations of convertToMonochrome(), adjustBrightness(),
+/// splittone() and applyVignette() for 8 and 16 bit formats.
+std::shared_ptr<const PointOperation> makeMonochromePointOperation(
+    const float* channelFactors /** red, green and blue **/
+);
+std::shared_ptr<const PointOperation> makeCurvePointOperation(
+    const float* curveData,
+    size_t curveLength
+);
+std::shared_ptr<const PointOperation> makeSplittonePointOperation(
+    float brightR,
+    float brightG,
+    float brightB,
+    float darkR,
+    float darkG,
+    float darkB,
+    float weight
+);
+std::shared_ptr<const PointOperation> makeVignettePointOperation(
+    const Point32F& center,
+    float radius,
+    float strength
+);
+
 }
 }
 }
@@ -32,6 +32,18 @@ void gaussianBlur_CPU(
     float radius
 );
 
+/**
+ *  renders a box blur approximation
+ *  of the gaussian blur.
+ */
+void fastGaussianBlur_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* destination,
+    libgraphics::fxapi::ApiImageObject* source,
+    Rect32I area,
+    float radius
+);
+
 /**
  *  renders a vertical gaussian
  *  blur.
@@ -97,6 +109,18 @@ void filmgrain_CPU(
     bool                                    isMonoGrain
 );
 
+/// operation: filmgrainComposite
+/// single pass version of the layer chain in filmgrain_GEN,
+/// supports 8 and 16 bit formats like adjustBrightness_CPU.
+void filmgrainComposite_CPU(
+    libgraphics::fxapi::ApiBackendDevice*   device,
+    libgraphics::fxapi::ApiImageObject*     destination,
+    libgraphics::fxapi::ApiImageObject*     source,
+    Rect32I                                 area,
+    libgraphics::fxapi::ApiImageObject*     grainLayer,
+    const std::vector<float>&               curveData
+);
+
 /// operation: cascadedSharpenWith4
 void cascadedSharpenWith4_CPU(
     libgraphics::fxapi::ApiBackendDevice*   device,
@@ -109,6 +133,28 @@ void cascadedSharpenWith4_CPU(
     const std::tuple< libgraphics::ImageLayer*, float, float >& cascade3,
     float threshold
 );
+
+/// operation: cascadedSharpenComposite
+/// single pass version of the layer chain in cascadedSharpen_GEN
+/// for any number of cascades. the cascade layers must contain
+/// cpu data, supports 8 and 16 bit formats.
+void cascadedSharpenComposite_CPU(
+    libgraphics::fxapi::ApiBackendDevice*   device,
+    libgraphics::fxapi::ApiImageObject*     destination,
+    libgraphics::fxapi::ApiImageObject*     source,
+    Rect32I                                 area,
+    const std::vector< std::tuple< libgraphics::ImageLayer*, float, float > >& cascades,
+    float threshold
+);
+
+/// operation: pointChain
+void pointChain_CPU(
+    libgraphics::fxapi::ApiBackendDevice*   device,
+    libgraphics::fxapi::ApiImageObject*     destination,
+    libgraphics::fxapi::ApiImageObject*     source,
+    Rect32I                                 area,
+    const PointOperationList&               operations
+);
 }
 }
 }
@@ -32,7 +32,7 @@ void adaptiveBWMixer(
         adaptiveBWMixer_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             brightR,
             brightG,
@@ -49,7 +49,7 @@ void adaptiveBWMixer(
         adaptiveBWMixer_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             brightR,
             brightG,
@@ -6,6 +6,7 @@
 #include <libgraphics/fx/operations/complex.hpp>
 #include <libgraphics/fx/operations/complex/cpu.hpp>
 #include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_lut.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -33,6 +34,30 @@ struct kernel_adaptive_bwmixer {
 };
 
 
+template < class _t_pixel_type >
+inline void adaptiveBWMixerPixel(
+    _t_pixel_type* dstPixel,
+    const _t_pixel_type* srcPixel,
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+) {
+    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+
+    const float combined = math::adaptiveMonochrome(
+                               MapToFloat( maxValue, GetR( srcPixel ) ),
+                               MapToFloat( maxValue, GetG( srcPixel ) ),
+                               MapToFloat( maxValue, GetB( srcPixel ) ),
+                               highlights,
+                               shadows,
+                               weight
+                           );
+
+    GetR( dstPixel ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
+    GetG( dstPixel ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
+    GetB( dstPixel ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
+}
+
 template <  class _t_pixel_type >
 void cpuAdaptiveBWMixer(
     libgraphics::fxapi::ApiBackendDevice* device,
@@ -59,20 +84,8 @@ void cpuAdaptiveBWMixer(
         return;
     }
 
-    const float highlights[4] = {
-        params.brightR,
-        params.brightG,
-        params.brightB,
-        1.0f
-    };
-    const float shadows[4] = {
-        params.darkR,
-        params.darkG,
-        params.darkB,
-        1.0f
-    };
-
-    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+    const math::Color3f highlights( params.brightR, params.brightG, params.brightB );
+    const math::Color3f shadows( params.darkR, params.darkG, params.darkB );
 
     for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
         const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
@@ -81,20 +94,95 @@ void cpuAdaptiveBWMixer(
         _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * destination->width() ) + x + area.x ) * pixelLength );
         _t_pixel_type* srcPixel = ( _t_pixel_type* )( ( ( char* )sourceBuffer ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength );
 
-        const float luma    = params.weight + ( MapToFloat( maxValue, GetR( srcPixel ) ) * 0.299f )  + ( MapToFloat( maxValue, GetG( srcPixel ) ) * 0.587f )  +
-                              ( MapToFloat( maxValue, GetB( srcPixel ) ) * 0.114f );
-        const float bright  = ( MapToFloat( maxValue, GetR( srcPixel ) ) * highlights[0] ) + ( MapToFloat( maxValue, GetG( srcPixel ) ) * highlights[1] ) +
-                              ( MapToFloat( maxValue, GetB( srcPixel ) ) * highlights[2] );
-        const float dark  = ( MapToFloat( maxValue, GetR( srcPixel ) ) * shadows[0] ) + ( MapToFloat( maxValue, GetG( srcPixel ) ) * shadows[1] ) +
-                            ( MapToFloat( maxValue, GetB( srcPixel ) ) * shadows[2] );
-        const float combined = ( dark * ( 1.0f - luma ) ) + ( bright * luma );
-
-        GetR( dstPixel ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
-        GetG( dstPixel ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
-        GetB( dstPixel ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
+        adaptiveBWMixerPixel( dstPixel, srcPixel, highlights, shadows, params.weight );
+    }
+}
+
+template < class _t_pixel_type >
+struct kernel_adaptive_bwmixer_lookup_pack {
+    kernel_adaptive_bwmixer_lookup_pack(
+        const kernel_adaptive_bwmixer& _params,
+        const std::shared_ptr<const PixelLookupTable<_t_pixel_type> >& _table
+    ) : params( _params ), table( _table ) {}
+
+    kernel_adaptive_bwmixer                                 params;
+    std::shared_ptr<const PixelLookupTable<_t_pixel_type> > table;
+};
+
+/// integer formats: gray pixels are a single gather
+/// from the baked table, colored pixels are computed.
+template <  class _t_pixel_type >
+void cpuAdaptiveBWMixerLookup(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_adaptive_bwmixer_lookup_pack<_t_pixel_type>& pack
+) {
+    ( void )device;
+
+    const size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
+                                    destination->format()
+                                );
+
+    assert( channelCount >= 3 );
+
+    if( channelCount < 3 ) {
+        return;
+    }
+
+    const math::Color3f highlights( pack.params.brightR, pack.params.brightG, pack.params.brightB );
+    const math::Color3f shadows( pack.params.darkR, pack.params.darkG, pack.params.darkB );
+    const PixelLookupTable<_t_pixel_type>& table = *pack.table;
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstPixel = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + area.x ) * channelCount );
+        const _t_pixel_type* srcPixel = ( const _t_pixel_type* )source->data() + ( ( ( size_t )y * source->width() + area.x ) * channelCount );
+
+        for( int x = 0; area.width > x; ++x, dstPixel += channelCount, srcPixel += channelCount ) {
+            if( GetR( srcPixel ) == GetG( srcPixel ) && GetR( srcPixel ) == GetB( srcPixel ) ) {
+                const _t_pixel_type value = *table.entry( GetR( srcPixel ) );
+
+                GetR( dstPixel ) = value;
+                GetG( dstPixel ) = value;
+                GetB( dstPixel ) = value;
+            } else {
+                adaptiveBWMixerPixel( dstPixel, srcPixel, highlights, shadows, pack.params.weight );
+            }
+        }
     }
 }
 
+template < class _t_pixel_type >
+void executeAdaptiveBWMixerLookup(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    libgraphics::Rect32I   area,
+    const kernel_adaptive_bwmixer& params
+) {
+    const auto table = adaptiveBWMixerLookupTable<_t_pixel_type>(
+                           math::Color3f( params.brightR, params.brightG, params.brightB ),
+                           math::Color3f( params.darkR, params.darkG, params.darkB ),
+                           params.weight
+                       );
+
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )dst,
+        ( backend::cpu::ImageObject* )src,
+        area,
+        std::bind(
+            &cpuAdaptiveBWMixerLookup<_t_pixel_type>,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            kernel_adaptive_bwmixer_lookup_pack<_t_pixel_type>( params, table )
+        )
+    );
+}
+
 void adaptiveBWMixer_CPU(
     libgraphics::fxapi::ApiBackendDevice* device,
     libgraphics::fxapi::ApiImageObject* dst,
@@ -153,37 +241,23 @@ void adaptiveBWMixer_CPU(
 
         case fxapi::EPixelFormat::RGB8:
         case fxapi::EPixelFormat::RGBA8:
-            fx::operations::cpuExecuteTileBased(
+            executeAdaptiveBWMixerLookup<unsigned char>(
                 device,
-                ( backend::cpu::ImageObject* )dst,
-                ( backend::cpu::ImageObject* )src,
+                dst,
+                src,
                 area,
-                std::bind(
-                    &cpuAdaptiveBWMixer<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_adaptive_bwmixer( brightR, brightG, brightB, darkR, darkG, darkB, weight )
-                )
+                kernel_adaptive_bwmixer( brightR, brightG, brightB, darkR, darkG, darkB, weight )
             );
             break;
 
         case fxapi::EPixelFormat::RGB16:
         case fxapi::EPixelFormat::RGBA16:
-            fx::operations::cpuExecuteTileBased(
+            executeAdaptiveBWMixerLookup<unsigned short>(
                 device,
-                ( backend::cpu::ImageObject* )dst,
-                ( backend::cpu::ImageObject* )src,
+                dst,
+                src,
                 area,
-                std::bind(
-                    &cpuAdaptiveBWMixer<unsigned short>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_adaptive_bwmixer( brightR, brightG, brightB, darkR, darkG, darkB, weight )
-                )
+                kernel_adaptive_bwmixer( brightR, brightG, brightB, darkR, darkG, darkB, weight )
             );
             break;
 
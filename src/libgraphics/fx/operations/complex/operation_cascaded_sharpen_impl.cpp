@@ -28,7 +28,7 @@ void cascadedSharpen(
             cascadedSharpenWith4_CPU(
                 dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
                 dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-                src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+                src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
                 area,
                 cascades[0],
                 cascades[1],
@@ -39,7 +39,7 @@ void cascadedSharpen(
 
         } else {
             cascadedSharpen_GEN(
-                dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
+                dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
                 dst,
                 src,
                 area,
@@ -56,7 +56,7 @@ void cascadedSharpen(
             cascadedSharpenWith4_GL(
                 dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
                 dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-                src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+                src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
                 area,
                 cascades[0],
                 cascades[1],
@@ -9,6 +9,11 @@
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 namespace libgraphics {
 namespace fx {
 namespace operations {
@@ -53,9 +58,10 @@ void cpuCascadedSharpenWith4(
                                     destination->format()
                                 );
 
-    assert( channelCount >= 3 );
+    /** single channel layers are sharpened like a gray rgb image **/
+    assert( ( channelCount == 1 ) || ( channelCount >= 3 ) );
 
-    if( channelCount < 3 ) {
+    if( ( channelCount != 1 ) && ( channelCount < 3 ) ) {
         return;
     }
 
@@ -93,6 +99,14 @@ void cpuCascadedSharpenWith4(
 
     const float quotient = 1.0f - std::max<float>( params.threshold / 100.0f, 0.01f );
 
+    const auto loadPixel = [channelCount]( const _t_pixel_type * pixel ) {
+        if( channelCount == 1 ) {
+            return Color3( ( int )pixel[0], ( int )pixel[0], ( int )pixel[0] );
+        }
+
+        return GetColor3i( Color3, pixel );
+    };
+
     for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
         const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
         const size_t x = ( p - ( y * ( int )area.width ) );
@@ -105,11 +119,11 @@ void cpuCascadedSharpenWith4(
         _t_pixel_type* ptrBlurPixel2 = ( _t_pixel_type* )( ( ( char* )blurBuffer2 ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength );
         _t_pixel_type* ptrBlurPixel3 = ( _t_pixel_type* )( ( ( char* )blurBuffer3 ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength );
 
-        Color3  basePixel = GetColor3i( Color3, ptrSrcPixel );
-        Color3  blurred0  = GetColor3i( Color3, ptrBlurPixel0 );
-        Color3  blurred1  = GetColor3i( Color3, ptrBlurPixel1 );
-        Color3  blurred2  = GetColor3i( Color3, ptrBlurPixel2 );
-        Color3  blurred3  = GetColor3i( Color3, ptrBlurPixel3 );
+        Color3  basePixel = loadPixel( ptrSrcPixel );
+        Color3  blurred0  = loadPixel( ptrBlurPixel0 );
+        Color3  blurred1  = loadPixel( ptrBlurPixel1 );
+        Color3  blurred2  = loadPixel( ptrBlurPixel2 );
+        Color3  blurred3  = loadPixel( ptrBlurPixel3 );
 
         Color3  raw0      = blurred0 - basePixel;
         Color3  raw1      = blurred1 - basePixel;
@@ -135,7 +149,11 @@ void cpuCascadedSharpenWith4(
         Color3 sum  = weighted0 + weighted1 + weighted2 + weighted3;
         Color3 temp = ( ( overall * ( basePixel - sum ) ) + ( overall.negate() * basePixel ) );
 
-        SetColor3i( Color3, temp, ptrDstPixel );
+        if( channelCount == 1 ) {
+            GetR( ptrDstPixel ) = temp.r;
+        } else {
+            SetColor3i( Color3, temp, ptrDstPixel );
+        }
     }
 }
 
@@ -174,10 +192,10 @@ void cascadedSharpenWith4_CPU(
     std::tie( blurred3, p, intensity3 ) = cascade3;
 
     kernel_cascaded_sharpen_params params;
-    params.blurred0 = ( backend::cpu::ImageObject* )blurred0->internalImageForBackend( FXAPI_BACKEND_CPU );
-    params.blurred1 = ( backend::cpu::ImageObject* )blurred1->internalImageForBackend( FXAPI_BACKEND_CPU );
-    params.blurred2 = ( backend::cpu::ImageObject* )blurred2->internalImageForBackend( FXAPI_BACKEND_CPU );
-    params.blurred3 = ( backend::cpu::ImageObject* )blurred3->internalImageForBackend( FXAPI_BACKEND_CPU );
+    params.blurred0 = ( backend::cpu::ImageObject* )blurred0->sourceImageForBackend( FXAPI_BACKEND_CPU );
+    params.blurred1 = ( backend::cpu::ImageObject* )blurred1->sourceImageForBackend( FXAPI_BACKEND_CPU );
+    params.blurred2 = ( backend::cpu::ImageObject* )blurred2->sourceImageForBackend( FXAPI_BACKEND_CPU );
+    params.blurred3 = ( backend::cpu::ImageObject* )blurred3->sourceImageForBackend( FXAPI_BACKEND_CPU );
 
     params.intensity0   = intensity0;
     params.intensity1   = intensity1;
@@ -187,6 +205,7 @@ void cascadedSharpenWith4_CPU(
     params.threshold    = threshold;
 
     switch( dst->format() ) {
+        case fxapi::EPixelFormat::Mono16S:
         case fxapi::EPixelFormat::RGB16S:
         case fxapi::EPixelFormat::RGBA16S:
             fx::operations::cpuExecuteTileBased(
@@ -205,6 +224,7 @@ void cascadedSharpenWith4_CPU(
             );
             break;
 
+        case fxapi::EPixelFormat::Mono32F:
         case fxapi::EPixelFormat::RGB32F:
         case fxapi::EPixelFormat::RGBA32F:
             fx::operations::cpuExecuteTileBased(
@@ -224,6 +244,7 @@ void cascadedSharpenWith4_CPU(
             break;
 
 
+        case fxapi::EPixelFormat::Mono8:
         case fxapi::EPixelFormat::RGB8:
         case fxapi::EPixelFormat::RGBA8:
             fx::operations::cpuExecuteTileBased(
@@ -242,6 +263,7 @@ void cascadedSharpenWith4_CPU(
             );
             break;
 
+        case fxapi::EPixelFormat::Mono16:
         case fxapi::EPixelFormat::RGB16:
         case fxapi::EPixelFormat::RGBA16:
             fx::operations::cpuExecuteTileBased(
@@ -268,6 +290,167 @@ void cascadedSharpenWith4_CPU(
     }
 }
 
+struct kernel_cascaded_sharpen_composite_pack {
+    std::vector<backend::cpu::ImageObject*>     blurred;
+    std::vector<float>                          strengths;
+    float                                       factor;
+
+    kernel_cascaded_sharpen_composite_pack() : factor( 0.0f ) {}
+};
+
+/// computes the layer chain of cascadedSharpen_GEN with the
+/// rounding of the basic operations. the state carried from
+/// one cascade to the next (front buffer, last usm map and
+/// blur composite) is kept for one row at a time.
+template < class _t_pixel_type >
+void kernel_cascaded_sharpen_composite(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_cascaded_sharpen_composite_pack& params
+) {
+    ( void )device;
+
+    const int       maxValue    = std::numeric_limits<_t_pixel_type>::max();
+    const float     maxFloat    = ( float )maxValue;
+    const int       half        = maxValue / 2;
+    const size_t    channels    = libgraphics::fxapi::EPixelFormat::getChannelCount( destination->format() );
+    const size_t    rowLength   = ( size_t )area.width * channels;
+
+    /// the chain starts with layers filled by fill( layer, area, 128 ),
+    /// which sets every byte.
+    _t_pixel_type fillValue;
+    ( void ) ::memset( &fillValue, 128, sizeof( fillValue ) );
+
+    const auto clampValue = [maxValue]( int value ) {
+        return std::max( 0, std::min( maxValue, value ) );
+    };
+
+    std::vector<int> front( rowLength );
+    std::vector<int> last( rowLength );
+    std::vector<int> blurComposite( rowLength );
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() ) + area.x ) * channels;
+        const _t_pixel_type* srcRow = ( const _t_pixel_type* )source->data() + ( ( ( size_t )y * source->width() ) + area.x ) * channels;
+
+        std::fill( front.begin(), front.end(), ( int )fillValue );
+        std::fill( last.begin(), last.end(), ( int )fillValue );
+        std::fill( blurComposite.begin(), blurComposite.end(), ( int )fillValue );
+
+        for( size_t c = 0; params.blurred.size() > c; ++c ) {
+            backend::cpu::ImageObject* blurred = params.blurred[c];
+            const _t_pixel_type* cascadeRow = ( const _t_pixel_type* )blurred->data() + ( ( ( size_t )y * blurred->width() ) + area.x ) * channels;
+            const float strength = params.strengths[c];
+
+            for( size_t i = 0; rowLength > i; ++i ) {
+                /** grainExtract( usmMapCurrent, cascade, source ) **/
+                const int usm       = clampValue( ( int )cascadeRow[i] - ( int )srcRow[i] + half );
+                /** grainExtract( destination, usmMapCurrent, usmMapLast ) **/
+                const int detail    = clampValue( usm - last[i] + half );
+                /** grainMultiply( compositeBuffer, destination, strength ) **/
+                const int composite = clampValue( ( int )std::ceil( ( float )( detail - half ) * strength ) + half );
+
+                blurComposite[i]    = std::max( usm, blurComposite[i] );
+                front[i]            = clampValue( front[i] + composite - half );
+                last[i]             = usm;
+            }
+        }
+
+        for( size_t i = 0; rowLength > i; ++i ) {
+            const int value     = srcRow[i];
+            const int threshold = clampValue( ( int )std::ceil( ( double )blurComposite[i] * ( double )params.factor ) );
+            const int difference = clampValue( value - front[i] + half );
+
+            /** factor * ( basePixel - temp ) + ( 1.0 - factor ) * basePixel **/
+            const int base      = clampValue( ( int )std::ceil( ( float )difference * ( ( float )threshold / maxFloat ) ) );
+            const int negated   = clampValue( ( int )std::ceil( ( float )value * ( ( float )( maxValue - threshold ) / maxFloat ) ) );
+
+            dstRow[i] = ( _t_pixel_type )std::min( maxValue, base + negated );
+        }
+    }
+}
+
+void cascadedSharpenComposite_CPU(
+    libgraphics::fxapi::ApiBackendDevice*   device,
+    libgraphics::fxapi::ApiImageObject*     dst,
+    libgraphics::fxapi::ApiImageObject*     src,
+    Rect32I                                 area,
+    const std::vector< std::tuple< libgraphics::ImageLayer*, float, float > >& cascades,
+    float threshold
+) {
+    assert( device != nullptr );
+    assert( dst != nullptr );
+    assert( src != nullptr );
+    assert( dst->format() == src->format() );
+
+    kernel_cascaded_sharpen_composite_pack params;
+    params.factor = 1.0f - std::max( threshold / 100.0f, 0.01f );
+
+    for( auto it = cascades.begin(); it != cascades.end(); ++it ) {
+        libgraphics::ImageLayer*    cascade( nullptr );
+        float                       blurRadius( 0.0f );
+        float                       strength( 0.0f );
+
+        std::tie( cascade, blurRadius, strength ) = *it;
+
+        assert( cascade->containsDataForBackend( FXAPI_BACKEND_CPU ) );
+        assert( cascade->format() == dst->format() );
+
+        params.blurred.push_back( ( backend::cpu::ImageObject* )cascade->sourceImageForBackend( FXAPI_BACKEND_CPU ) );
+        params.strengths.push_back( strength / 100.0f );
+    }
+
+    switch( dst->format() ) {
+        case fxapi::EPixelFormat::Mono8:
+        case fxapi::EPixelFormat::RGB8:
+        case fxapi::EPixelFormat::RGBA8:
+            fx::operations::cpuExecuteTileBased(
+                device,
+                ( backend::cpu::ImageObject* )dst,
+                ( backend::cpu::ImageObject* )src,
+                area,
+                std::bind(
+                    &kernel_cascaded_sharpen_composite<unsigned char>,
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    std::placeholders::_3,
+                    std::placeholders::_4,
+                    params
+                ),
+                backend::cpu::TileHints( dst->format(), 2 + params.blurred.size() )
+            );
+            break;
+
+        case fxapi::EPixelFormat::Mono16:
+        case fxapi::EPixelFormat::RGB16:
+        case fxapi::EPixelFormat::RGBA16:
+            fx::operations::cpuExecuteTileBased(
+                device,
+                ( backend::cpu::ImageObject* )dst,
+                ( backend::cpu::ImageObject* )src,
+                area,
+                std::bind(
+                    &kernel_cascaded_sharpen_composite<unsigned short>,
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    std::placeholders::_3,
+                    std::placeholders::_4,
+                    params
+                ),
+                backend::cpu::TileHints( dst->format(), 2 + params.blurred.size() )
+            );
+            break;
+
+        default:
+            assert( false );
+            throw std::runtime_error(
+                "Error: unknown or incompatible pixel format!"
+            );
+    }
+}
+
 }
 }
 }
@@ -4,10 +4,13 @@
 #include <math.h>
 
 #include <libgraphics/image.hpp>
+#include <libgraphics/cancellation.hpp>
+#include <libgraphics/scratchlayerpool.hpp>
 
 #include <libgraphics/fx/operations/basic.hpp>
 #include <libgraphics/fx/operations/complex.hpp>
 #include <libgraphics/fx/operations/complex/gen.hpp>
+#include <libgraphics/fx/operations/complex/cpu.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -21,15 +24,52 @@ void cascadedSharpen_GEN(
     const std::vector< std::tuple< libgraphics::ImageLayer*, float, float > >& cascades,
     float threshold
 ) {
-    std::unique_ptr<libgraphics::ImageLayer> frontBuffer( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
-    std::unique_ptr<libgraphics::ImageLayer> backBuffer( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
-    std::unique_ptr<libgraphics::ImageLayer> compositeBuffer( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    /// the cpu backend computes the chain below per tile
+    /// without the full size intermediate layers.
+    if( ( device->backendId() == FXAPI_BACKEND_CPU ) && destination->containsDataForBackend( FXAPI_BACKEND_CPU ) && source->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+        bool supported( false );
+
+        switch( source->format() ) {
+            case fxapi::EPixelFormat::Mono8:
+            case fxapi::EPixelFormat::RGB8:
+            case fxapi::EPixelFormat::RGBA8:
+            case fxapi::EPixelFormat::Mono16:
+            case fxapi::EPixelFormat::RGB16:
+            case fxapi::EPixelFormat::RGBA16:
+                supported = true;
+                break;
+
+            default:
+                break;
+        }
+
+        for( auto it = cascades.begin(); supported && ( it != cascades.end() ); ++it ) {
+            supported = std::get<0>( *it )->containsDataForBackend( FXAPI_BACKEND_CPU );
+        }
+
+        if( supported ) {
+            cascadedSharpenComposite_CPU(
+                destination->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
+                destination->internalImageForBackend( FXAPI_BACKEND_CPU ),
+                source->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+                area,
+                cascades,
+                threshold
+            );
+
+            return;
+        }
+    }
+
+    ScopedScratchLayer frontBuffer( device, source );
+    ScopedScratchLayer backBuffer( device, source );
+    ScopedScratchLayer compositeBuffer( device, source );
 
-    std::unique_ptr<libgraphics::ImageLayer> usmMapCurrent( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
-    std::unique_ptr<libgraphics::ImageLayer> usmMapLast( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer usmMapCurrent( device, source );
+    ScopedScratchLayer usmMapLast( device, source );
 
-    std::unique_ptr<libgraphics::ImageLayer> blurCompositeFront( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
-    std::unique_ptr<libgraphics::ImageLayer> blurCompositeBack( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer blurCompositeFront( device, source );
+    ScopedScratchLayer blurCompositeBack( device, source );
 
     {
 
@@ -78,6 +118,10 @@ void cascadedSharpen_GEN(
 
 
     for( size_t i = 0; cascades.size() > i; ++i ) {
+        if( libgraphics::isCurrentOperationCancelled() ) {
+            return;
+        }
+
         libgraphics::ImageLayer*    cascade( nullptr );
         float                       blurRadius( 0.0f );
         float                       strength( 0.0f );
@@ -120,24 +164,24 @@ void cascadedSharpen_GEN(
         );
 
 
-        std::swap(
-            frontBuffer,
-            backBuffer
-        );
-        std::swap(
-            usmMapLast,
-            usmMapCurrent
-        );
-        std::swap(
-            blurCompositeFront,
-            blurCompositeBack
-        );
+        frontBuffer.swap( backBuffer );
+        usmMapLast.swap( usmMapCurrent );
+        blurCompositeFront.swap( blurCompositeBack );
     }
 
-    /// resetting resources...
+    /// resetting resources, every layer goes back to the
+    /// pool right after its last use, so the layers below
+    /// reuse it.
     {
         usmMapLast.reset();
         usmMapCurrent.reset();
+        backBuffer.reset();
+        compositeBuffer.reset();
+        blurCompositeBack.reset();
+    }
+
+    if( libgraphics::isCurrentOperationCancelled() ) {
+        return;
     }
 
     /**
@@ -149,7 +193,7 @@ void cascadedSharpen_GEN(
         gl_FragColor   = factor * (basePixel - temp) + (1.0 - factor) * basePixel; */
 
     const float factor = 1.0f - std::max( threshold / 100.0f, 0.01f );//1.0f / ( ( this->m_Threshold / 100.0f ) + 0.05f );
-    std::unique_ptr<libgraphics::ImageLayer> thresholdMap( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer thresholdMap( device, source );
     {
         libgraphics::fx::operations::multiply(
             thresholdMap.get(),
@@ -157,9 +201,10 @@ void cascadedSharpen_GEN(
             area,
             factor
         );
+        blurCompositeFront.reset();
     }
 
-    std::unique_ptr<libgraphics::ImageLayer> differenceMap( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer differenceMap( device, source );
     {
         libgraphics::fx::operations::grainExtract(
             differenceMap.get(),
@@ -167,9 +212,10 @@ void cascadedSharpen_GEN(
             frontBuffer.get(),
             area
         );
+        frontBuffer.reset();
     }
 
-    std::unique_ptr<libgraphics::ImageLayer> basePixelDst( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer basePixelDst( device, source );
     {
         libgraphics::fx::operations::multiply(
             basePixelDst.get(),
@@ -177,18 +223,20 @@ void cascadedSharpen_GEN(
             thresholdMap.get(),
             area
         );
+        differenceMap.reset();
     } /** ==> factor * (basePixel - temp) */
 
-    std::unique_ptr<libgraphics::ImageLayer> negatedThresholdMap( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer negatedThresholdMap( device, source );
     {
         libgraphics::fx::operations::negate(
             negatedThresholdMap.get(),
             thresholdMap.get(),
             area
         );
+        thresholdMap.reset();
     }
 
-    std::unique_ptr<libgraphics::ImageLayer> negatedBasePixelDst( makeImageLayer( device, "default", source->format(), source->width(), source->height() ) );
+    ScopedScratchLayer negatedBasePixelDst( device, source );
     {
         libgraphics::fx::operations::multiply(
             negatedBasePixelDst.get(),
@@ -196,6 +244,7 @@ void cascadedSharpen_GEN(
             negatedThresholdMap.get(),
             area
         );
+        negatedThresholdMap.reset();
     } // ==> (1.0 - factor) * basePixel;
 
     libgraphics::fx::operations::add(
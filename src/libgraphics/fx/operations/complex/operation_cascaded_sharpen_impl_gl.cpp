@@ -270,10 +270,10 @@ void cascadedSharpenWith4_GL(
 
     filter->threshold       = threshold;
 
-    filter->blurred0        = ( backend::gl::ImageObject* )blurred0->internalImageForBackend( FXAPI_BACKEND_OPENGL );
-    filter->blurred1        = ( backend::gl::ImageObject* )blurred1->internalImageForBackend( FXAPI_BACKEND_OPENGL );
-    filter->blurred2        = ( backend::gl::ImageObject* )blurred2->internalImageForBackend( FXAPI_BACKEND_OPENGL );
-    filter->blurred3        = ( backend::gl::ImageObject* )blurred3->internalImageForBackend( FXAPI_BACKEND_OPENGL );
+    filter->blurred0        = ( backend::gl::ImageObject* )blurred0->sourceImageForBackend( FXAPI_BACKEND_OPENGL );
+    filter->blurred1        = ( backend::gl::ImageObject* )blurred1->sourceImageForBackend( FXAPI_BACKEND_OPENGL );
+    filter->blurred2        = ( backend::gl::ImageObject* )blurred2->sourceImageForBackend( FXAPI_BACKEND_OPENGL );
+    filter->blurred3        = ( backend::gl::ImageObject* )blurred3->sourceImageForBackend( FXAPI_BACKEND_OPENGL );
 
     filter->intensity0      = intensity0;
     filter->intensity1      = intensity1;
@@ -0,0 +1,377 @@
+
+
+#include <libgraphics/fx/operations/complex.hpp>
+#include <libgraphics/fx/operations/complex/cpu.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/backend/cpu/cpu_scheduler.hpp>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+/// extended box kernel (Gwosdek et al.): a box of
+/// 2 * radius + 1 taps plus one tap of weight alpha
+/// on each side. the pass count and the variance of the
+/// kernel of gaussianBlur() define radius and alpha.
+struct kernel_box_blur_pack {
+    static const int passes = 4;
+
+    int     radius;
+    float   alpha;
+    float   norm;
+
+    explicit kernel_box_blur_pack( float gaussianRadius ) {
+        /** gaussianBlur() weights are exp( -x^2 / ( 1.141 * radius ) ) */
+        const float variance = ( 1.141f * gaussianRadius * 0.5f ) / ( float )passes;
+
+        radius  = ( int )std::floor( ( std::sqrt( 1.0f + 12.0f * variance ) - 1.0f ) * 0.5f );
+        alpha   = ( float )( 2 * radius + 1 ) * ( ( float )( radius * ( radius + 1 ) ) / 3.0f - variance ) /
+                  ( 2.0f * ( variance - ( float )( ( radius + 1 ) * ( radius + 1 ) ) ) );
+        norm    = 1.0f / ( ( float )( 2 * radius + 1 ) + 2.0f * alpha );
+    }
+
+    /// number of samples next to an output sample,
+    /// which all passes together read.
+    int halo() const {
+        return passes * ( radius + 1 );
+    }
+};
+
+/// window of a line of length samples, which the passes
+/// read to blur the samples first .. first + count. the
+/// window wraps around like the line, it covers the whole
+/// line if the halos overlap.
+struct box_blur_window {
+    int     first;
+    int     length;
+
+    box_blur_window( int _first, int count, int lineLength, const kernel_box_blur_pack& box ) {
+        first   = _first - box.halo();
+        length  = count + 2 * box.halo();
+
+        if( length >= lineLength ) {
+            first   = 0;
+            length  = lineLength;
+        }
+    }
+
+    /// index of the window sample in the line
+    static int lineIndex( int index, int lineLength ) {
+        index %= lineLength;
+        return ( index < 0 ) ? index + lineLength : index;
+    }
+};
+
+/// blurs length samples of lanes interleaved floats, the
+/// samples wrap around like in gaussianBlur(). source and
+/// destination must not overlap, sums holds lanes floats.
+void boxBlurLine(
+    float* __restrict destination,
+    const float* __restrict source,
+    float* __restrict sums,
+    int length,
+    size_t lanes,
+    const kernel_box_blur_pack& box
+) {
+    const bool fastWrap = ( length > 2 * ( box.radius + 1 ) );
+
+    const auto wrap = [length, fastWrap]( int index ) {
+        if( fastWrap ) {
+            return ( index < 0 ) ? index + length : ( ( index >= length ) ? index - length : index );
+        }
+
+        index %= length;
+        return ( index < 0 ) ? index + length : index;
+    };
+
+    std::fill( sums, sums + lanes, 0.0f );
+
+    for( int k = -box.radius; box.radius >= k; ++k ) {
+        const float* sample = source + ( ( size_t )wrap( k ) * lanes );
+
+        for( size_t n = 0; lanes > n; ++n ) {
+            sums[n] += sample[n];
+        }
+    }
+
+    for( int i = 0; length > i; ++i ) {
+        const float* outerLeft  = source + ( ( size_t )wrap( i - box.radius - 1 ) * lanes );
+        const float* outerRight = source + ( ( size_t )wrap( i + box.radius + 1 ) * lanes );
+        const float* innerLeft  = source + ( ( size_t )wrap( i - box.radius ) * lanes );
+        float*       output     = destination + ( ( size_t )i * lanes );
+
+        for( size_t n = 0; lanes > n; ++n ) {
+            output[n]  = ( sums[n] + box.alpha * ( outerLeft[n] + outerRight[n] ) ) * box.norm;
+            sums[n]   += outerRight[n] - innerLeft[n];
+        }
+    }
+}
+
+/// runs all box passes, returns the buffer
+/// containing the result.
+float* boxBlurLines(
+    float* front,
+    float* back,
+    float* sums,
+    int length,
+    size_t lanes,
+    const kernel_box_blur_pack& box
+) {
+    for( int pass = 0; kernel_box_blur_pack::passes > pass; ++pass ) {
+        boxBlurLine( back, front, sums, length, lanes, box );
+        std::swap( front, back );
+    }
+
+    return front;
+}
+
+template < class _t_pixel_type >
+inline _t_pixel_type storeBoxBlurValue( float value, std::true_type /* integral */ ) {
+    const float maxValue = ( float )std::numeric_limits<_t_pixel_type>::max();
+    return ( _t_pixel_type )std::max( 0.0f, std::min( maxValue, std::ceil( value ) ) );
+}
+template < class _t_pixel_type >
+inline _t_pixel_type storeBoxBlurValue( float value, std::false_type /* floating point */ ) {
+    return ( _t_pixel_type )value;
+}
+
+/// horizontal pass, every row of the tile is blurred
+/// over the window of the tile columns.
+template < class _t_pixel_type, size_t _channels >
+void kernel_horizontal_box_blur(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_box_blur_pack& box
+) {
+    typedef typename std::is_integral<_t_pixel_type>::type IsIntegral;
+    ( void )device;
+
+    const int               width = ( int )source->width();
+    const box_blur_window   window( area.x, area.width, width, box );
+    const size_t            windowLength = ( size_t )window.length * _channels;
+    const size_t            offset = ( size_t )( area.x - window.first ) * _channels;
+
+    std::vector<float> buffer( windowLength * 2 + _channels );
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        const _t_pixel_type* __restrict srcRow = ( const _t_pixel_type* )source->data() + ( ( size_t )y * width * _channels );
+        _t_pixel_type* __restrict dstRow = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + area.x ) * _channels );
+
+        for( int x = 0; window.length > x; ++x ) {
+            const _t_pixel_type* srcPixel = srcRow + ( ( size_t )box_blur_window::lineIndex( window.first + x, width ) * _channels );
+
+            for( size_t n = 0; _channels > n; ++n ) {
+                buffer[( size_t )x * _channels + n] = ( float )srcPixel[n];
+            }
+        }
+
+        const float* result = boxBlurLines(
+                                  buffer.data(),
+                                  buffer.data() + windowLength,
+                                  buffer.data() + windowLength * 2,
+                                  window.length,
+                                  _channels,
+                                  box
+                              ) + offset;
+
+        for( size_t n = 0; ( size_t )area.width * _channels > n; ++n ) {
+            dstRow[n] = storeBoxBlurValue<_t_pixel_type>( result[n], IsIntegral() );
+        }
+    }
+}
+
+/// vertical pass, the tile is a column strip that is
+/// blurred over the window of its rows. the strip columns
+/// are the lanes of the line, so every step reads and
+/// writes contiguous memory.
+template < class _t_pixel_type, size_t _channels >
+void kernel_vertical_box_blur(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_box_blur_pack& box
+) {
+    typedef typename std::is_integral<_t_pixel_type>::type IsIntegral;
+    ( void )device;
+
+    const int               height  = ( int )source->height();
+    const box_blur_window   window( area.y, area.height, height, box );
+    const size_t            lanes   = ( size_t )area.width * _channels;
+    const size_t            windowLength = ( size_t )window.length * lanes;
+
+    std::vector<float> buffer( windowLength * 2 + lanes );
+
+    for( int y = 0; window.length > y; ++y ) {
+        const size_t sourceRow = ( size_t )box_blur_window::lineIndex( window.first + y, height );
+        const _t_pixel_type* __restrict srcPixel = ( const _t_pixel_type* )source->data() + ( ( sourceRow * source->width() + area.x ) * _channels );
+        float* line = buffer.data() + ( ( size_t )y * lanes );
+
+        for( size_t n = 0; lanes > n; ++n ) {
+            line[n] = ( float )srcPixel[n];
+        }
+    }
+
+    const float* result = boxBlurLines(
+                              buffer.data(),
+                              buffer.data() + windowLength,
+                              buffer.data() + windowLength * 2,
+                              window.length,
+                              lanes,
+                              box
+                          );
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* __restrict dstPixel = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + area.x ) * _channels );
+        const float* line = result + ( ( size_t )( y - window.first ) * lanes );
+
+        for( size_t n = 0; lanes > n; ++n ) {
+            dstPixel[n] = storeBoxBlurValue<_t_pixel_type>( line[n], IsIntegral() );
+        }
+    }
+}
+
+template < class _t_pixel_type, size_t _channels >
+void executeFastGaussianBlur(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* destination,
+    libgraphics::fxapi::ApiImageObject* source,
+    Rect32I area,
+    const kernel_box_blur_pack& box
+) {
+    static const size_t stripWidth = 16;
+
+    libgraphics::fxapi::ApiScopedImgRef    temporaryLayer(
+        device,
+        destination->format(),
+        destination->width(),
+        destination->height()
+    );
+
+    /// the vertical pass reads the window of rows around
+    /// the area, which may wrap around the image borders.
+    const int               height = ( int )source->height();
+    const box_blur_window   rows( area.y, area.height, height, box );
+    Rect32I                 rowRanges[2];
+
+    if( rows.first < 0 ) {
+        rowRanges[0] = Rect32I( area.x, 0, area.width, rows.first + rows.length );
+        rowRanges[1] = Rect32I( area.x, height + rows.first, area.width, -rows.first );
+    } else if( ( rows.first + rows.length ) > height ) {
+        rowRanges[0] = Rect32I( area.x, rows.first, area.width, height - rows.first );
+        rowRanges[1] = Rect32I( area.x, 0, area.width, rows.first + rows.length - height );
+    } else {
+        rowRanges[0] = Rect32I( area.x, rows.first, area.width, rows.length );
+    }
+
+    for( size_t i = 0; 2 > i; ++i ) {
+        if( rowRanges[i].height <= 0 ) {
+            continue;
+        }
+
+        fx::operations::cpuExecuteTileBased(
+            device,
+            ( backend::cpu::ImageObject* )temporaryLayer.img(),
+            ( backend::cpu::ImageObject* )source,
+            rowRanges[i],
+            std::bind(
+                &kernel_horizontal_box_blur<_t_pixel_type, _channels>,
+                std::placeholders::_1,
+                std::placeholders::_2,
+                std::placeholders::_3,
+                std::placeholders::_4,
+                box
+            ),
+            backend::cpu::TileHints( destination->format(), 2, true )
+        );
+    }
+
+    backend::cpu::ImageObject* verticalDestination  = ( backend::cpu::ImageObject* )destination;
+    backend::cpu::ImageObject* verticalSource       = ( backend::cpu::ImageObject* )temporaryLayer.img();
+
+    backend::cpu::TileBatch batch(
+        area,
+        stripWidth,
+        ( size_t )area.height,
+    [device, verticalDestination, verticalSource, &box]( const libgraphics::Rect32I & strip ) {
+        kernel_vertical_box_blur<_t_pixel_type, _channels>(
+            device,
+            verticalDestination,
+            verticalSource,
+            strip,
+            box
+        );
+    }
+    );
+
+    static_cast<backend::cpu::BackendDevice*>( device )->scheduler()->run( batch );
+}
+
+void fastGaussianBlur_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* destination,
+    libgraphics::fxapi::ApiImageObject* source,
+    Rect32I area,
+    float radius
+) {
+    assert( device );
+    assert( source );
+    assert( destination->format() == source->format() );
+
+    const kernel_box_blur_pack box( radius );
+
+    switch( destination->format() ) {
+        case fxapi::EPixelFormat::Mono8:
+            executeFastGaussianBlur<unsigned char, 1>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::Mono16:
+            executeFastGaussianBlur<unsigned short, 1>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::Mono32F:
+            executeFastGaussianBlur<float, 1>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::RGB8:
+            executeFastGaussianBlur<unsigned char, 3>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::RGB16:
+            executeFastGaussianBlur<unsigned short, 3>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::RGB32F:
+            executeFastGaussianBlur<float, 3>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::RGBA8:
+            executeFastGaussianBlur<unsigned char, 4>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::RGBA16:
+            executeFastGaussianBlur<unsigned short, 4>( device, destination, source, area, box );
+            break;
+
+        case fxapi::EPixelFormat::RGBA32F:
+            executeFastGaussianBlur<float, 4>( device, destination, source, area, box );
+            break;
+
+        default:
+
+            throw std::runtime_error(
+                "Error: unknown or incompatible pixel format!"
+            );
+    }
+}
+
+}
+}
+}
@@ -34,9 +34,9 @@ void filmgrain(
         filmgrain_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
-            grainLayer->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            grainLayer->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             curveData,
             isMonoGrain
         );
@@ -51,9 +51,9 @@ void filmgrain(
         filmgrain_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
-            grainLayer->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            grainLayer->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             curveData,
             isMonoGrain
         );
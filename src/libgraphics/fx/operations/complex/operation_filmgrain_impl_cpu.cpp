@@ -9,6 +9,10 @@
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
 namespace libgraphics {
 namespace fx {
 namespace operations {
@@ -44,9 +48,9 @@ void cpuFilmgrain(
                                     destination->format()
                                 );
 
-    assert( channelCount >= 3 );
+    assert( ( channelCount == 1 ) || ( channelCount >= 3 ) );
 
-    if( channelCount < 3 ) {
+    if( channelCount == 2 ) {
         return;
     }
 
@@ -60,6 +64,18 @@ void cpuFilmgrain(
         _t_pixel_type* ptrSrcPixel = ( _t_pixel_type* )( ( ( char* )sourceBuffer ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength );
         _t_pixel_type* ptrNoisePixel = ( _t_pixel_type* )( ( ( char* )noiseBuffer ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength );
 
+        if( channelCount == 1 ) {
+            /** single channel working format, see FilterChain **/
+            const float     realValue   = MapToFloat( maxValue, *ptrSrcPixel );
+            const size_t    index       = MapFloat( maxValue, realValue );
+            const float     value       = MapToFloat( maxValue, *ptrNoisePixel );
+            const float     weight      = params.curveData[index];
+            const float     wh          = math::overlay( math::Color3f( realValue ), math::Color3f( value ) ).r;
+
+            *ptrDstPixel = MapFloat( maxValue, std::min<float>( 1.0f, std::max<float>( 0.0f, ( realValue * ( 1.0f - weight ) ) + ( wh * weight ) ) ) );
+            continue;
+        }
+
         math::Color3f   realColor   = GetColor3f( maxValue, ptrSrcPixel );
         const size_t    index       = MapFloat( maxValue, realColor.r );
         const float     value       = GetColor3f( maxValue, ptrNoisePixel ).r;
@@ -95,6 +111,7 @@ void filmgrain_CPU(
     switch( dst->format() ) {
         case fxapi::EPixelFormat::RGB16S:
         case fxapi::EPixelFormat::RGBA16S:
+        case fxapi::EPixelFormat::Mono16S:
             fx::operations::cpuExecuteTileBased(
                 device,
                 ( backend::cpu::ImageObject* )dst,
@@ -113,6 +130,7 @@ void filmgrain_CPU(
 
         case fxapi::EPixelFormat::RGB32F:
         case fxapi::EPixelFormat::RGBA32F:
+        case fxapi::EPixelFormat::Mono32F:
             fx::operations::cpuExecuteTileBased(
                 device,
                 ( backend::cpu::ImageObject* )dst,
@@ -132,6 +150,7 @@ void filmgrain_CPU(
 
         case fxapi::EPixelFormat::RGB8:
         case fxapi::EPixelFormat::RGBA8:
+        case fxapi::EPixelFormat::Mono8:
             fx::operations::cpuExecuteTileBased(
                 device,
                 ( backend::cpu::ImageObject* )dst,
@@ -150,6 +169,7 @@ void filmgrain_CPU(
 
         case fxapi::EPixelFormat::RGB16:
         case fxapi::EPixelFormat::RGBA16:
+        case fxapi::EPixelFormat::Mono16:
             fx::operations::cpuExecuteTileBased(
                 device,
                 ( backend::cpu::ImageObject* )dst,
@@ -174,6 +194,145 @@ void filmgrain_CPU(
     }
 }
 
+/// the per pixel weights of filmgrain_GEN, stored like
+/// adjustBrightness() stores them. indexed by the source value.
+template < class _t_pixel_type >
+struct kernel_filmgrain_composite_pack {
+    libgraphics::backend::cpu::ImageObject*                 grainLayer;
+    std::shared_ptr<const std::vector<_t_pixel_type> >      weights;
+
+    kernel_filmgrain_composite_pack(
+        libgraphics::backend::cpu::ImageObject* _grainLayer,
+        const std::vector<float>& curveData
+    ) : grainLayer( _grainLayer ) {
+        const size_t    valueCount  = ( size_t )std::numeric_limits<_t_pixel_type>::max() + 1;
+        const double    maxValue    = ( double )std::numeric_limits<_t_pixel_type>::max();
+
+        assert( !curveData.empty() );
+
+        std::shared_ptr<std::vector<_t_pixel_type> > values( new std::vector<_t_pixel_type>( valueCount, 0 ) );
+
+        for( size_t i = 0; valueCount > i; ++i ) {
+            const float adjustment = curveData.empty() ? 0.0f : curveData[std::min( i, curveData.size() - 1 )];
+            ( *values )[i] = ( _t_pixel_type )std::max<double>( 0, std::min<double>( maxValue * adjustment, maxValue ) );
+        }
+
+        weights = values;
+    }
+};
+
+/// computes
+///     weighted    = adjustBrightness( source, curve )
+///     destination = source * negate( weighted ) + overlay( source, grain ) * weighted
+/// with the rounding of the basic operations, but without
+/// the intermediate layers.
+template < class _t_pixel_type >
+void kernel_filmgrain_composite(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_filmgrain_composite_pack<_t_pixel_type>& params
+) {
+    ( void )device;
+
+    const int           maxValue    = std::numeric_limits<_t_pixel_type>::max();
+    const float         maxFloat    = ( float )maxValue;
+    const size_t        channels    = libgraphics::fxapi::EPixelFormat::getChannelCount( destination->format() );
+    const size_t        rowLength   = ( size_t )area.width * channels;
+    const _t_pixel_type* weights    = params.weights->data();
+
+    const auto clampValue = [maxValue]( int value ) {
+        return std::max( 0, std::min( maxValue, value ) );
+    };
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() ) + area.x ) * channels;
+        const _t_pixel_type* srcRow = ( const _t_pixel_type* )source->data() + ( ( ( size_t )y * source->width() ) + area.x ) * channels;
+        const _t_pixel_type* grainRow = ( const _t_pixel_type* )params.grainLayer->data() + ( ( ( size_t )y * params.grainLayer->width() ) + area.x ) * channels;
+
+        for( size_t i = 0; rowLength > i; ++i ) {
+            const int value     = srcRow[i];
+            const int grain     = grainRow[i];
+            const int weight    = weights[value];
+
+            /** op_overlay **/
+            const int overlay   = clampValue( ( int )std::ceil(
+                                                  ( float )( ( float )value / maxFloat ) *
+                                                  ( float )( ( float )value + ( ( 2.0f * ( float )grain ) / maxFloat ) * ( float )( maxValue - value ) )
+                                              ) );
+
+            /** op_mul, op_add **/
+            const int upper     = clampValue( ( int )std::ceil( ( float )value * ( ( float )( maxValue - weight ) / maxFloat ) ) );
+            const int lower     = clampValue( ( int )std::ceil( ( float )overlay * ( ( float )weight / maxFloat ) ) );
+
+            dstRow[i] = ( _t_pixel_type )std::min( maxValue, upper + lower );
+        }
+    }
+}
+
+template < class _t_pixel_type >
+void executeFilmgrainComposite(
+    libgraphics::fxapi::ApiBackendDevice*   device,
+    libgraphics::fxapi::ApiImageObject*     dst,
+    libgraphics::fxapi::ApiImageObject*     src,
+    Rect32I                                 area,
+    libgraphics::fxapi::ApiImageObject*     grainLayer,
+    const std::vector<float>&               curveData
+) {
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )dst,
+        ( backend::cpu::ImageObject* )src,
+        area,
+        std::bind(
+            &kernel_filmgrain_composite<_t_pixel_type>,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            kernel_filmgrain_composite_pack<_t_pixel_type>( ( backend::cpu::ImageObject* )grainLayer, curveData )
+        ),
+        backend::cpu::TileHints( dst->format(), 3, false )
+    );
+}
+
+void filmgrainComposite_CPU(
+    libgraphics::fxapi::ApiBackendDevice*   device,
+    libgraphics::fxapi::ApiImageObject*     dst,
+    libgraphics::fxapi::ApiImageObject*     src,
+    Rect32I                                 area,
+    libgraphics::fxapi::ApiImageObject*     grainLayer,
+    const std::vector<float>&               curveData
+) {
+    assert( device != nullptr );
+    assert( dst != nullptr );
+    assert( src != nullptr );
+    assert( grainLayer != nullptr );
+    assert( dst->format() == src->format() );
+    assert( grainLayer->format() == src->format() );
+
+    switch( dst->format() ) {
+        case fxapi::EPixelFormat::Mono8:
+        case fxapi::EPixelFormat::RGB8:
+        case fxapi::EPixelFormat::RGBA8:
+            executeFilmgrainComposite<unsigned char>( device, dst, src, area, grainLayer, curveData );
+            break;
+
+        case fxapi::EPixelFormat::Mono16:
+        case fxapi::EPixelFormat::RGB16:
+        case fxapi::EPixelFormat::RGBA16:
+            executeFilmgrainComposite<unsigned short>( device, dst, src, area, grainLayer, curveData );
+            break;
+
+        default:
+            assert( false );
+            throw std::runtime_error(
+                "Error: unknown or incompatible pixel format!"
+            );
+    }
+}
+
 }
 }
 }
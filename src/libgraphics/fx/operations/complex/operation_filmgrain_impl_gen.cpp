@@ -4,10 +4,12 @@
 #include <math.h>
 
 #include <libgraphics/image.hpp>
+#include <libgraphics/scratchlayerpool.hpp>
 
 #include <libgraphics/fx/operations/basic.hpp>
 #include <libgraphics/fx/operations/complex.hpp>
 #include <libgraphics/fx/operations/complex/gen.hpp>
+#include <libgraphics/fx/operations/complex/cpu.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -24,8 +26,48 @@ void filmgrain_GEN(
 ) {
     ( void )isMonoGrain;
 
-    std::unique_ptr<ImageLayer> grainOverlay( makeImageLayer( device, destination ) );
-    std::unique_ptr<ImageLayer> weightedLayer( makeImageLayer( device, destination ) );
+    /// the cpu backend computes the chain below in one pass
+    /// without the five intermediate layers. other formats
+    /// keep using the layer chain.
+    if( ( device->backendId() == FXAPI_BACKEND_CPU ) && destination->containsDataForBackend( FXAPI_BACKEND_CPU ) && source->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+        bool supported( false );
+
+        switch( source->format() ) {
+            case fxapi::EPixelFormat::Mono8:
+            case fxapi::EPixelFormat::RGB8:
+            case fxapi::EPixelFormat::RGBA8:
+            case fxapi::EPixelFormat::Mono16:
+            case fxapi::EPixelFormat::RGB16:
+            case fxapi::EPixelFormat::RGBA16:
+                supported = true;
+                break;
+
+            default:
+                break;
+        }
+
+        supported = supported && ( destination->format() == source->format() ) && ( grainLayer->format() == source->format() );
+
+        if( supported ) {
+            if( !grainLayer->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+                grainLayer->updateDataForBackend( destination->internalDeviceForBackend( FXAPI_BACKEND_CPU ), FXAPI_BACKEND_CPU );
+            }
+
+            filmgrainComposite_CPU(
+                destination->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
+                destination->internalImageForBackend( FXAPI_BACKEND_CPU ),
+                source->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+                area,
+                grainLayer->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+                curveData
+            );
+
+            return;
+        }
+    }
+
+    ScopedScratchLayer grainOverlay( device, destination );
+    ScopedScratchLayer weightedLayer( device, destination );
     {
         libgraphics::fx::operations::adjustBrightness(
             weightedLayer.get(),
@@ -42,7 +84,7 @@ void filmgrain_GEN(
         );
     }
 
-    std::unique_ptr<ImageLayer> negatedWeightedLayer( makeImageLayer( device, destination ) );
+    ScopedScratchLayer negatedWeightedLayer( device, destination );
     {
         libgraphics::fx::operations::negate(
             negatedWeightedLayer.get(),
@@ -51,7 +93,7 @@ void filmgrain_GEN(
         );
     }
 
-    std::unique_ptr<ImageLayer> upperLayer( makeImageLayer( device, destination ) );
+    ScopedScratchLayer upperLayer( device, destination );
     {
         libgraphics::fx::operations::multiply(
             upperLayer.get(),
@@ -61,7 +103,7 @@ void filmgrain_GEN(
         );
     }
 
-    std::unique_ptr<ImageLayer> lowerLayer( makeImageLayer( device, destination ) );
+    ScopedScratchLayer lowerLayer( device, destination );
     {
         libgraphics::fx::operations::multiply(
             lowerLayer.get(),
@@ -5,6 +5,9 @@
 
 #include <QDebug>
 
+#include <algorithm>
+#include <cmath>
+
 namespace libgraphics {
 namespace fx {
 namespace operations {
@@ -27,7 +30,7 @@ void gaussianBlur(
         gaussianBlur_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             radius
         );
@@ -38,7 +41,47 @@ void gaussianBlur(
         gaussianBlur_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
+            area,
+            radius
+        );
+        rendered = true;
+    }
+
+    assert( rendered );
+    ( void ) rendered;
+}
+
+void fastGaussianBlur(
+    fxapi::ApiBackendDevice* backend,
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area,
+    float radius
+) {
+    assert( dst );
+    assert( src );
+    assert( !dst->empty() );
+    assert( !src->empty() );
+
+    bool rendered( false );
+
+    if( ( backend->backendId() == FXAPI_BACKEND_CPU ) && dst->containsDataForBackend( FXAPI_BACKEND_CPU ) && src->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+        fastGaussianBlur_CPU(
+            dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
+            dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            area,
+            radius
+        );
+        rendered = true;
+    }
+
+    if( ( backend->backendId() == FXAPI_BACKEND_OPENGL ) && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+        gaussianBlur_GL(
+            dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
+            dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             radius
         );
@@ -67,7 +110,7 @@ void verticalGaussianBlur(
         verticalGaussianBlur_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             radius
         );
@@ -78,7 +121,7 @@ void verticalGaussianBlur(
         verticalGaussianBlur_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             radius
         );
@@ -107,7 +150,7 @@ void horizontalGaussianBlur(
         horizontalGaussianBlur_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             area,
             radius
         );
@@ -118,7 +161,7 @@ void horizontalGaussianBlur(
         horizontalGaussianBlur_GL(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
-            src->internalImageForBackend( FXAPI_BACKEND_OPENGL ),
+            src->sourceImageForBackend( FXAPI_BACKEND_OPENGL ),
             area,
             radius
         );
@@ -129,6 +172,43 @@ void horizontalGaussianBlur(
     ( void ) rendered;
 }
 
+int gaussianBlurHalo( float radius ) {
+    /** the kernel has 4 * ceil( radius ) + 1 taps, the box blur
+        approximation reads less */
+    return 2 * ( int )std::ceil( std::max( radius, 0.0f ) );
+}
+
+namespace {
+void expandAxis( int& begin, int& length, int halo, int size ) {
+    if( ( begin - halo ) < 0 || ( begin + length + halo ) > size ) {
+        begin   = 0;
+        length  = size;
+        return;
+    }
+
+    begin   -= halo;
+    length  += 2 * halo;
+}
+}
+
+Rect32I expandArea(
+    const Rect32I& area,
+    int halo,
+    size_t width,
+    size_t height
+) {
+    assert( halo >= 0 );
+
+    Rect32I expanded( area );
+
+    if( halo > 0 ) {
+        expandAxis( expanded.x, expanded.width, halo, ( int )width );
+        expandAxis( expanded.y, expanded.height, halo, ( int )height );
+    }
+
+    return expanded;
+}
+
 }
 }
 }
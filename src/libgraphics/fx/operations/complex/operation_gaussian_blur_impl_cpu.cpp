@@ -6,12 +6,42 @@
 #include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
 
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
 #include <QDebug>
 
 namespace libgraphics {
 namespace fx {
 namespace operations {
 
+/// normalized 1d gaussian kernel, built once per
+/// blur pass and shared by all tiles.
+struct gaussian_blur_kernel {
+    std::vector<float>  weights;
+    int                 halfSize;
+
+    explicit gaussian_blur_kernel( float radius ) {
+        const int   size    = 4 * ( int )std::ceil( radius ) + 1;
+        const float div     = radius * 1.141f;
+        float       sum( 0.0f );
+
+        halfSize = size / 2;
+        weights.resize( size );
+
+        for( int i = 0; size > i; ++i ) {
+            const int mx = i - halfSize;
+            weights[i] = std::exp( -( float )( mx * mx ) / div );
+            sum += weights[i];
+        }
+
+        for( int i = 0; size > i; ++i ) {
+            weights[i] /= sum;
+        }
+    }
+};
+
 struct kernel_gaussian_blur_pack {
     enum dir {
         vertical,
@@ -20,358 +50,222 @@ struct kernel_gaussian_blur_pack {
 
     kernel_gaussian_blur_pack(
         dir _dir,
-        float _radius
-    ) : direction( _dir ), radius( _radius ) {}
+        const std::shared_ptr<const gaussian_blur_kernel>& _kernel
+    ) : direction( _dir ), kernel( _kernel ) {}
 
-    const float radius;
     const dir direction;
+    const std::shared_ptr<const gaussian_blur_kernel> kernel;
 };
 
+/// pixels outside of the image wrap around to the
+/// opposite border.
+inline int wrapGaussianIndex( int index, int length ) {
+    index %= length;
+    return ( index < 0 ) ? index + length : index;
+}
+
+template < class _t_pixel_type >
+inline _t_pixel_type storeGaussianValue( float value, std::true_type /* integral */ ) {
+    const float maxValue = ( float )std::numeric_limits<_t_pixel_type>::max();
+    return ( _t_pixel_type )std::max( 0.0f, std::min( maxValue, std::ceil( value ) ) );
+}
 template < class _t_pixel_type >
-void kernel_fixed_gaussian_blur(
+inline _t_pixel_type storeGaussianValue( float value, std::false_type /* floating point */ ) {
+    return ( _t_pixel_type )value;
+}
+
+/// horizontal pass, walks the rows of the tile with
+/// pointers. only the pixels closer than halfSize to the
+/// image border need the wrapped lookup.
+template < class _t_pixel_type, size_t _channels >
+void kernel_horizontal_gaussian_blur(
     libgraphics::fxapi::ApiBackendDevice* device,
     libgraphics::backend::cpu::ImageObject*   destination,
     libgraphics::backend::cpu::ImageObject*   source,
     libgraphics::Rect32I area,
-    kernel_gaussian_blur_pack parameters
+    const kernel_gaussian_blur_pack& parameters
 ) {
+    typedef typename std::is_integral<_t_pixel_type>::type IsIntegral;
     ( void )device;
 
-    void*   destinationBuffer = destination->data();
-    void*   sourceBuffer = source->data();
-
-    size_t pixelLength = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                             destination->format()
-                         );
-    size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                              destination->format()
-                          );
-
-    float* values = new float[channelCount];
-    memset( ( void* )values, 0, sizeof( float ) * channelCount );
-
-    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
-    const float sigmaSquared = ( parameters.radius * 1.141f );
-
-    /// construct and normalize gaussian kernel.
-    const int kernelLength = ceil( parameters.radius ) * 4 + 1;
-    float* linearKernel = new float[kernelLength];
-    float sum( 0.0f );
-
-    {
-        for( size_t i = 0; kernelLength > i; ++i ) {
-            const int centeredIndex = ( int )i - ( kernelLength / 2 );
-            linearKernel[i] = exp( -( centeredIndex * centeredIndex ) / sigmaSquared );
-            sum += linearKernel[i];
-        }
-
-        for( size_t i = 0; kernelLength > i; ++i ) {
-            linearKernel[i] /= sum;
-        }
-    }
+    const int       width       = ( int )source->width();
+    const int       size        = ( int )parameters.kernel->weights.size();
+    const int       halfSize    = parameters.kernel->halfSize;
+    const float*    weights     = parameters.kernel->weights.data();
 
-    /// iterate over all pixels
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-        memset( ( void* )values, 0, sizeof( float ) * channelCount );
+    const int       innerBegin  = std::max( area.x, halfSize );
+    const int       innerEnd    = std::max( innerBegin, std::min( area.x + area.width, width - halfSize ) );
 
-        _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * destination->width() ) + x + area.x ) * pixelLength;
-        _t_pixel_type* srcPixel = ( _t_pixel_type* )( ( char* )sourceBuffer ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength;
-        ( void )srcPixel;
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        const _t_pixel_type* __restrict srcRow = ( const _t_pixel_type* )source->data() + ( ( size_t )y * width * _channels );
+        _t_pixel_type* __restrict dstRow = ( _t_pixel_type* )destination->data() + ( ( size_t )y * destination->width() * _channels );
 
-        for( int i = 0; kernelLength > i; ++i ) {
-            const int centeredIndex = i - ( kernelLength / 2 );
+        for( int x = area.x; ( area.x + area.width ) > x; ++x ) {
+            float values[_channels] = { 0.0f };
 
-            int px( area.x + x );
-            int py( area.y + y );
+            if( x >= innerBegin && x < innerEnd ) {
+                const _t_pixel_type* tap = srcRow + ( ( size_t )( x - halfSize ) * _channels );
 
-            if( kernel_gaussian_blur_pack::horizontal == parameters.direction ) {
-                px += centeredIndex;
-
-                if( px >= ( int )source->width() ) {
-                    px = px - ( int )source->width();
-                } else if( px < 0 ) {
-                    px = ( int )source->width() - abs( px );
+                for( int i = 0; size > i; ++i, tap += _channels ) {
+                    for( size_t n = 0; _channels > n; ++n ) {
+                        values[n] += ( float )tap[n] * weights[i];
+                    }
                 }
             } else {
-                py += centeredIndex;
+                for( int i = 0; size > i; ++i ) {
+                    const _t_pixel_type* tap = srcRow + ( ( size_t )wrapGaussianIndex( x + i - halfSize, width ) * _channels );
 
-                if( py >= ( int )source->height() ) {
-                    py = py - ( int )source->height();
-                } else if( py < 0 ) {
-                    py = ( int )source->height() - abs( py );
+                    for( size_t n = 0; _channels > n; ++n ) {
+                        values[n] += ( float )tap[n] * weights[i];
+                    }
                 }
             }
 
-            _t_pixel_type* pixel = ( _t_pixel_type* )( ( ( char* )sourceBuffer ) + ( ( ( ( py ) * source->width() ) + px ) * pixelLength ) );
+            _t_pixel_type* dstPixel = dstRow + ( ( size_t )x * _channels );
 
-            for( size_t n = 0; channelCount > n; ++n ) {
-                values[n] += *( pixel + n ) * linearKernel[i];
+            for( size_t n = 0; _channels > n; ++n ) {
+                dstPixel[n] = storeGaussianValue<_t_pixel_type>( values[n], IsIntegral() );
             }
         }
-
-        for( size_t n = 0; channelCount > n; ++n ) {
-            *( dstPixel + n ) = std::max<_t_pixel_type>( 0, std::min<int>( maxValue, ( int )std::ceil( values[n] ) ) );
-        }
-
     }
-
-    delete [] linearKernel;
-    delete [] values;
 }
 
-template < class _t_pixel_type >
-void kernel_horizontal_gaussian_blur_rgb(
+/// vertical pass, processed in column strips: the
+/// accumulators of one strip stay in L1 and the source rows
+/// of the strip are reused by the following output rows.
+template < class _t_pixel_type, size_t _channels >
+void kernel_vertical_gaussian_blur(
     libgraphics::fxapi::ApiBackendDevice* device,
     libgraphics::backend::cpu::ImageObject*   destination,
     libgraphics::backend::cpu::ImageObject*   source,
     libgraphics::Rect32I area,
-    kernel_gaussian_blur_pack parameters
+    const kernel_gaussian_blur_pack& parameters
 ) {
-    typedef libgraphics::BasicPixel<_t_pixel_type, 3> Pixel;
+    typedef typename std::is_integral<_t_pixel_type>::type IsIntegral;
     ( void )device;
 
-    void*   destinationBuffer = destination->data();
-    void*   sourceBuffer = source->data();
+    static const int stripWidth = 256;
 
-    const int size      = 4 * ceil( parameters.radius ) + 1;
-    const int halfSize  = size / 2;
-    const float div     = parameters.radius * 1.141f;
+    const int       width       = ( int )source->width();
+    const int       height      = ( int )source->height();
+    const int       size        = ( int )parameters.kernel->weights.size();
+    const int       halfSize    = parameters.kernel->halfSize;
+    const float*    weights     = parameters.kernel->weights.data();
 
-    float values[3] = {
-        0.0f,
-        0.0f,
-        0.0f
-    };
+    float values[stripWidth * _channels];
 
-    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+    for( int stripX = area.x; ( area.x + area.width ) > stripX; stripX += stripWidth ) {
+        const size_t stripLength = ( size_t )std::min( stripWidth, area.x + area.width - stripX ) * _channels;
 
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-        Pixel* dstPixel = ( ( Pixel* )destinationBuffer + ( ( area.y + y ) * destination->width() ) + x + area.x );
-
-        float sum = 0.0f;
-
-        for( int i = 0; size > i; ++i ) {
-            int mx = i - halfSize;
-            sum += exp( -( mx * mx ) / div );
-        }
+        for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+            std::fill( values, values + stripLength, 0.0f );
 
-        values[0] = 0.0f; values[1] = 0.0f; values[2] = 0.0f;
+            for( int i = 0; size > i; ++i ) {
+                const int py = wrapGaussianIndex( y + i - halfSize, height );
+                const float weight = weights[i];
+                const _t_pixel_type* __restrict tap = ( const _t_pixel_type* )source->data() + ( ( ( size_t )py * width + stripX ) * _channels );
 
-        for( int i = 0; size > i; ++i ) {
-            int mx = i - halfSize;
-            int px = area.x + x + mx;
-            int py = area.y + y;
-
-            if( px >= ( int )source->width() ) {
-                px = px - ( int )source->width();
-            } else if( px < 0 ) {
-                px = ( int )source->width() - abs( px );
+                for( size_t n = 0; stripLength > n; ++n ) {
+                    values[n] += ( float )tap[n] * weight;
+                }
             }
 
-            Pixel* pixel = ( ( Pixel* )sourceBuffer + ( ( py  * source->width() ) + px ) );
+            _t_pixel_type* __restrict dstPixel = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + stripX ) * _channels );
 
-
-            const auto fexpval = exp( -( mx * mx ) / div ) / sum;
-            {
-                values[0] += ( ( float )( *pixel ).Values[0] / maxValue ) * fexpval;
-                values[1] += ( ( float )( *pixel ).Values[1] / maxValue ) * fexpval;
-                values[2] += ( ( float )( *pixel ).Values[2] / maxValue ) * fexpval;
+            for( size_t n = 0; stripLength > n; ++n ) {
+                dstPixel[n] = storeGaussianValue<_t_pixel_type>( values[n], IsIntegral() );
             }
         }
-
-        ( *dstPixel ).Values[0] = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[0] ) ) );
-        ( *dstPixel ).Values[1] = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[1] ) ) );
-        ( *dstPixel ).Values[2] = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[2] ) ) );
     }
-
 }
 
-template < class _t_pixel_type >
-void kernel_vertical_gaussian_blur_rgb(
+template < class _t_pixel_type, size_t _channels >
+void executeGaussianBlurPass(
     libgraphics::fxapi::ApiBackendDevice* device,
-    libgraphics::backend::cpu::ImageObject*   destination,
-    libgraphics::backend::cpu::ImageObject*   source,
-    libgraphics::Rect32I area,
-    kernel_gaussian_blur_pack parameters
+    libgraphics::fxapi::ApiImageObject* destination,
+    libgraphics::fxapi::ApiImageObject* source,
+    Rect32I area,
+    const kernel_gaussian_blur_pack& parameters
 ) {
-    typedef libgraphics::BasicPixel<_t_pixel_type, 3> Pixel;
-    ( void )device;
-
-    void*   destinationBuffer = destination->data();
-    void*   sourceBuffer = source->data();
-
-    const int size      = 4 * ceil( parameters.radius ) + 1;
-    const int halfSize  = size / 2;
-    const float div     = parameters.radius * 1.141f;
-
-    float values[3] = {
-        0.0f,
-        0.0f,
-        0.0f
-    };
-
-    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
-
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-        Pixel* dstPixel = ( ( Pixel* )destinationBuffer + ( ( area.y + y ) * destination->width() ) + x + area.x );
-
-        float sum = 0.0f;
-
-        for( int i = 0; size > i; ++i ) {
-            int mx = i - halfSize;
-            sum += exp( -( mx * mx ) / div );
-        }
-
-        values[0] = 0.0f; values[1] = 0.0f; values[2] = 0.0f;
-
-        for( int i = 0; size > i; ++i ) {
-            int mx = i - halfSize;
-            int px = area.x + x;
-            int py = area.y + y + mx;
-
-            if( py >= ( int )source->height() ) {
-                py = py - ( int )source->height();
-            } else if( py < 0 ) {
-                py = ( int )source->height() - abs( py );
-            }
-
-            Pixel* pixel = ( ( Pixel* )sourceBuffer + ( ( py  * source->width() ) + px ) );
-
-
-            const auto fexpval = exp( -( mx * mx ) / div ) / sum;
-            {
-                values[0] += ( ( float )( *pixel ).Values[0] / maxValue ) * fexpval;
-                values[1] += ( ( float )( *pixel ).Values[1] / maxValue ) * fexpval;
-                values[2] += ( ( float )( *pixel ).Values[2] / maxValue ) * fexpval;
-            }
-        }
-
-        ( *dstPixel ).Values[0] = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[0] ) ) );
-        ( *dstPixel ).Values[1] = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[1] ) ) );
-        ( *dstPixel ).Values[2] = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[2] ) ) );
-    }
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )destination,
+        ( backend::cpu::ImageObject* )source,
+        area,
+        std::bind(
+            ( parameters.direction == kernel_gaussian_blur_pack::horizontal ) ?
+            &kernel_horizontal_gaussian_blur<_t_pixel_type, _channels> :
+            &kernel_vertical_gaussian_blur<_t_pixel_type, _channels>,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            parameters
+        ),
+        backend::cpu::TileHints( destination->format(), 2, true )
+    );
 }
 
-template < class _t_pixel_type >
-void kernel_directional_gaussian_blur(
+void executeGaussianBlurPass(
     libgraphics::fxapi::ApiBackendDevice* device,
-    libgraphics::backend::cpu::ImageObject*   destination,
-    libgraphics::backend::cpu::ImageObject*   source,
-    libgraphics::Rect32I area,
-    kernel_gaussian_blur_pack parameters
+    libgraphics::fxapi::ApiImageObject* destination,
+    libgraphics::fxapi::ApiImageObject* source,
+    Rect32I area,
+    kernel_gaussian_blur_pack::dir direction,
+    float radius
 ) {
-    ( void )device;
-
-    void*   destinationBuffer = destination->data();
-    void*   sourceBuffer = source->data();
-
-    size_t pixelLength = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                             destination->format()
-                         );
-    size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                              destination->format()
-                          );
-
-    const int size      = 4 * ceil( parameters.radius ) + 1;
-    const int halfSize  = size / 2;
-    const float div     = parameters.radius * 1.141f;
-
-    float* values = new float[channelCount];
-    memset( ( void* )values, 0, sizeof( float ) * channelCount );
-
-    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
-
-    for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
-        const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
-        const size_t x = ( p - ( y * ( int )area.width ) );
-
-        _t_pixel_type* dstPixel = ( _t_pixel_type* )( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * destination->width() ) + x + area.x ) * pixelLength;
-        _t_pixel_type* srcPixel = ( _t_pixel_type* )( ( char* )sourceBuffer ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength;
-        ( void )srcPixel;
-
-        float sum = 0.0f;
+    assert( destination->format() == source->format() );
 
-        for( int i = 0; size > i; ++i ) {
-            int mx = i - halfSize;
-            sum += exp( -( mx * mx ) / div );
-        }
+    const kernel_gaussian_blur_pack parameters(
+        direction,
+        std::make_shared<const gaussian_blur_kernel>( radius )
+    );
 
-        memset( ( void* )values, 0, sizeof( float ) * channelCount );
+    switch( destination->format() ) {
+        case fxapi::EPixelFormat::Mono8:
+            executeGaussianBlurPass<unsigned char, 1>( device, destination, source, area, parameters );
+            break;
 
-        if( parameters.direction ==  kernel_gaussian_blur_pack::horizontal ) {
-            for( int i = 0; size > i; ++i ) {
-                int mx = i - halfSize;
-                int px = area.x + x + mx;
-                int py = area.y + y;
-
-                if( px >= ( int )source->width() ) {
-                    px = px - ( int )source->width();
-                } else if( px < 0 ) {
-                    px = ( int )source->width() - abs( px );
-                }
+        case fxapi::EPixelFormat::Mono16:
+            executeGaussianBlurPass<unsigned short, 1>( device, destination, source, area, parameters );
+            break;
 
-                _t_pixel_type* pixel = ( _t_pixel_type* )( ( ( char* )sourceBuffer ) + ( ( ( ( py ) * source->width() ) + px ) * pixelLength ) );
+        case fxapi::EPixelFormat::Mono32F:
+            executeGaussianBlurPass<float, 1>( device, destination, source, area, parameters );
+            break;
 
-                const auto fexpval = exp( -( mx * mx ) / div );
-                float lval = 0.0f;
-                float pval = 0.0f;
+        case fxapi::EPixelFormat::RGB8:
+            executeGaussianBlurPass<unsigned char, 3>( device, destination, source, area, parameters );
+            break;
 
-                for( size_t n = 0; channelCount > n; ++n ) {
-                    pval = ( ( ( float ) * ( pixel + n ) ) / maxValue );
-                    lval =  fexpval * pval / sum;
-                    values[n] += lval;
-                }
-            }
+        case fxapi::EPixelFormat::RGB16:
+            executeGaussianBlurPass<unsigned short, 3>( device, destination, source, area, parameters );
+            break;
 
-            for( size_t n = 0; channelCount > n; ++n ) {
-                const auto value = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[n] ) ) );
-                *( dstPixel + n ) = value;
-            }
-        } else {
-            for( int i = 0; size > i; ++i ) {
-                int mx = i - halfSize;
-                int px = area.x + x;
-                int py = area.y + y + mx;
-
-                if( py >= ( int )source->height() ) {
-                    py = py - ( int )source->height();
-                } else if( py < 0 ) {
-                    py = ( int )source->height() - abs( py );
-                }
+        case fxapi::EPixelFormat::RGB32F:
+            executeGaussianBlurPass<float, 3>( device, destination, source, area, parameters );
+            break;
 
-                _t_pixel_type* pixel = ( _t_pixel_type* )( ( ( char* )sourceBuffer ) + ( ( ( ( py ) * source->width() ) + px ) * pixelLength ) );
+        case fxapi::EPixelFormat::RGBA8:
+            executeGaussianBlurPass<unsigned char, 4>( device, destination, source, area, parameters );
+            break;
 
-                const auto fexpval = exp( -( mx * mx ) / div );
-                float lval = 0.0f;
-                float pval = 0.0f;
+        case fxapi::EPixelFormat::RGBA16:
+            executeGaussianBlurPass<unsigned short, 4>( device, destination, source, area, parameters );
+            break;
 
-                for( size_t n = 0; channelCount > n; ++n ) {
-                    pval = ( ( ( float ) * ( pixel + n ) ) / maxValue );
-                    lval =  fexpval * pval / sum;
-                    values[n] += lval;
-                }
-            }
+        case fxapi::EPixelFormat::RGBA32F:
+            executeGaussianBlurPass<float, 4>( device, destination, source, area, parameters );
+            break;
 
-            for( size_t n = 0; channelCount > n; ++n ) {
-                const auto value = std::max<_t_pixel_type>( 0, std::min<_t_pixel_type>( maxValue, std::ceil( ( float )maxValue * values[n] ) ) );
-                *( dstPixel + n ) = value;
-            }
-        }
+        default:
 
+            throw std::runtime_error(
+                "Error: unknown or incompatible pixel format!"
+            );
     }
-
-    delete [] values;
-
 }
 
-
-
 void gaussianBlur_CPU(
     libgraphics::fxapi::ApiBackendDevice* device,
     libgraphics::fxapi::ApiImageObject* destination,
@@ -382,6 +276,18 @@ void gaussianBlur_CPU(
     assert( device );
     assert( source );
 
+    if( radius >= FastGaussianBlurMinRadius ) {
+        fastGaussianBlur_CPU(
+            device,
+            destination,
+            source,
+            area,
+            radius
+        );
+
+        return;
+    }
+
     libgraphics::fxapi::ApiScopedImgRef    temporaryLayer(
         device,
         destination->format(),
@@ -389,11 +295,22 @@ void gaussianBlur_CPU(
         destination->height()
     );
 
+    /// the vertical pass reads the rows above and below
+    /// the area.
+    Rect32I horizontalArea = expandArea(
+                                 area,
+                                 gaussianBlurHalo( radius ),
+                                 destination->width(),
+                                 destination->height()
+                             );
+    horizontalArea.x        = area.x;
+    horizontalArea.width    = area.width;
+
     horizontalGaussianBlur_CPU(
         device,
         temporaryLayer,
         source,
-        area,
+        horizontalArea,
         radius
     );
     verticalGaussianBlur_CPU(
@@ -412,123 +329,14 @@ void verticalGaussianBlur_CPU(
     Rect32I area,
     float radius
 ) {
-    assert( destination->format() == source->format() );
-
-    switch( destination->format() ) {
-        case fxapi::EPixelFormat::Mono8:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::vertical, radius )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::Mono16:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::vertical, radius )
-                )
-            );
-
-        case fxapi::EPixelFormat::RGB8:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_fixed_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::vertical, radius )
-                )
-            );
-
-            break;
-
-        case fxapi::EPixelFormat::RGB16:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_fixed_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::vertical, radius )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::RGBA8:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::vertical, radius )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::RGBA16:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::vertical, radius )
-                )
-            );
-            break;
-
-        default:
-
-            throw std::runtime_error(
-                "Error: unknown or incompatible pixel format!"
-            );
-    }
+    executeGaussianBlurPass(
+        device,
+        destination,
+        source,
+        area,
+        kernel_gaussian_blur_pack::vertical,
+        radius
+    );
 }
 
 void horizontalGaussianBlur_CPU(
@@ -538,123 +346,14 @@ void horizontalGaussianBlur_CPU(
     Rect32I area,
     float radius
 ) {
-    assert( destination->format() == source->format() );
-
-    switch( destination->format() ) {
-        case fxapi::EPixelFormat::Mono8:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::horizontal, radius )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::Mono16:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::horizontal, radius )
-                )
-            );
-
-        case fxapi::EPixelFormat::RGB8:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_fixed_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::horizontal, radius )
-                )
-            );
-
-            break;
-
-        case fxapi::EPixelFormat::RGB16:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_fixed_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::horizontal, radius )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::RGBA8:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::horizontal, radius )
-                )
-            );
-            break;
-
-        case fxapi::EPixelFormat::RGBA16:
-
-            fx::operations::cpuExecuteTileBased(
-                device,
-                ( backend::cpu::ImageObject* )destination,
-                ( backend::cpu::ImageObject* )source,
-                area,
-                std::bind(
-                    &kernel_directional_gaussian_blur<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_gaussian_blur_pack( kernel_gaussian_blur_pack::horizontal, radius )
-                )
-            );
-            break;
-
-        default:
-
-            throw std::runtime_error(
-                "Error: unknown or incompatible pixel format!"
-            );
-    }
+    executeGaussianBlurPass(
+        device,
+        destination,
+        source,
+        area,
+        kernel_gaussian_blur_pack::horizontal,
+        radius
+    );
 }
 
 }
@@ -0,0 +1,39 @@
+#include <libgraphics/fx/operations/complex.hpp>
+#include <libgraphics/fx/operations/complex/cpu.hpp>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+void pointChain(
+    fxapi::ApiBackendDevice* backend,
+    ImageLayer* dst,
+    ImageLayer* src,
+    Rect32I area,
+    const PointOperationList& operations
+) {
+    assert( dst );
+    assert( src );
+    assert( !dst->empty() );
+    assert( !src->empty() );
+
+    bool rendered( false );
+
+    if( ( backend->backendId() == FXAPI_BACKEND_CPU ) && dst->containsDataForBackend( FXAPI_BACKEND_CPU ) && src->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+        pointChain_CPU(
+            dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
+            dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
+            area,
+            operations
+        );
+        rendered = true;
+    }
+
+    assert( rendered );
+    ( void ) rendered;
+}
+
+}
+}
+}
@@ -0,0 +1,387 @@
+
+#include <assert.h>
+#include <QDebug>
+#include <math.h>
+
+#include <libgraphics/fx/operations/complex.hpp>
+#include <libgraphics/fx/operations/complex/cpu.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_lut.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+/// true for the unsigned 8 and 16 bit formats the
+/// point operations are implemented for.
+inline bool isPointOperationFormat( fxapi::EPixelFormat::t format, size_t minimumChannels ) {
+    switch( format ) {
+        case fxapi::EPixelFormat::Mono8:
+        case fxapi::EPixelFormat::Mono16:
+        case fxapi::EPixelFormat::RGB8:
+        case fxapi::EPixelFormat::RGB16:
+        case fxapi::EPixelFormat::RGBA8:
+        case fxapi::EPixelFormat::RGBA16:
+            return fxapi::EPixelFormat::getChannelCount( format ) >= minimumChannels;
+
+        default:
+            return false;
+    }
+}
+
+/** stage: convertToMonochrome **/
+class point_operation_monochrome : public PointOperation {
+    public:
+        explicit point_operation_monochrome( const float* channelFactors ) {
+            m_Factors[0] = channelFactors[0];
+            m_Factors[1] = channelFactors[1];
+            m_Factors[2] = channelFactors[2];
+            m_Factors[3] = 0.0f;
+        }
+
+        virtual bool supportsFormat( fxapi::EPixelFormat::t format ) const {
+            return isPointOperationFormat( format, 1 );
+        }
+
+        virtual void processRow( unsigned char* pixels, const PointOperationRow& row ) const {
+            process( pixels, row );
+        }
+        virtual void processRow( unsigned short* pixels, const PointOperationRow& row ) const {
+            process( pixels, row );
+        }
+
+    private:
+        template < class _t_pixel_type >
+        void process( _t_pixel_type* pixels, const PointOperationRow& row ) const {
+            const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+
+            for( size_t x = 0; row.width > x; ++x, pixels += row.channels ) {
+                double sum( 0 );
+
+                for( size_t n = 0; row.channels > n; ++n ) {
+                    sum += ( ( ( float )pixels[n] ) / maxValue ) * m_Factors[n];
+                }
+
+                const _t_pixel_type value = ( _t_pixel_type )std::max<double>( 0.0, std::min<double>( maxValue, ( double )( sum * maxValue ) ) );
+
+                for( size_t n = 0; row.channels > n; ++n ) {
+                    pixels[n] = value;
+                }
+            }
+        }
+
+        float   m_Factors[4];
+};
+
+/** stage: adjustBrightness **/
+class point_operation_curve : public PointOperation {
+    public:
+        point_operation_curve( const float* curveData, size_t curveLength ) :
+            m_CurveData( curveData, curveData + curveLength ) {}
+
+        virtual bool supportsFormat( fxapi::EPixelFormat::t format ) const {
+            return isPointOperationFormat( format, 1 ) &&
+                   ( m_CurveData.size() > ( size_t )fxapi::EPixelFormat::getPixelMax( format ) );
+        }
+
+        virtual void processRow( unsigned char* pixels, const PointOperationRow& row ) const {
+            std::call_once( m_Table8Flag, [this]() {
+                m_Table8 = curveLookupTable<unsigned char>( m_CurveData.data(), m_CurveData.size() );
+            } );
+            process( pixels, row, *m_Table8 );
+        }
+        virtual void processRow( unsigned short* pixels, const PointOperationRow& row ) const {
+            std::call_once( m_Table16Flag, [this]() {
+                m_Table16 = curveLookupTable<unsigned short>( m_CurveData.data(), m_CurveData.size() );
+            } );
+            process( pixels, row, *m_Table16 );
+        }
+
+    private:
+        template < class _t_pixel_type >
+        void process( _t_pixel_type* pixels, const PointOperationRow& row, const PixelLookupTable<_t_pixel_type>& table ) const {
+            const _t_pixel_type*    values  = table.entry( 0 );
+            const size_t            count   = row.width * row.channels;
+
+            for( size_t n = 0; count > n; ++n ) {
+                pixels[n] = values[pixels[n]];
+            }
+        }
+
+        std::vector<float>  m_CurveData;
+
+        /** baked on first use, shared by the render threads **/
+        mutable std::once_flag  m_Table8Flag;
+        mutable std::once_flag  m_Table16Flag;
+        mutable std::shared_ptr<const PixelLookupTable<unsigned char> >     m_Table8;
+        mutable std::shared_ptr<const PixelLookupTable<unsigned short> >    m_Table16;
+};
+
+/** stage: splittone **/
+class point_operation_splittone : public PointOperation {
+    public:
+        point_operation_splittone(
+            float brightR,
+            float brightG,
+            float brightB,
+            float darkR,
+            float darkG,
+            float darkB,
+            float weight
+        ) : m_Highlights( brightR, brightG, brightB ), m_Shadows( darkR, darkG, darkB ), m_Weight( weight ) {}
+
+        virtual bool supportsFormat( fxapi::EPixelFormat::t format ) const {
+            return isPointOperationFormat( format, 3 );
+        }
+
+        virtual void processRow( unsigned char* pixels, const PointOperationRow& row ) const {
+            std::call_once( m_Table8Flag, [this]() {
+                m_Table8 = splittoneLookupTable<unsigned char>( m_Highlights, m_Shadows, m_Weight );
+            } );
+            process( pixels, row, *m_Table8 );
+        }
+        virtual void processRow( unsigned short* pixels, const PointOperationRow& row ) const {
+            std::call_once( m_Table16Flag, [this]() {
+                m_Table16 = splittoneLookupTable<unsigned short>( m_Highlights, m_Shadows, m_Weight );
+            } );
+            process( pixels, row, *m_Table16 );
+        }
+
+    private:
+        /// gray pixels are a single gather from the table
+        template < class _t_pixel_type >
+        void process( _t_pixel_type* pixels, const PointOperationRow& row, const PixelLookupTable<_t_pixel_type>& table ) const {
+            const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+
+            for( size_t x = 0; row.width > x; ++x, pixels += row.channels ) {
+                if( GetR( pixels ) == GetG( pixels ) && GetR( pixels ) == GetB( pixels ) ) {
+                    const _t_pixel_type* entry = table.entry( GetR( pixels ) );
+
+                    GetR( pixels ) = GetR( entry );
+                    GetG( pixels ) = GetG( entry );
+                    GetB( pixels ) = GetB( entry );
+                    continue;
+                }
+
+                math::Color3f   finalColor = math::splittone( GetColor3f( maxValue, pixels ), m_Highlights, m_Shadows, m_Weight );
+
+                finalColor       = math::minMaxUniform( finalColor );
+
+                SetColor3f( maxValue, finalColor, pixels );
+            }
+        }
+
+        math::Color3f   m_Highlights;
+        math::Color3f   m_Shadows;
+        float           m_Weight;
+
+        /** baked on first use, shared by the render threads **/
+        mutable std::once_flag  m_Table8Flag;
+        mutable std::once_flag  m_Table16Flag;
+        mutable std::shared_ptr<const PixelLookupTable<unsigned char> >     m_Table8;
+        mutable std::shared_ptr<const PixelLookupTable<unsigned short> >    m_Table16;
+};
+
+/** stage: applyVignette **/
+class point_operation_vignette : public PointOperation {
+    public:
+        point_operation_vignette( const Point32F& center, float radius, float strength ) :
+            m_Center( center ), m_Radius( radius ), m_Strength( strength ) {}
+
+        virtual bool supportsFormat( fxapi::EPixelFormat::t format ) const {
+            return isPointOperationFormat( format, 1 );
+        }
+
+        virtual void processRow( unsigned char* pixels, const PointOperationRow& row ) const {
+            process( pixels, row );
+        }
+        virtual void processRow( unsigned short* pixels, const PointOperationRow& row ) const {
+            process( pixels, row );
+        }
+
+    private:
+        template < class _t_pixel_type >
+        void process( _t_pixel_type* pixels, const PointOperationRow& row ) const {
+            const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+            const Point32F c(
+                ( float )row.imageWidth * 0.01f * ( float )m_Center.x,
+                ( float )row.imageHeight * 0.01f * ( float )m_Center.y
+            );
+            const float maxDistance = m_Radius * 0.01f * ( ( float )( row.imageHeight + row.imageHeight ) * 0.5f );
+
+            for( size_t x = 0; row.width > x; ++x, pixels += row.channels ) {
+                const float distance = fabs( c.distanceTo(
+                                                 libgraphics::Point32F(
+                                                     ( float )( row.x + x ),
+                                                     ( float )row.y
+                                                 )
+                                             ) );
+                const float vignetteValue = m_Strength * 0.01f * distance / maxDistance;
+
+                for( size_t i = 0; row.channels > i; ++i ) {
+                    const float inputValue = ( pixels[i] / ( float )maxValue );
+                    float currentValue =
+                        ( 1.0f - vignetteValue ) * inputValue + ( vignetteValue * ( inputValue * inputValue ) );
+                    currentValue = std::max<float>( 0.0, std::min<float>( 1.0, currentValue ) );
+
+                    const _t_pixel_type conv = std::ceil( currentValue * maxValue );
+
+                    pixels[i] = std::max<int>( 0, std::min<int>( maxValue, conv ) );
+                }
+            }
+        }
+
+        Point32F    m_Center;
+        float       m_Radius;
+        float       m_Strength;
+};
+
+std::shared_ptr<const PointOperation> makeMonochromePointOperation( const float* channelFactors ) {
+    assert( channelFactors );
+
+    return std::make_shared<const point_operation_monochrome>( channelFactors );
+}
+
+std::shared_ptr<const PointOperation> makeCurvePointOperation( const float* curveData, size_t curveLength ) {
+    assert( curveData );
+    assert( curveLength > 0 );
+
+    return std::make_shared<const point_operation_curve>( curveData, curveLength );
+}
+
+std::shared_ptr<const PointOperation> makeSplittonePointOperation(
+    float brightR,
+    float brightG,
+    float brightB,
+    float darkR,
+    float darkG,
+    float darkB,
+    float weight
+) {
+    return std::make_shared<const point_operation_splittone>( brightR, brightG, brightB, darkR, darkG, darkB, weight );
+}
+
+std::shared_ptr<const PointOperation> makeVignettePointOperation( const Point32F& center, float radius, float strength ) {
+    return std::make_shared<const point_operation_vignette>( center, radius, strength );
+}
+
+struct kernel_point_chain_pack {
+    explicit kernel_point_chain_pack( const PointOperationList& _operations ) :
+        operations( _operations ) {}
+
+    const PointOperationList& operations;
+};
+
+/// copies each row of the tile once and runs all stages
+/// on it while it is still in the cache.
+template < class _t_pixel_type >
+void kernel_point_chain(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_point_chain_pack& params
+) {
+    ( void )device;
+
+    const size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
+                                    destination->format()
+                                );
+
+    PointOperationRow row;
+    row.x           = area.x;
+    row.width       = area.width;
+    row.channels    = channelCount;
+    row.imageWidth  = destination->width();
+    row.imageHeight = destination->height();
+
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstRow = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + area.x ) * channelCount );
+        const _t_pixel_type* srcRow = ( const _t_pixel_type* )source->data() + ( ( ( size_t )y * source->width() + area.x ) * channelCount );
+
+        if( dstRow != srcRow ) {
+            std::memcpy( dstRow, srcRow, row.width * channelCount * sizeof( _t_pixel_type ) );
+        }
+
+        row.y = y;
+
+        for( auto it = params.operations.begin(); it != params.operations.end(); ++it ) {
+            ( *it )->processRow( dstRow, row );
+        }
+    }
+}
+
+template < class _t_pixel_type >
+void executePointChain(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area,
+    const PointOperationList& operations
+) {
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )dst,
+        ( backend::cpu::ImageObject* )src,
+        area,
+        std::bind(
+            &kernel_point_chain<_t_pixel_type>,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            kernel_point_chain_pack( operations )
+        ),
+        backend::cpu::TileHints( dst->format(), 2 )
+    );
+}
+
+/// operation: pointChain
+void pointChain_CPU(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    Rect32I area,
+    const PointOperationList& operations
+) {
+    assert( device != nullptr );
+    assert( dst != nullptr );
+    assert( src != nullptr );
+    assert( dst->format() == src->format() );
+
+#ifdef _DEBUG
+    for( auto it = operations.begin(); it != operations.end(); ++it ) {
+        assert( ( *it )->supportsFormat( dst->format() ) );
+    }
+#endif
+
+    switch( dst->format() ) {
+        case fxapi::EPixelFormat::RGB8:
+        case fxapi::EPixelFormat::RGBA8:
+        case fxapi::EPixelFormat::Mono8:
+            executePointChain<unsigned char>( device, dst, src, area, operations );
+            break;
+
+        case fxapi::EPixelFormat::RGB16:
+        case fxapi::EPixelFormat::RGBA16:
+        case fxapi::EPixelFormat::Mono16:
+            executePointChain<unsigned short>( device, dst, src, area, operations );
+            break;
+
+        default:
+
+            throw std::runtime_error(
+                "Error: unknown or incompatible pixel format!"
+            );
+    }
+}
+
+}
+}
+}
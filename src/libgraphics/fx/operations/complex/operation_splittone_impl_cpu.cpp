@@ -6,6 +6,7 @@
 #include <libgraphics/fx/operations/complex.hpp>
 #include <libgraphics/fx/operations/complex/cpu.hpp>
 #include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_lut.hpp>
 
 namespace libgraphics {
 namespace fx {
@@ -33,6 +34,24 @@ struct kernel_splittone {
 };
 
 
+template < class _t_pixel_type >
+inline void splittonePixel(
+    _t_pixel_type* ptrDstPixel,
+    const _t_pixel_type* ptrSrcPixel,
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+) {
+    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+
+    math::Color3f   currentColor = GetColor3f( maxValue, ptrSrcPixel );
+    math::Color3f   finalColor   = math::splittone( currentColor, highlights, shadows, weight );
+
+    finalColor       = math::minMaxUniform( finalColor );
+
+    SetColor3f( maxValue, finalColor, ptrDstPixel );
+}
+
 template <  class _t_pixel_type >
 void cpuSplittone(
     libgraphics::fxapi::ApiBackendDevice* device,
@@ -59,20 +78,8 @@ void cpuSplittone(
         return;
     }
 
-    const float highlights[4] = {
-        params.brightR,
-        params.brightG,
-        params.brightB,
-        1.0f
-    };
-    const float shadows[4] = {
-        params.darkR,
-        params.darkG,
-        params.darkB,
-        1.0f
-    };
-
-    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+    const math::Color3f highlights( params.brightR, params.brightG, params.brightB );
+    const math::Color3f shadows( params.darkR, params.darkG, params.darkB );
 
     for( size_t p = 0; ( area.width * area.height ) > p; ++p ) {
         const size_t y = ( p - ( p % ( int )area.width ) ) / area.width;
@@ -81,26 +88,96 @@ void cpuSplittone(
         _t_pixel_type* ptrDstPixel = ( _t_pixel_type* )( ( ( char* )destinationBuffer ) + ( ( ( area.y + y ) * destination->width() ) + x + area.x ) * pixelLength );
         _t_pixel_type* ptrSrcPixel = ( _t_pixel_type* )( ( ( char* )sourceBuffer ) + ( ( ( area.y + y ) * source->width() ) + x + area.x ) * pixelLength );
 
-        math::Color3f   currentColor = GetColor3f( maxValue, ptrSrcPixel );
+        splittonePixel( ptrDstPixel, ptrSrcPixel, highlights, shadows, params.weight );
+    }
+}
+
+template < class _t_pixel_type >
+struct kernel_splittone_lookup_pack {
+    kernel_splittone_lookup_pack(
+        const kernel_splittone& _params,
+        const std::shared_ptr<const PixelLookupTable<_t_pixel_type> >& _table
+    ) : params( _params ), table( _table ) {}
+
+    kernel_splittone                                        params;
+    std::shared_ptr<const PixelLookupTable<_t_pixel_type> > table;
+};
+
+/// integer formats: gray pixels, e.g. the output of the
+/// monochrome mixer, are a single gather from the baked
+/// table. colored pixels are computed.
+template <  class _t_pixel_type >
+void cpuSplittoneLookup(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    const kernel_splittone_lookup_pack<_t_pixel_type>& pack
+) {
+    ( void )device;
 
-        const float     intensity    = currentColor.r;
-        const float     intensityHighlights     = intensity * params.weight;
-        const float     intensityRest           = 1.0f - intensityHighlights;
-        const float     intensityShadows        = intensityRest * intensityRest;
-        const float     intensityOriginal       = 1.0f - intensityHighlights - intensityShadows;
+    const size_t channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
+                                    destination->format()
+                                );
+
+    assert( channelCount >= 3 );
+
+    if( channelCount < 3 ) {
+        return;
+    }
 
-        math::Color3f   finalColor;
+    const math::Color3f highlights( pack.params.brightR, pack.params.brightG, pack.params.brightB );
+    const math::Color3f shadows( pack.params.darkR, pack.params.darkG, pack.params.darkB );
+    const PixelLookupTable<_t_pixel_type>& table = *pack.table;
 
-        finalColor      += math::overlay( currentColor, math::Color3f( highlights[0], highlights[1], highlights[2] ) ) * intensityHighlights;
-        finalColor      += math::overlay( currentColor, math::Color3f( shadows[0], shadows[1], shadows[2] ) ) * intensityShadows;
-        finalColor      += math::Color3f( intensity ) * intensityOriginal;
+    for( int y = area.y; ( area.y + area.height ) > y; ++y ) {
+        _t_pixel_type* dstPixel = ( _t_pixel_type* )destination->data() + ( ( ( size_t )y * destination->width() + area.x ) * channelCount );
+        const _t_pixel_type* srcPixel = ( const _t_pixel_type* )source->data() + ( ( ( size_t )y * source->width() + area.x ) * channelCount );
 
-        finalColor       = math::minMaxUniform( finalColor );
+        for( int x = 0; area.width > x; ++x, dstPixel += channelCount, srcPixel += channelCount ) {
+            if( GetR( srcPixel ) == GetG( srcPixel ) && GetR( srcPixel ) == GetB( srcPixel ) ) {
+                const _t_pixel_type* entry = table.entry( GetR( srcPixel ) );
 
-        SetColor3f( maxValue, finalColor, ptrDstPixel );
+                GetR( dstPixel ) = GetR( entry );
+                GetG( dstPixel ) = GetG( entry );
+                GetB( dstPixel ) = GetB( entry );
+            } else {
+                splittonePixel( dstPixel, srcPixel, highlights, shadows, pack.params.weight );
+            }
+        }
     }
 }
 
+template < class _t_pixel_type >
+void executeSplittoneLookup(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::fxapi::ApiImageObject* dst,
+    libgraphics::fxapi::ApiImageObject* src,
+    libgraphics::Rect32I   area,
+    const kernel_splittone& params
+) {
+    const auto table = splittoneLookupTable<_t_pixel_type>(
+                           math::Color3f( params.brightR, params.brightG, params.brightB ),
+                           math::Color3f( params.darkR, params.darkG, params.darkB ),
+                           params.weight
+                       );
+
+    fx::operations::cpuExecuteTileBased(
+        device,
+        ( backend::cpu::ImageObject* )dst,
+        ( backend::cpu::ImageObject* )src,
+        area,
+        std::bind(
+            &cpuSplittoneLookup<_t_pixel_type>,
+            std::placeholders::_1,
+            std::placeholders::_2,
+            std::placeholders::_3,
+            std::placeholders::_4,
+            kernel_splittone_lookup_pack<_t_pixel_type>( params, table )
+        )
+    );
+}
+
 void splittone_CPU(
     libgraphics::fxapi::ApiBackendDevice* device,
     libgraphics::fxapi::ApiImageObject* dst,
@@ -159,37 +236,23 @@ void splittone_CPU(
 
         case fxapi::EPixelFormat::RGB8:
         case fxapi::EPixelFormat::RGBA8:
-            fx::operations::cpuExecuteTileBased(
+            executeSplittoneLookup<unsigned char>(
                 device,
-                ( backend::cpu::ImageObject* )dst,
-                ( backend::cpu::ImageObject* )src,
+                dst,
+                src,
                 area,
-                std::bind(
-                    &cpuSplittone<unsigned char>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_splittone( brightR, brightG, brightB, darkR, darkG, darkB, weight )
-                )
+                kernel_splittone( brightR, brightG, brightB, darkR, darkG, darkB, weight )
             );
             break;
 
         case fxapi::EPixelFormat::RGB16:
         case fxapi::EPixelFormat::RGBA16:
-            fx::operations::cpuExecuteTileBased(
+            executeSplittoneLookup<unsigned short>(
                 device,
-                ( backend::cpu::ImageObject* )dst,
-                ( backend::cpu::ImageObject* )src,
+                dst,
+                src,
                 area,
-                std::bind(
-                    &cpuSplittone<unsigned short>,
-                    std::placeholders::_1,
-                    std::placeholders::_2,
-                    std::placeholders::_3,
-                    std::placeholders::_4,
-                    kernel_splittone( brightR, brightG, brightB, darkR, darkG, darkB, weight )
-                )
+                kernel_splittone( brightR, brightG, brightB, darkR, darkG, darkB, weight )
             );
             break;
 
@@ -1,138 +1,195 @@
 #include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+#include <libgraphics/backend/cpu/cpu_scheduler.hpp>
+#include <libgraphics/cancellation.hpp>
 #include <QDebug>
 
 namespace libgraphics {
 namespace fx {
 namespace operations {
 
-/// helpers
-
-/// returns the 1024x1024 tile count for the
-/// specific rectangle
-size_t getTileCountForRectangle(
-    libgraphics::Rect32I   area,
-    size_t _tileSize = 1024
-);
-size_t getVerticalTileCountForRectangle(
-    libgraphics::Rect32I   area,
-    size_t _tileSize = 1024
-);
-size_t getHorizontalTileCountForRectangle(
-    libgraphics::Rect32I   area,
-    size_t _tileSize = 1024
-);
-size_t getTileSize();
-
-size_t calculateDefaultTileSize( size_t threads, size_t width, size_t height ) {
-    const float ratio   = ( float )width / ( float )height;
-    const float total   = ( width * height );
-    const int    base   = std::ceil( sqrt( total ) ) / threads;
-    return std::max<size_t>(
-               base * ratio,
-               base * ( 1.0f / ratio )
+namespace {
+typedef std::function<void( libgraphics::fxapi::ApiBackendDevice*, libgraphics::backend::cpu::ImageObject*, libgraphics::backend::cpu::ImageObject*, libgraphics::Rect32I )>  kernel_fn;
+
+/// derives the default hints from the buffers
+/// passed to the kernel.
+libgraphics::backend::cpu::TileHints getDefaultTileHints(
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source
+) {
+    const size_t buffers = ( source != nullptr && source != destination ) ? 2 : 1;
+
+    return libgraphics::backend::cpu::TileHints(
+               ( destination != nullptr ) ? destination->format() : libgraphics::fxapi::EPixelFormat::Empty,
+               buffers
            );
 }
 
+libgraphics::backend::cpu::TilePlan getTilePlan(
+    libgraphics::backend::cpu::BackendDevice* cpuDevice,
+    libgraphics::Rect32I area,
+    const libgraphics::backend::cpu::TileHints& hints
+) {
+    const libgraphics::backend::cpu::TilePlan plan = cpuDevice->tilePolicy().plan(
+                area,
+                hints,
+                cpuDevice->scheduler()->workerCount() + 1
+            );
+
+#if LIBGRAPHICS_DEBUG_OUTPUT
+    qDebug() << "TileSize:  " << plan.tileWidth << "x" << plan.tileHeight;
+#endif
+
+    return plan;
+}
+
+/// splits the area into tiles and hands every tile
+/// over to the submit function.
+void forEachTile(
+    libgraphics::Rect32I area,
+    const libgraphics::backend::cpu::TilePlan& plan,
+    const std::function<void( libgraphics::Rect32I )>& submit
+) {
+    const size_t tileWidth  = ( plan.tileWidth == 0 ) ? ( size_t )area.width : plan.tileWidth;
+    const size_t tileHeight = std::max<size_t>( 1, plan.tileHeight );
+
+    for( size_t offsetY = 0; ( size_t )area.height > offsetY; offsetY += tileHeight ) {
+        for( size_t offsetX = 0; ( size_t )area.width > offsetX; offsetX += tileWidth ) {
+            submit(
+                libgraphics::Rect32I(
+                    area.x + ( int )offsetX,
+                    area.y + ( int )offsetY,
+                    ( int )std::min( tileWidth, ( size_t )area.width - offsetX ),
+                    ( int )std::min( tileHeight, ( size_t )area.height - offsetY )
+                )
+            );
+        }
+    }
+}
+}
+
 void cpuExecuteTileBased(
     libgraphics::fxapi::ApiBackendDevice* device,
     libgraphics::backend::cpu::ImageObject*   destination,
     libgraphics::backend::cpu::ImageObject*   source,
     libgraphics::Rect32I area,
     std::function<void( libgraphics::fxapi::ApiBackendDevice*, libgraphics::backend::cpu::ImageObject*, libgraphics::backend::cpu::ImageObject*, libgraphics::Rect32I )>   kernel,
-    bool manualSync
+    const libgraphics::backend::cpu::TileHints& hints
 ) {
-    typedef std::function<void( libgraphics::fxapi::ApiBackendDevice*, libgraphics::backend::cpu::ImageObject*, libgraphics::backend::cpu::ImageObject*, libgraphics::Rect32I )>  kernel_fn;
-
     libgraphics::backend::cpu::BackendDevice*   cpuDevice = static_cast <
             libgraphics::backend::cpu::BackendDevice *
             >( device );
 
-    const size_t tileSize        = 1024; /*calculateDefaultTileSize(
-        cpuDevice->threadPool()->maxThreadCount(),
-        area.width,
-        area.height
-    );*/
-    const size_t horizontalCount = getHorizontalTileCountForRectangle(
-                                       area,
-                                       tileSize
-                                   );
-    const size_t verticalCount = getVerticalTileCountForRectangle(
-                                     area,
-                                     tileSize
-                                 );
-
-#ifdef LIBGRAPHICS_DEBUG_OUTPUT
-    qDebug() << "TileCount: " << horizontalCount* verticalCount;
-    qDebug() << "TileSize:  " << tileSize;
-#endif
-
-    const unsigned int baseTileX = area.x;
-    const unsigned int baseTileY = area.y;
+    const libgraphics::backend::cpu::TilePlan plan = getTilePlan(
+                cpuDevice,
+                area,
+                hints
+            );
 
-    unsigned int tileX = baseTileX;
-    unsigned int tileY = baseTileY;
+    /// only wait for the tiles of this operation, batches
+    /// of other renders may still be running on the workers.
+    libgraphics::backend::cpu::TileBatch batch(
+        area,
+        plan.tileWidth,
+        plan.tileHeight,
+        [device, destination, source, &kernel]( const libgraphics::Rect32I & tileArea ) {
+        kernel(
+            device,
+            destination,
+            source,
+            tileArea
+        );
+    }
+    );
 
-    for( size_t iterHoriz = 0; horizontalCount > iterHoriz; ++iterHoriz ) {
-        for( size_t iterVert = 0; verticalCount > iterVert; ++iterVert ) {
-            tileX = baseTileX + ( unsigned int )( iterHoriz * tileSize );
-            tileY = baseTileY + ( unsigned int )( iterVert * tileSize );
+    cpuDevice->scheduler()->run( batch );
+}
 
-            size_t tileWidth = std::min( ( size_t )tileSize, ( size_t )( area.width - ( iterHoriz * tileSize ) ) );
-            size_t tileHeight = std::min( ( size_t )tileSize, ( size_t )( area.height - ( iterVert * tileSize ) ) );
+void cpuExecuteTileBased(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    std::function<void( libgraphics::fxapi::ApiBackendDevice*, libgraphics::backend::cpu::ImageObject*, libgraphics::backend::cpu::ImageObject*, libgraphics::Rect32I )>   kernel,
+    bool manualSync
+) {
+    libgraphics::backend::cpu::BackendDevice*   cpuDevice = static_cast <
+            libgraphics::backend::cpu::BackendDevice *
+            >( device );
 
-            libgraphics::Rect32I tileArea(
-                tileX,
-                tileY,
-                ( unsigned int )tileWidth,
-                ( unsigned int )tileHeight
-            );
+    if( !manualSync ) {
+        cpuExecuteTileBased(
+            device,
+            destination,
+            source,
+            area,
+            kernel,
+            getDefaultTileHints( destination, source )
+        );
+
+        return;
+    }
 
-            struct Job : QRunnable {
-                Job( libgraphics::fxapi::ApiBackendDevice* _device,
-                     libgraphics::backend::cpu::ImageObject*   _destination,
-                     libgraphics::backend::cpu::ImageObject*   _source,
-                     libgraphics::Rect32I _area,
-                     kernel_fn& fn
-                   ) : device( _device ), destination( _destination ),
-                    source( _source ), area( _area ), kernel( fn ) {
-                    setAutoDelete( true );
-                }
-                virtual ~Job() {}
-
-                libgraphics::fxapi::ApiBackendDevice* device;
-                libgraphics::backend::cpu::ImageObject*   destination;
-                libgraphics::backend::cpu::ImageObject*   source;
-                libgraphics::Rect32I area;
-                kernel_fn& kernel;
-
-                virtual void run() {
-                    kernel(
-                        this->device,
-                        this->destination,
-                        this->source,
-                        this->area
-                    );
+    /// the caller synchronizes through BackendDevice::synchronize(),
+    /// which waits for the whole pool.
+    std::shared_ptr<kernel_fn> sharedKernel( new kernel_fn( kernel ) );
+    const std::shared_ptr<libgraphics::CancellationToken> token( libgraphics::currentCancellationToken() );
+
+    forEachTile(
+        area,
+        getTilePlan( cpuDevice, area, getDefaultTileHints( destination, source ) ),
+    [&]( libgraphics::Rect32I tileArea ) {
+        struct Job : QRunnable {
+            Job( libgraphics::fxapi::ApiBackendDevice* _device,
+                 libgraphics::backend::cpu::ImageObject*   _destination,
+                 libgraphics::backend::cpu::ImageObject*   _source,
+                 libgraphics::Rect32I _area,
+                 const std::shared_ptr<kernel_fn>& fn,
+                 const std::shared_ptr<libgraphics::CancellationToken>& _token
+               ) : device( _device ), destination( _destination ),
+                source( _source ), area( _area ), kernel( fn ), token( _token ) {
+                setAutoDelete( true );
+            }
+            virtual ~Job() {}
+
+            libgraphics::fxapi::ApiBackendDevice* device;
+            libgraphics::backend::cpu::ImageObject*   destination;
+            libgraphics::backend::cpu::ImageObject*   source;
+            libgraphics::Rect32I area;
+            std::shared_ptr<kernel_fn> kernel;
+            std::shared_ptr<libgraphics::CancellationToken> token;
+
+            virtual void run() {
+                if( token && token->cancelled() ) {
+                    return;
                 }
-            };
+
+                ( *kernel )(
+                    this->device,
+                    this->destination,
+                    this->source,
+                    this->area
+                );
+            }
+        };
 
 #ifdef FXAPI_CPU_BACKEND_SINGLETHREADED
-            kernel(
-                device,
-                destination,
-                source,
-                tileArea
-            );
-#else
-            cpuDevice->threadPool()->start(
-                new Job( device, destination, source, tileArea, kernel )
-            );
-#endif
+        if( token && token->cancelled() ) {
+            return;
         }
-    }
 
-    if( !manualSync ) {
-        cpuDevice->threadPool()->waitForDone();
+        ( *sharedKernel )(
+            device,
+            destination,
+            source,
+            tileArea
+        );
+#else
+        cpuDevice->threadPool()->start(
+            new Job( device, destination, source, tileArea, sharedKernel, token )
+        );
+#endif
     }
+    );
 }
 
 }
@@ -9,6 +9,7 @@
 #include <libgraphics/backend/cpu/cpu_backenddevice.hpp>
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
 #include <libgraphics/backend/cpu/cpu_imageoperation.hpp>
+#include <libgraphics/backend/cpu/cpu_tileplanner.hpp>
 
 #include <limits>
 #include <functional>
@@ -29,6 +30,17 @@ void cpuExecuteTileBased(
     bool manualSync = false
 );
 
+/// same as above, but picks the tile geometry from
+/// the specified hints instead of the buffer formats.
+void cpuExecuteTileBased(
+    libgraphics::fxapi::ApiBackendDevice* device,
+    libgraphics::backend::cpu::ImageObject*   destination,
+    libgraphics::backend::cpu::ImageObject*   source,
+    libgraphics::Rect32I area,
+    std::function<void( libgraphics::fxapi::ApiBackendDevice*, libgraphics::backend::cpu::ImageObject*, libgraphics::backend::cpu::ImageObject*, libgraphics::Rect32I )>   kernel,
+    const libgraphics::backend::cpu::TileHints& hints
+);
+
 namespace math {
 
 struct Color3f {
@@ -514,6 +526,34 @@ inline Color3f grainMerge( Color3f i, float m ) {
            );
 }
 
+/// split tone of a normalized color, the result is
+/// not clamped.
+inline Color3f splittone( const Color3f& current, const Color3f& highlights, const Color3f& shadows, float weight ) {
+    const float     intensity               = current.r;
+    const float     intensityHighlights     = intensity * weight;
+    const float     intensityRest           = 1.0f - intensityHighlights;
+    const float     intensityShadows        = intensityRest * intensityRest;
+    const float     intensityOriginal       = 1.0f - intensityHighlights - intensityShadows;
+
+    Color3f         finalColor;
+
+    finalColor      += overlay( current, highlights ) * intensityHighlights;
+    finalColor      += overlay( current, shadows ) * intensityShadows;
+    finalColor      += Color3f( intensity ) * intensityOriginal;
+
+    return finalColor;
+}
+
+/// luma weighted blend of the highlight and shadow
+/// mixes of a normalized color, the result is not clamped.
+inline float adaptiveMonochrome( float r, float g, float b, const Color3f& highlights, const Color3f& shadows, float weight ) {
+    const float luma    = weight + ( r * 0.299f ) + ( g * 0.587f ) + ( b * 0.114f );
+    const float bright  = ( r * highlights.r ) + ( g * highlights.g ) + ( b * highlights.b );
+    const float dark    = ( r * shadows.r ) + ( g * shadows.g ) + ( b * shadows.b );
+
+    return ( dark * ( 1.0f - luma ) ) + ( bright * luma );
+}
+
 
 
 template < int _max_value >
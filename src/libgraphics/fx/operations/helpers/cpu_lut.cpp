@@ -0,0 +1,139 @@
+#include <libgraphics/fx/operations/helpers/cpu_lut.hpp>
+
+#include <assert.h>
+#include <math.h>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+namespace {
+template < class _t_pixel_type >
+std::shared_ptr<PixelLookupTable<_t_pixel_type> > makeLookupTable( size_t channels ) {
+    return std::make_shared<PixelLookupTable<_t_pixel_type> >( channels );
+}
+
+std::vector<float> makeToneParameters(
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+) {
+    std::vector<float> parameters( 7 );
+
+    parameters[0] = highlights.r;
+    parameters[1] = highlights.g;
+    parameters[2] = highlights.b;
+    parameters[3] = shadows.r;
+    parameters[4] = shadows.g;
+    parameters[5] = shadows.b;
+    parameters[6] = weight;
+
+    return parameters;
+}
+}
+
+template < class _t_pixel_type >
+std::shared_ptr<const PixelLookupTable<_t_pixel_type> > curveLookupTable(
+    const float* curveData,
+    size_t curveLength
+) {
+    typedef PixelLookupTable<_t_pixel_type> TableType;
+    static PixelLookupTableCache<_t_pixel_type> cache;
+
+    assert( curveData );
+    assert( curveLength >= TableType::Length );
+
+    const std::vector<float> parameters( curveData, curveData + TableType::Length );
+    auto cached = cache.find( parameters );
+
+    if( cached ) {
+        return cached;
+    }
+
+    const double maxValue = ( double )std::numeric_limits<_t_pixel_type>::max();
+    auto table = makeLookupTable<_t_pixel_type>( 1 );
+
+    for( size_t value = 0; TableType::Length > value; ++value ) {
+        *table->entry( value ) = ( _t_pixel_type )std::max<double>( 0, std::min<double>( maxValue * curveData[value], maxValue ) );
+    }
+
+    cache.store( parameters, table );
+
+    return table;
+}
+
+template < class _t_pixel_type >
+std::shared_ptr<const PixelLookupTable<_t_pixel_type> > splittoneLookupTable(
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+) {
+    typedef PixelLookupTable<_t_pixel_type> TableType;
+    static PixelLookupTableCache<_t_pixel_type> cache;
+
+    const std::vector<float> parameters = makeToneParameters( highlights, shadows, weight );
+    auto cached = cache.find( parameters );
+
+    if( cached ) {
+        return cached;
+    }
+
+    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+    auto table = makeLookupTable<_t_pixel_type>( 3 );
+
+    for( size_t value = 0; TableType::Length > value; ++value ) {
+        const float     intensity   = MapToFloat( maxValue, value );
+        math::Color3f   finalColor  = math::splittone( math::Color3f( intensity ), highlights, shadows, weight );
+
+        finalColor = math::minMaxUniform( finalColor );
+
+        _t_pixel_type* entry = table->entry( value );
+        SetColor3f( maxValue, finalColor, entry );
+    }
+
+    cache.store( parameters, table );
+
+    return table;
+}
+
+template < class _t_pixel_type >
+std::shared_ptr<const PixelLookupTable<_t_pixel_type> > adaptiveBWMixerLookupTable(
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+) {
+    typedef PixelLookupTable<_t_pixel_type> TableType;
+    static PixelLookupTableCache<_t_pixel_type> cache;
+
+    const std::vector<float> parameters = makeToneParameters( highlights, shadows, weight );
+    auto cached = cache.find( parameters );
+
+    if( cached ) {
+        return cached;
+    }
+
+    const auto maxValue = std::numeric_limits<_t_pixel_type>::max();
+    auto table = makeLookupTable<_t_pixel_type>( 1 );
+
+    for( size_t value = 0; TableType::Length > value; ++value ) {
+        const float intensity   = MapToFloat( maxValue, value );
+        const float combined    = math::adaptiveMonochrome( intensity, intensity, intensity, highlights, shadows, weight );
+
+        *table->entry( value ) = MinMax( maxValue, MapFloat( maxValue, combined ) );
+    }
+
+    cache.store( parameters, table );
+
+    return table;
+}
+
+template std::shared_ptr<const PixelLookupTable<unsigned char> > curveLookupTable<unsigned char>( const float*, size_t );
+template std::shared_ptr<const PixelLookupTable<unsigned short> > curveLookupTable<unsigned short>( const float*, size_t );
+template std::shared_ptr<const PixelLookupTable<unsigned char> > splittoneLookupTable<unsigned char>( const math::Color3f&, const math::Color3f&, float );
+template std::shared_ptr<const PixelLookupTable<unsigned short> > splittoneLookupTable<unsigned short>( const math::Color3f&, const math::Color3f&, float );
+template std::shared_ptr<const PixelLookupTable<unsigned char> > adaptiveBWMixerLookupTable<unsigned char>( const math::Color3f&, const math::Color3f&, float );
+template std::shared_ptr<const PixelLookupTable<unsigned short> > adaptiveBWMixerLookupTable<unsigned short>( const math::Color3f&, const math::Color3f&, float );
+
+}
+}
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/fx/operations/helpers/cpu_helpers.hpp>
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+
+/// PixelLookupTable
+/**
+ *  Pre-quantised results of a per channel function for every
+ *  value of an integer pixel type. Each entry stores the outputs
+ *  of all channels side by side, so a pixel costs one gather.
+ */
+template < class _t_pixel_type >
+class PixelLookupTable : public libcommon::INonCopyable {
+    public:
+        static const size_t Length = ( size_t )std::numeric_limits<_t_pixel_type>::max() + 1;
+
+        explicit PixelLookupTable( size_t channels ) :
+            m_Channels( channels ), m_Values( Length * channels ) {}
+
+        size_t channels() const {
+            return this->m_Channels;
+        }
+
+        _t_pixel_type* entry( size_t value ) {
+            return this->m_Values.data() + ( value * this->m_Channels );
+        }
+
+        const _t_pixel_type* entry( size_t value ) const {
+            return this->m_Values.data() + ( value * this->m_Channels );
+        }
+    protected:
+        size_t                      m_Channels;
+        std::vector<_t_pixel_type>  m_Values;
+};
+
+/// PixelLookupTableCache
+/**
+ *  Keeps the table of the last parameters, so repeated renders
+ *  with unchanged filter settings don't bake the table again.
+ */
+template < class _t_pixel_type >
+class PixelLookupTableCache : public libcommon::INonCopyable {
+    public:
+        typedef std::shared_ptr<const PixelLookupTable<_t_pixel_type> > TablePtr;
+
+        TablePtr find( const std::vector<float>& parameters ) {
+            std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+            return ( this->m_Table && this->m_Parameters == parameters ) ? this->m_Table : TablePtr();
+        }
+
+        void store( const std::vector<float>& parameters, const TablePtr& table ) {
+            std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+            this->m_Parameters  = parameters;
+            this->m_Table       = table;
+        }
+    protected:
+        std::mutex          m_Mutex;
+        std::vector<float>  m_Parameters;
+        TablePtr            m_Table;
+};
+
+/// returns the table of adjustBrightness() for the curve. the
+/// curve needs an entry for every value of the pixel type.
+template < class _t_pixel_type >
+std::shared_ptr<const PixelLookupTable<_t_pixel_type> > curveLookupTable(
+    const float* curveData,
+    size_t curveLength
+);
+
+/// returns the red, green and blue results of splittone() for
+/// gray pixels, indexed by the intensity.
+template < class _t_pixel_type >
+std::shared_ptr<const PixelLookupTable<_t_pixel_type> > splittoneLookupTable(
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+);
+
+/// returns the result of adaptiveBWMixer() for gray pixels,
+/// indexed by the intensity.
+template < class _t_pixel_type >
+std::shared_ptr<const PixelLookupTable<_t_pixel_type> > adaptiveBWMixerLookupTable(
+    const math::Color3f& highlights,
+    const math::Color3f& shadows,
+    float weight
+);
+
+}
+}
+}
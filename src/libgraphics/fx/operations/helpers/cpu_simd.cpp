@@ -0,0 +1,396 @@
+#include <libgraphics/fx/operations/helpers/cpu_simd.hpp>
+#include <libgraphics/systeminfo.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#if defined( _M_X64 ) || defined( _M_IX86 ) || defined( __x86_64__ ) || defined( __i386__ )
+#   define LIBGRAPHICS_SIMD_X86
+#   include <immintrin.h>
+#endif
+
+/// enables an instruction set for the functions defined
+/// up to LIBGRAPHICS_SIMD_TARGET_END. msvc always accepts
+/// the intrinsics.
+#if defined( __clang__ )
+#   define LIBGRAPHICS_SIMD_PRAGMA(x) _Pragma( #x )
+#   define LIBGRAPHICS_SIMD_TARGET_BEGIN(isa) LIBGRAPHICS_SIMD_PRAGMA( clang attribute push( __attribute__( ( target( isa ) ) ), apply_to = function ) )
+#   define LIBGRAPHICS_SIMD_TARGET_END LIBGRAPHICS_SIMD_PRAGMA( clang attribute pop )
+#elif defined( __GNUC__ )
+#   define LIBGRAPHICS_SIMD_PRAGMA(x) _Pragma( #x )
+#   define LIBGRAPHICS_SIMD_TARGET_BEGIN(isa) LIBGRAPHICS_SIMD_PRAGMA( GCC push_options ) LIBGRAPHICS_SIMD_PRAGMA( GCC target( isa ) )
+#   define LIBGRAPHICS_SIMD_TARGET_END LIBGRAPHICS_SIMD_PRAGMA( GCC pop_options )
+#else
+#   define LIBGRAPHICS_SIMD_TARGET_BEGIN(isa)
+#   define LIBGRAPHICS_SIMD_TARGET_END
+#endif
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+namespace simd {
+
+namespace {
+struct KernelTable {
+    BinaryRowKernel binary[EBinaryOperation::Count][EElementType::Count];
+    UnaryRowKernel  unary[EUnaryOperation::Count][EElementType::Count];
+
+    KernelTable() {
+        std::fill( &binary[0][0], &binary[0][0] + EBinaryOperation::Count * EElementType::Count, nullptr );
+        std::fill( &unary[0][0], &unary[0][0] + EUnaryOperation::Count * EElementType::Count, nullptr );
+    }
+};
+}
+
+#ifdef LIBGRAPHICS_SIMD_X86
+
+LIBGRAPHICS_SIMD_TARGET_BEGIN( "sse4.1" )
+namespace sse41 {
+struct vec {
+    typedef __m128i vi;
+    typedef __m128  vf;
+
+    static const size_t bytes = 16;
+
+    static inline vi load( const unsigned char* p ) {
+        return _mm_loadu_si128( ( const __m128i* )p );
+    }
+    static inline vi load( const unsigned short* p ) {
+        return _mm_loadu_si128( ( const __m128i* )p );
+    }
+    static inline vf load( const float* p ) {
+        return _mm_loadu_ps( p );
+    }
+    static inline void store( unsigned char* p, vi v ) {
+        _mm_storeu_si128( ( __m128i* )p, v );
+    }
+    static inline void store( unsigned short* p, vi v ) {
+        _mm_storeu_si128( ( __m128i* )p, v );
+    }
+    static inline void store( float* p, vf v ) {
+        _mm_storeu_ps( p, v );
+    }
+
+    static inline vi set1_u8( unsigned char v ) {
+        return _mm_set1_epi8( ( char )v );
+    }
+    static inline vi set1_i16( short v ) {
+        return _mm_set1_epi16( v );
+    }
+    static inline vi set1_i32( int v ) {
+        return _mm_set1_epi32( v );
+    }
+    static inline vf set1_f32( float v ) {
+        return _mm_set1_ps( v );
+    }
+
+    static inline vi or_( vi a, vi b ) {
+        return _mm_or_si128( a, b );
+    }
+    static inline vi cmpeq_u8( vi a, vi b ) {
+        return _mm_cmpeq_epi8( a, b );
+    }
+    static inline vi adds_u8( vi a, vi b ) {
+        return _mm_adds_epu8( a, b );
+    }
+    static inline vi subs_u8( vi a, vi b ) {
+        return _mm_subs_epu8( a, b );
+    }
+    static inline vi min_u8( vi a, vi b ) {
+        return _mm_min_epu8( a, b );
+    }
+    static inline vi max_u8( vi a, vi b ) {
+        return _mm_max_epu8( a, b );
+    }
+    static inline vi adds_u16( vi a, vi b ) {
+        return _mm_adds_epu16( a, b );
+    }
+    static inline vi subs_u16( vi a, vi b ) {
+        return _mm_subs_epu16( a, b );
+    }
+    static inline vi min_u16( vi a, vi b ) {
+        return _mm_min_epu16( a, b );
+    }
+    static inline vi max_u16( vi a, vi b ) {
+        return _mm_max_epu16( a, b );
+    }
+    static inline vi add_i16( vi a, vi b ) {
+        return _mm_add_epi16( a, b );
+    }
+    static inline vi sub_i16( vi a, vi b ) {
+        return _mm_sub_epi16( a, b );
+    }
+    static inline vi add_i32( vi a, vi b ) {
+        return _mm_add_epi32( a, b );
+    }
+    static inline vi sub_i32( vi a, vi b ) {
+        return _mm_sub_epi32( a, b );
+    }
+
+    static inline vi widenlo_u8( vi v ) {
+        return _mm_unpacklo_epi8( v, _mm_setzero_si128() );
+    }
+    static inline vi widenhi_u8( vi v ) {
+        return _mm_unpackhi_epi8( v, _mm_setzero_si128() );
+    }
+    static inline vi widenlo_u16( vi v ) {
+        return _mm_unpacklo_epi16( v, _mm_setzero_si128() );
+    }
+    static inline vi widenhi_u16( vi v ) {
+        return _mm_unpackhi_epi16( v, _mm_setzero_si128() );
+    }
+    static inline vi packus_i16( vi a, vi b ) {
+        return _mm_packus_epi16( a, b );
+    }
+    static inline vi packus_i32( vi a, vi b ) {
+        return _mm_packus_epi32( a, b );
+    }
+
+    static inline vf add_f32( vf a, vf b ) {
+        return _mm_add_ps( a, b );
+    }
+    static inline vf sub_f32( vf a, vf b ) {
+        return _mm_sub_ps( a, b );
+    }
+    static inline vf mul_f32( vf a, vf b ) {
+        return _mm_mul_ps( a, b );
+    }
+    static inline vf div_f32( vf a, vf b ) {
+        return _mm_div_ps( a, b );
+    }
+    static inline vf min_f32( vf a, vf b ) {
+        return _mm_min_ps( a, b );
+    }
+    static inline vf max_f32( vf a, vf b ) {
+        return _mm_max_ps( a, b );
+    }
+    static inline vf ceil_f32( vf v ) {
+        return _mm_ceil_ps( v );
+    }
+    static inline vf cvt_i32_f32( vi v ) {
+        return _mm_cvtepi32_ps( v );
+    }
+    static inline vi cvtt_f32_i32( vf v ) {
+        return _mm_cvttps_epi32( v );
+    }
+};
+
+#include <libgraphics/fx/operations/helpers/cpu_simd_kernels.hpp>
+}
+LIBGRAPHICS_SIMD_TARGET_END
+
+/// the avx2 pack and unpack instructions work on the
+/// two 128 bit halves separately. widening followed by
+/// packing keeps the element order.
+LIBGRAPHICS_SIMD_TARGET_BEGIN( "avx2" )
+namespace avx2 {
+struct vec {
+    typedef __m256i vi;
+    typedef __m256  vf;
+
+    static const size_t bytes = 32;
+
+    static inline vi load( const unsigned char* p ) {
+        return _mm256_loadu_si256( ( const __m256i* )p );
+    }
+    static inline vi load( const unsigned short* p ) {
+        return _mm256_loadu_si256( ( const __m256i* )p );
+    }
+    static inline vf load( const float* p ) {
+        return _mm256_loadu_ps( p );
+    }
+    static inline void store( unsigned char* p, vi v ) {
+        _mm256_storeu_si256( ( __m256i* )p, v );
+    }
+    static inline void store( unsigned short* p, vi v ) {
+        _mm256_storeu_si256( ( __m256i* )p, v );
+    }
+    static inline void store( float* p, vf v ) {
+        _mm256_storeu_ps( p, v );
+    }
+
+    static inline vi set1_u8( unsigned char v ) {
+        return _mm256_set1_epi8( ( char )v );
+    }
+    static inline vi set1_i16( short v ) {
+        return _mm256_set1_epi16( v );
+    }
+    static inline vi set1_i32( int v ) {
+        return _mm256_set1_epi32( v );
+    }
+    static inline vf set1_f32( float v ) {
+        return _mm256_set1_ps( v );
+    }
+
+    static inline vi or_( vi a, vi b ) {
+        return _mm256_or_si256( a, b );
+    }
+    static inline vi cmpeq_u8( vi a, vi b ) {
+        return _mm256_cmpeq_epi8( a, b );
+    }
+    static inline vi adds_u8( vi a, vi b ) {
+        return _mm256_adds_epu8( a, b );
+    }
+    static inline vi subs_u8( vi a, vi b ) {
+        return _mm256_subs_epu8( a, b );
+    }
+    static inline vi min_u8( vi a, vi b ) {
+        return _mm256_min_epu8( a, b );
+    }
+    static inline vi max_u8( vi a, vi b ) {
+        return _mm256_max_epu8( a, b );
+    }
+    static inline vi adds_u16( vi a, vi b ) {
+        return _mm256_adds_epu16( a, b );
+    }
+    static inline vi subs_u16( vi a, vi b ) {
+        return _mm256_subs_epu16( a, b );
+    }
+    static inline vi min_u16( vi a, vi b ) {
+        return _mm256_min_epu16( a, b );
+    }
+    static inline vi max_u16( vi a, vi b ) {
+        return _mm256_max_epu16( a, b );
+    }
+    static inline vi add_i16( vi a, vi b ) {
+        return _mm256_add_epi16( a, b );
+    }
+    static inline vi sub_i16( vi a, vi b ) {
+        return _mm256_sub_epi16( a, b );
+    }
+    static inline vi add_i32( vi a, vi b ) {
+        return _mm256_add_epi32( a, b );
+    }
+    static inline vi sub_i32( vi a, vi b ) {
+        return _mm256_sub_epi32( a, b );
+    }
+
+    static inline vi widenlo_u8( vi v ) {
+        return _mm256_unpacklo_epi8( v, _mm256_setzero_si256() );
+    }
+    static inline vi widenhi_u8( vi v ) {
+        return _mm256_unpackhi_epi8( v, _mm256_setzero_si256() );
+    }
+    static inline vi widenlo_u16( vi v ) {
+        return _mm256_unpacklo_epi16( v, _mm256_setzero_si256() );
+    }
+    static inline vi widenhi_u16( vi v ) {
+        return _mm256_unpackhi_epi16( v, _mm256_setzero_si256() );
+    }
+    static inline vi packus_i16( vi a, vi b ) {
+        return _mm256_packus_epi16( a, b );
+    }
+    static inline vi packus_i32( vi a, vi b ) {
+        return _mm256_packus_epi32( a, b );
+    }
+
+    static inline vf add_f32( vf a, vf b ) {
+        return _mm256_add_ps( a, b );
+    }
+    static inline vf sub_f32( vf a, vf b ) {
+        return _mm256_sub_ps( a, b );
+    }
+    static inline vf mul_f32( vf a, vf b ) {
+        return _mm256_mul_ps( a, b );
+    }
+    static inline vf div_f32( vf a, vf b ) {
+        return _mm256_div_ps( a, b );
+    }
+    static inline vf min_f32( vf a, vf b ) {
+        return _mm256_min_ps( a, b );
+    }
+    static inline vf max_f32( vf a, vf b ) {
+        return _mm256_max_ps( a, b );
+    }
+    static inline vf ceil_f32( vf v ) {
+        return _mm256_ceil_ps( v );
+    }
+    static inline vf cvt_i32_f32( vi v ) {
+        return _mm256_cvtepi32_ps( v );
+    }
+    static inline vi cvtt_f32_i32( vf v ) {
+        return _mm256_cvttps_epi32( v );
+    }
+};
+
+#include <libgraphics/fx/operations/helpers/cpu_simd_kernels.hpp>
+}
+LIBGRAPHICS_SIMD_TARGET_END
+
+#endif
+
+namespace {
+EInstructionSet::t bestSupportedInstructionSet() {
+    static const EInstructionSet::t best = []() {
+        const SystemInfo::CpuFeatures features = SystemInfo::queryCpuFeatures();
+
+#ifdef LIBGRAPHICS_SIMD_X86
+
+        if( features.avx2 ) {
+            return EInstructionSet::AVX2;
+        }
+
+        if( features.sse41 ) {
+            return EInstructionSet::SSE41;
+        }
+
+#else
+        ( void )features;
+#endif
+        return EInstructionSet::Scalar;
+    }();
+
+    return best;
+}
+
+std::atomic<int>& activeInstructionSet() {
+    static std::atomic<int> active( bestSupportedInstructionSet() );
+    return active;
+}
+
+const KernelTable& kernelTable( EInstructionSet::t set ) {
+    struct KernelTables {
+        KernelTable tables[EInstructionSet::Count];
+
+        KernelTables() {
+#ifdef LIBGRAPHICS_SIMD_X86
+            sse41::fillKernelTable( tables[EInstructionSet::SSE41] );
+            avx2::fillKernelTable( tables[EInstructionSet::AVX2] );
+#endif
+        }
+    };
+    static const KernelTables kernels;
+
+    return kernels.tables[set];
+}
+}
+
+EInstructionSet::t instructionSet() {
+    return ( EInstructionSet::t )activeInstructionSet().load( std::memory_order_relaxed );
+}
+
+void setInstructionSet( EInstructionSet::t set ) {
+    activeInstructionSet().store(
+        std::min( set, bestSupportedInstructionSet() ),
+        std::memory_order_relaxed
+    );
+}
+
+BinaryRowKernel binaryRowKernel( EBinaryOperation::t operation, EElementType::t type ) {
+    assert( operation < EBinaryOperation::Count );
+    assert( type < EElementType::Count );
+
+    return kernelTable( instructionSet() ).binary[operation][type];
+}
+
+UnaryRowKernel unaryRowKernel( EUnaryOperation::t operation, EElementType::t type ) {
+    assert( operation < EUnaryOperation::Count );
+    assert( type < EElementType::Count );
+
+    return kernelTable( instructionSet() ).unary[operation][type];
+}
+
+}
+}
+}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <libgraphics/base.hpp>
+
+#include <cstddef>
+
+namespace libgraphics {
+namespace fx {
+namespace operations {
+namespace simd {
+
+struct EInstructionSet {
+    enum t {
+        Scalar,
+        SSE41,
+        AVX2,
+        Count
+    };
+};
+
+struct EBinaryOperation {
+    enum t {
+        Add,
+        Subtract,
+        Multiply,
+        Min,
+        Max,
+        GrainExtract,
+        GrainMerge,
+        Difference,
+        Screen,
+        Overlay,
+        Dodge,
+        Burn,
+        Count
+    };
+};
+
+struct EUnaryOperation {
+    enum t {
+        Negate,
+        Count
+    };
+};
+
+struct EElementType {
+    enum t {
+        UInt8,
+        UInt16,
+        Float32,
+        Count
+    };
+};
+
+/// row kernels work on count interleaved elements, the
+/// destination may be one of the sources.
+typedef void ( *BinaryRowKernel )( void* destination, const void* source0, const void* source1, size_t count );
+typedef void ( *UnaryRowKernel )( void* destination, const void* source0, size_t count );
+
+/// returns the instruction set used by the row kernels. it
+/// is picked from SystemInfo::queryCpuFeatures() on first use.
+EInstructionSet::t instructionSet();
+
+/// overrides the instruction set, e.g. to compare the results
+/// against the scalar kernels. sets that are not supported by
+/// the cpu fall back to the best supported one.
+void setInstructionSet( EInstructionSet::t set );
+
+/// returns the vectorized row kernel of the operation or
+/// nullptr, if the operation has to run on the scalar path.
+/// the kernels produce the same results as the scalar
+/// operations in operation_basic_arithmetic_impl_cpu.cpp.
+BinaryRowKernel binaryRowKernel( EBinaryOperation::t operation, EElementType::t type );
+UnaryRowKernel unaryRowKernel( EUnaryOperation::t operation, EElementType::t type );
+
+}
+}
+}
+}
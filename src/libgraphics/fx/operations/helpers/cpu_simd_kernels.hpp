@@ -0,0 +1,397 @@
+/// row kernels shared by all instruction sets. there is
+/// no include guard: cpu_simd.cpp includes this file once
+/// per instruction set, inside a namespace that defines the
+/// vector primitives as struct vec and with the matching
+/// compiler target enabled.
+
+/** unsigned char **/
+struct op_add_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::adds_u8( a, b );
+    }
+};
+struct op_sub_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::subs_u8( a, b );
+    }
+};
+struct op_min_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::min_u8( a, b );
+    }
+};
+struct op_max_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::max_u8( a, b );
+    }
+};
+struct op_difference_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::or_( vec::subs_u8( a, b ), vec::subs_u8( b, a ) );
+    }
+};
+struct op_negate_u8 {
+    static inline vec::vi run( vec::vi a ) {
+        return vec::subs_u8( vec::set1_u8( 255 ), a );
+    }
+};
+/// a - b + 127 and a + b - 127, computed in 16 bit
+/// and saturated to [0, 255] by the pack.
+struct op_grain_extract_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vi half = vec::set1_i16( 127 );
+
+        return vec::packus_i16(
+                   vec::add_i16( vec::sub_i16( vec::widenlo_u8( a ), vec::widenlo_u8( b ) ), half ),
+                   vec::add_i16( vec::sub_i16( vec::widenhi_u8( a ), vec::widenhi_u8( b ) ), half )
+               );
+    }
+};
+struct op_grain_merge_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vi half = vec::set1_i16( 127 );
+
+        return vec::packus_i16(
+                   vec::sub_i16( vec::add_i16( vec::widenlo_u8( a ), vec::widenlo_u8( b ) ), half ),
+                   vec::sub_i16( vec::add_i16( vec::widenhi_u8( a ), vec::widenhi_u8( b ) ), half )
+               );
+    }
+};
+
+/// 255 - ( 255 - a ) * ( 255 - b ) * 255 like op_screen,
+/// which saturates to 0 unless one of the values is 255.
+struct op_screen_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vi maxValue = vec::set1_u8( 255 );
+        return vec::or_( vec::cmpeq_u8( a, maxValue ), vec::cmpeq_u8( b, maxValue ) );
+    }
+};
+
+/// runs _t_lanes on the 32 bit lanes of a and b and
+/// saturates the results to [0, 255].
+template < class _t_lanes >
+inline vec::vi mapLanes_u8( vec::vi a, vec::vi b ) {
+    const vec::vi a0 = vec::widenlo_u8( a );
+    const vec::vi a1 = vec::widenhi_u8( a );
+    const vec::vi b0 = vec::widenlo_u8( b );
+    const vec::vi b1 = vec::widenhi_u8( b );
+
+    return vec::packus_i16(
+               vec::packus_i32(
+                   _t_lanes::run( vec::widenlo_u16( a0 ), vec::widenlo_u16( b0 ) ),
+                   _t_lanes::run( vec::widenhi_u16( a0 ), vec::widenhi_u16( b0 ) )
+               ),
+               vec::packus_i32(
+                   _t_lanes::run( vec::widenlo_u16( a1 ), vec::widenlo_u16( b1 ) ),
+                   _t_lanes::run( vec::widenhi_u16( a1 ), vec::widenhi_u16( b1 ) )
+               )
+           );
+}
+
+/// ceil( a / 255 * ( a + 2 * b / 255 * ( 255 - a ) ) ),
+/// in the operation order of op_overlay.
+struct lanes_overlay_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vf maxValue  = vec::set1_f32( 255.0f );
+        const vec::vf fa        = vec::cvt_i32_f32( a );
+        const vec::vf fb        = vec::cvt_i32_f32( b );
+
+        const vec::vf weight    = vec::div_f32( vec::mul_f32( vec::set1_f32( 2.0f ), fb ), maxValue );
+        const vec::vf value     = vec::mul_f32(
+                                      vec::div_f32( fa, maxValue ),
+                                      vec::add_f32( fa, vec::mul_f32( weight, vec::sub_f32( maxValue, fa ) ) )
+                                  );
+
+        return vec::cvtt_f32_i32( vec::ceil_f32( value ) );
+    }
+};
+
+/// the integer divisions of op_dodge and op_burn. the
+/// dividends stay below 2^16, so the truncated float
+/// quotient is exact.
+struct lanes_dodge_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vf dividend  = vec::cvt_i32_f32( a );
+        const vec::vf divisor   = vec::cvt_i32_f32( vec::sub_i32( vec::set1_i32( 256 ), b ) );
+
+        const vec::vf quotient  = vec::div_f32( vec::mul_f32( vec::set1_f32( 256.0f ), dividend ), divisor );
+
+        /** the 16 bit pack is signed, keep the lanes below 2^15 */
+        return vec::cvtt_f32_i32( vec::min_f32( quotient, vec::set1_f32( 255.0f ) ) );
+    }
+};
+struct lanes_burn_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vf dividend  = vec::cvt_i32_f32( vec::sub_i32( vec::set1_i32( 255 ), a ) );
+        const vec::vf divisor   = vec::cvt_i32_f32( vec::add_i32( b, vec::set1_i32( 1 ) ) );
+        const vec::vi quotient  = vec::cvtt_f32_i32( vec::div_f32( vec::mul_f32( vec::set1_f32( 256.0f ), dividend ), divisor ) );
+
+        return vec::sub_i32( vec::set1_i32( 255 ), quotient );
+    }
+};
+struct op_overlay_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return mapLanes_u8<lanes_overlay_u8>( a, b );
+    }
+};
+struct op_dodge_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return mapLanes_u8<lanes_dodge_u8>( a, b );
+    }
+};
+struct op_burn_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return mapLanes_u8<lanes_burn_u8>( a, b );
+    }
+};
+
+/** unsigned short **/
+struct op_add_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::adds_u16( a, b );
+    }
+};
+struct op_sub_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::subs_u16( a, b );
+    }
+};
+struct op_min_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::min_u16( a, b );
+    }
+};
+struct op_max_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::max_u16( a, b );
+    }
+};
+struct op_difference_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        return vec::or_( vec::subs_u16( a, b ), vec::subs_u16( b, a ) );
+    }
+};
+struct op_negate_u16 {
+    static inline vec::vi run( vec::vi a ) {
+        return vec::subs_u16( vec::set1_i16( -1 ), a );
+    }
+};
+struct op_grain_extract_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vi half = vec::set1_i32( 32767 );
+
+        return vec::packus_i32(
+                   vec::add_i32( vec::sub_i32( vec::widenlo_u16( a ), vec::widenlo_u16( b ) ), half ),
+                   vec::add_i32( vec::sub_i32( vec::widenhi_u16( a ), vec::widenhi_u16( b ) ), half )
+               );
+    }
+};
+struct op_grain_merge_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vi half = vec::set1_i32( 32767 );
+
+        return vec::packus_i32(
+                   vec::sub_i32( vec::add_i32( vec::widenlo_u16( a ), vec::widenlo_u16( b ) ), half ),
+                   vec::sub_i32( vec::add_i32( vec::widenhi_u16( a ), vec::widenhi_u16( b ) ), half )
+               );
+    }
+};
+
+/// ceil( a * ( b / max ) ) like op_mul, the 32 bit
+/// lanes are converted to float and back.
+inline vec::vi multiplyLanes( vec::vi a, vec::vi b, vec::vf maxValue ) {
+    const vec::vf relative = vec::div_f32( vec::cvt_i32_f32( b ), maxValue );
+    return vec::cvtt_f32_i32( vec::ceil_f32( vec::mul_f32( vec::cvt_i32_f32( a ), relative ) ) );
+}
+struct op_multiply_u8 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vf maxValue = vec::set1_f32( 255.0f );
+
+        const vec::vi a0 = vec::widenlo_u8( a );
+        const vec::vi a1 = vec::widenhi_u8( a );
+        const vec::vi b0 = vec::widenlo_u8( b );
+        const vec::vi b1 = vec::widenhi_u8( b );
+
+        return vec::packus_i16(
+                   vec::packus_i32(
+                       multiplyLanes( vec::widenlo_u16( a0 ), vec::widenlo_u16( b0 ), maxValue ),
+                       multiplyLanes( vec::widenhi_u16( a0 ), vec::widenhi_u16( b0 ), maxValue )
+                   ),
+                   vec::packus_i32(
+                       multiplyLanes( vec::widenlo_u16( a1 ), vec::widenlo_u16( b1 ), maxValue ),
+                       multiplyLanes( vec::widenhi_u16( a1 ), vec::widenhi_u16( b1 ), maxValue )
+                   )
+               );
+    }
+};
+struct op_multiply_u16 {
+    static inline vec::vi run( vec::vi a, vec::vi b ) {
+        const vec::vf maxValue = vec::set1_f32( 65535.0f );
+
+        return vec::packus_i32(
+                   multiplyLanes( vec::widenlo_u16( a ), vec::widenlo_u16( b ), maxValue ),
+                   multiplyLanes( vec::widenhi_u16( a ), vec::widenhi_u16( b ), maxValue )
+               );
+    }
+};
+
+/** float **/
+struct op_add_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::add_f32( a, b );
+    }
+};
+struct op_sub_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::sub_f32( a, b );
+    }
+};
+/// std::min( a, b ) returns a unless b < a, the
+/// vector min returns its second operand unless the
+/// first one is smaller.
+struct op_min_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::min_f32( b, a );
+    }
+};
+struct op_max_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::max_f32( b, a );
+    }
+};
+struct op_multiply_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::max_f32( vec::min_f32( vec::mul_f32( a, b ), vec::set1_f32( 1.0f ) ), vec::set1_f32( 0.0f ) );
+    }
+};
+struct op_grain_extract_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::add_f32( vec::sub_f32( a, b ), vec::set1_f32( 0.5f ) );
+    }
+};
+struct op_grain_merge_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::sub_f32( vec::add_f32( a, b ), vec::set1_f32( 0.5f ) );
+    }
+};
+struct op_screen_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        const vec::vf one = vec::set1_f32( 1.0f );
+        return vec::sub_f32( one, vec::mul_f32( vec::sub_f32( one, a ), vec::sub_f32( one, b ) ) );
+    }
+};
+struct op_overlay_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        const vec::vf weight = vec::mul_f32( vec::set1_f32( 2.0f ), b );
+        return vec::mul_f32( a, vec::add_f32( a, vec::mul_f32( weight, vec::sub_f32( vec::set1_f32( 1.0f ), a ) ) ) );
+    }
+};
+struct op_dodge_f32 {
+    static inline vec::vf run( vec::vf a, vec::vf b ) {
+        return vec::div_f32( a, vec::sub_f32( vec::set1_f32( 1.0f ), b ) );
+    }
+};
+struct op_negate_f32 {
+    static inline vec::vf run( vec::vf a ) {
+        return vec::sub_f32( vec::set1_f32( 1.0f ), a );
+    }
+};
+
+/// processes full vectors in place and the remaining
+/// elements in a zero padded copy.
+template < class _t_op, class _t_element >
+void binaryRows( void* destination, const void* source0, const void* source1, size_t count ) {
+    static const size_t step = vec::bytes / sizeof( _t_element );
+
+    _t_element*         dst     = ( _t_element* )destination;
+    const _t_element*   src0    = ( const _t_element* )source0;
+    const _t_element*   src1    = ( const _t_element* )source1;
+
+    size_t i = 0;
+
+    for( ; count >= i + step; i += step ) {
+        vec::store( dst + i, _t_op::run( vec::load( src0 + i ), vec::load( src1 + i ) ) );
+    }
+
+    if( count > i ) {
+        _t_element first[step] = { 0 };
+        _t_element second[step] = { 0 };
+
+        std::copy( src0 + i, src0 + count, first );
+        std::copy( src1 + i, src1 + count, second );
+
+        vec::store( first, _t_op::run( vec::load( first ), vec::load( second ) ) );
+
+        std::copy( first, first + ( count - i ), dst + i );
+    }
+}
+
+template < class _t_op, class _t_element >
+void unaryRows( void* destination, const void* source0, size_t count ) {
+    static const size_t step = vec::bytes / sizeof( _t_element );
+
+    _t_element*         dst     = ( _t_element* )destination;
+    const _t_element*   src0    = ( const _t_element* )source0;
+
+    size_t i = 0;
+
+    for( ; count >= i + step; i += step ) {
+        vec::store( dst + i, _t_op::run( vec::load( src0 + i ) ) );
+    }
+
+    if( count > i ) {
+        _t_element first[step] = { 0 };
+
+        std::copy( src0 + i, src0 + count, first );
+
+        vec::store( first, _t_op::run( vec::load( first ) ) );
+
+        std::copy( first, first + ( count - i ), dst + i );
+    }
+}
+
+inline void fillKernelTable( KernelTable& table ) {
+    typedef unsigned char   u8;
+    typedef unsigned short  u16;
+
+    table.binary[EBinaryOperation::Add][EElementType::UInt8]            = &binaryRows<op_add_u8, u8>;
+    table.binary[EBinaryOperation::Subtract][EElementType::UInt8]       = &binaryRows<op_sub_u8, u8>;
+    table.binary[EBinaryOperation::Multiply][EElementType::UInt8]       = &binaryRows<op_multiply_u8, u8>;
+    table.binary[EBinaryOperation::Min][EElementType::UInt8]            = &binaryRows<op_min_u8, u8>;
+    table.binary[EBinaryOperation::Max][EElementType::UInt8]            = &binaryRows<op_max_u8, u8>;
+    table.binary[EBinaryOperation::GrainExtract][EElementType::UInt8]   = &binaryRows<op_grain_extract_u8, u8>;
+    table.binary[EBinaryOperation::GrainMerge][EElementType::UInt8]     = &binaryRows<op_grain_merge_u8, u8>;
+    table.binary[EBinaryOperation::Difference][EElementType::UInt8]     = &binaryRows<op_difference_u8, u8>;
+    table.binary[EBinaryOperation::Screen][EElementType::UInt8]         = &binaryRows<op_screen_u8, u8>;
+    table.binary[EBinaryOperation::Overlay][EElementType::UInt8]        = &binaryRows<op_overlay_u8, u8>;
+    table.binary[EBinaryOperation::Dodge][EElementType::UInt8]          = &binaryRows<op_dodge_u8, u8>;
+    table.binary[EBinaryOperation::Burn][EElementType::UInt8]           = &binaryRows<op_burn_u8, u8>;
+
+    table.binary[EBinaryOperation::Add][EElementType::UInt16]           = &binaryRows<op_add_u16, u16>;
+    table.binary[EBinaryOperation::Subtract][EElementType::UInt16]      = &binaryRows<op_sub_u16, u16>;
+    table.binary[EBinaryOperation::Multiply][EElementType::UInt16]      = &binaryRows<op_multiply_u16, u16>;
+    table.binary[EBinaryOperation::Min][EElementType::UInt16]           = &binaryRows<op_min_u16, u16>;
+    table.binary[EBinaryOperation::Max][EElementType::UInt16]           = &binaryRows<op_max_u16, u16>;
+    table.binary[EBinaryOperation::GrainExtract][EElementType::UInt16]  = &binaryRows<op_grain_extract_u16, u16>;
+    table.binary[EBinaryOperation::GrainMerge][EElementType::UInt16]    = &binaryRows<op_grain_merge_u16, u16>;
+    table.binary[EBinaryOperation::Difference][EElementType::UInt16]    = &binaryRows<op_difference_u16, u16>;
+
+    /** the 16 bit blends overflow int in op_screen, op_dodge and op_burn
+        and are dispatched as short anyway, they stay scalar **/
+
+    /** op_difference<float> and op_burn<float> truncate to int, stay scalar **/
+    table.binary[EBinaryOperation::Add][EElementType::Float32]          = &binaryRows<op_add_f32, float>;
+    table.binary[EBinaryOperation::Subtract][EElementType::Float32]     = &binaryRows<op_sub_f32, float>;
+    table.binary[EBinaryOperation::Multiply][EElementType::Float32]     = &binaryRows<op_multiply_f32, float>;
+    table.binary[EBinaryOperation::Min][EElementType::Float32]          = &binaryRows<op_min_f32, float>;
+    table.binary[EBinaryOperation::Max][EElementType::Float32]          = &binaryRows<op_max_f32, float>;
+    table.binary[EBinaryOperation::GrainExtract][EElementType::Float32] = &binaryRows<op_grain_extract_f32, float>;
+    table.binary[EBinaryOperation::GrainMerge][EElementType::Float32]   = &binaryRows<op_grain_merge_f32, float>;
+    table.binary[EBinaryOperation::Screen][EElementType::Float32]       = &binaryRows<op_screen_f32, float>;
+    table.binary[EBinaryOperation::Overlay][EElementType::Float32]      = &binaryRows<op_overlay_f32, float>;
+    table.binary[EBinaryOperation::Dodge][EElementType::Float32]        = &binaryRows<op_dodge_f32, float>;
+
+    table.unary[EUnaryOperation::Negate][EElementType::UInt8]           = &unaryRows<op_negate_u8, u8>;
+    table.unary[EUnaryOperation::Negate][EElementType::UInt16]          = &unaryRows<op_negate_u16, u16>;
+    table.unary[EUnaryOperation::Negate][EElementType::Float32]         = &unaryRows<op_negate_f32, float>;
+}
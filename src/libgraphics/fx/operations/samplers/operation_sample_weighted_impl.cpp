@@ -26,7 +26,7 @@ void sampleWeightedSum2x2(
         sampleWeightedSum2x2_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             factor,
             weights
         );
@@ -35,7 +35,7 @@ void sampleWeightedSum2x2(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         sampleWeightedSum2x2_GEN(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst,
@@ -69,7 +69,7 @@ void sampleWeightedSum3x3(
         sampleWeightedSum3x3_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             factor,
             weights
         );
@@ -78,7 +78,7 @@ void sampleWeightedSum3x3(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         sampleWeightedSum3x3_GEN(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst,
@@ -112,7 +112,7 @@ void sampleWeightedSum4x4(
         sampleWeightedSum4x4_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             factor,
             weights
         );
@@ -121,7 +121,7 @@ void sampleWeightedSum4x4(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         sampleWeightedSum4x4_GEN(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst,
@@ -155,7 +155,7 @@ void sampleWeightedSum5x5(
         sampleWeightedSum5x5_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             factor,
             weights
         );
@@ -164,7 +164,7 @@ void sampleWeightedSum5x5(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         sampleWeightedSum5x5_GEN(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst,
@@ -198,7 +198,7 @@ void sampleWeightedSum6x6(
         sampleWeightedSum6x6_CPU(
             dst->internalDeviceForBackend( FXAPI_BACKEND_CPU ),
             dst->internalImageForBackend( FXAPI_BACKEND_CPU ),
-            src->internalImageForBackend( FXAPI_BACKEND_CPU ),
+            src->sourceImageForBackend( FXAPI_BACKEND_CPU ),
             factor,
             weights
         );
@@ -207,7 +207,7 @@ void sampleWeightedSum6x6(
         rendered = true;
     }
 
-    if( dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
+    if( !rendered && dst->containsDataForBackend( FXAPI_BACKEND_OPENGL ) && src->containsDataForBackend( FXAPI_BACKEND_OPENGL ) ) {
         sampleWeightedSum6x6_GEN(
             dst->internalDeviceForBackend( FXAPI_BACKEND_OPENGL ),
             dst,
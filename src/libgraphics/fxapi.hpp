@@ -487,6 +487,32 @@ static inline const EPixelFormat::t getAssociatedAlphaFormat( const EPixelFormat
 
     return hasAlphaPlane( format ) ? format : EPixelFormat::Empty;
 }
+/// returns the single channel format with the same channel
+/// type. formats with an alpha plane have no mono equivalent.
+static inline const EPixelFormat::t getAssociatedMonoFormat( const EPixelFormat::t& format ) {
+    switch( format ) {
+        case t::Mono8:
+        case t::RGB8:
+            return t::Mono8;
+
+        case t::Mono16:
+        case t::RGB16:
+            return t::Mono16;
+
+        case t::Mono16S:
+        case t::RGB16S:
+            return t::Mono16S;
+
+        case t::Mono32F:
+        case t::RGB32F:
+            return t::Mono32F;
+
+        default:
+            break;
+    }
+
+    return EPixelFormat::Empty;
+}
 static inline const EPixelFormat::t getCompatibleSignedFormat( const EPixelFormat::t& unsigned_format ) {
     switch( unsigned_format ) {
         case t::Mono8:
@@ -1,6 +1,99 @@
-
 #include <libgraphics/allocator.hpp>
 
+#include <stdlib.h>
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+#   include <Windows.h>
+#   include <malloc.h>
+#else
+#   include <sys/mman.h>
+#endif
+
 namespace libgraphics {
-/** dummy **/
+namespace memory {
+
+void* allocateAligned( size_t length, size_t alignment ) {
+    assert( length > 0 );
+    assert( ( alignment & ( alignment - 1 ) ) == 0 );
+
+    alignment = std::max( alignment, sizeof( void* ) );
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    return ::_aligned_malloc( length, alignment );
+#else
+    void* p( nullptr );
+
+    if( ::posix_memalign( &p, alignment, length ) != 0 ) {
+        return nullptr;
+    }
+
+    return p;
+#endif
+}
+
+void freeAligned( void* p ) {
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    ::_aligned_free( p );
+#else
+    ::free( p );
+#endif
+}
+
+void* allocatePages( size_t length, bool hugePages ) {
+    assert( length > 0 );
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    /** large pages need the SeLockMemoryPrivilege, which
+        is usually missing. **/
+    ( void )hugePages;
+
+    return ::VirtualAlloc( NULL, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE );
+#else
+    void* p( MAP_FAILED );
+
+#   if defined( MAP_HUGETLB )
+
+    /** reserved huge pages first, the length has to be a multiple of
+        the huge page size. **/
+    if( hugePages && ( length % HugePageLength == 0 ) ) {
+        p = ::mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+    }
+
+#   endif
+
+    if( p == MAP_FAILED ) {
+        p = ::mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+        if( p == MAP_FAILED ) {
+            return nullptr;
+        }
+
+#   if defined( MADV_HUGEPAGE )
+
+        /** transparent huge pages otherwise **/
+        if( hugePages ) {
+            ::madvise( p, length, MADV_HUGEPAGE );
+        }
+
+#   endif
+    }
+
+    return p;
+#endif
+}
+
+void freePages( void* p, size_t length ) {
+    if( p == nullptr ) {
+        return;
+    }
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    ( void )length;
+    ::VirtualFree( p, 0, MEM_RELEASE );
+#else
+    ::munmap( p, length );
+#endif
+}
+
+}
 }
@@ -2455,6 +2455,39 @@ bool Bitmap::reset( libgraphics::StdDynamicPoolAllocator* allocator, const Bitma
            );
 }
 
+bool Bitmap::reset( libgraphics::StdDynamicPoolAllocator* allocator, const libgraphics::Format& format, const int width, const int height, const std::shared_ptr<libgraphics::StdDynamicPoolAllocator::Blob>& blob ) {
+    assert( allocator != nullptr );
+    assert( width * height > 0 );
+    assert( blob && !blob->empty() );
+
+    if( allocator == nullptr || !blob || blob->empty() ) {
+        return false;
+    }
+
+    if( width * height <= 0 ) {
+        return false;
+    }
+
+    const auto successfullyResetted = this->reset();
+    assert( successfullyResetted );
+
+    if( !successfullyResetted ) {
+#ifdef LIBGRAPHICS_DEBUG
+        qDebug() << "Failed to reset bitmap. Aborting...";
+#endif
+        return false;
+    }
+
+    this->m_BitmapHeight            = height;
+    this->m_BitmapWidth             = width;
+    this->m_InternalAllocator       = allocator;
+    this->m_Format                  = format;
+    this->m_InternalMemoryBlob      = blob;
+    this->m_BitmapBuffer            = this->m_InternalMemoryBlob->data;
+
+    return true;
+}
+
 bool Bitmap::containsAllocator() const {
     return ( this->m_InternalAllocator != nullptr );
 }
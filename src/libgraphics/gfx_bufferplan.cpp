@@ -0,0 +1,139 @@
+#include <libgraphics/bufferplan.hpp>
+
+#include <algorithm>
+#include <assert.h>
+
+namespace libgraphics {
+
+BufferPlan::BufferPlan() : m_StageCount( 0 ), m_PeakMemory( 0 ) {}
+
+size_t BufferPlan::Buffer::byteSize() const {
+    return width * height * fxapi::EPixelFormat::getPixelSize( format );
+}
+
+size_t BufferPlan::addBuffer(
+    const std::string&      name,
+    fxapi::EPixelFormat::t  format,
+    size_t                  width,
+    size_t                  height,
+    size_t                  firstStage,
+    size_t                  lastStage
+) {
+    assert( format != fxapi::EPixelFormat::Empty );
+    assert( firstStage <= lastStage );
+
+    Buffer buffer;
+    buffer.name         = name;
+    buffer.format       = format;
+    buffer.width        = width;
+    buffer.height       = height;
+    buffer.firstStage   = firstStage;
+    buffer.lastStage    = std::max( firstStage, lastStage );
+    buffer.slot         = 0;
+
+    this->m_Buffers.push_back( buffer );
+    this->m_StageCount = std::max( this->m_StageCount, buffer.lastStage + 1 );
+
+    return this->m_Buffers.size() - 1;
+}
+
+size_t BufferPlan::bufferCount() const {
+    return this->m_Buffers.size();
+}
+
+size_t BufferPlan::stageCount() const {
+    return this->m_StageCount;
+}
+
+void BufferPlan::compute() {
+    this->m_Slots.clear();
+    this->m_PeakMemory = 0;
+
+    /** interval partitioning: buffers in order of their first stage,
+        a slot is reused as soon as its last buffer is dead **/
+    std::vector<size_t> order( this->m_Buffers.size() );
+
+    for( size_t i = 0; order.size() > i; ++i ) {
+        order[i] = i;
+    }
+
+    std::stable_sort( order.begin(), order.end(), [this]( size_t lhs, size_t rhs ) {
+        return this->m_Buffers[lhs].firstStage < this->m_Buffers[rhs].firstStage;
+    } );
+
+    for( auto it = order.begin(); it != order.end(); ++it ) {
+        Buffer& buffer = this->m_Buffers[*it];
+        bool    assigned( false );
+
+        for( size_t i = 0; this->m_Slots.size() > i; ++i ) {
+            Slot& slot = this->m_Slots[i];
+
+            if( ( slot.lastStage < buffer.firstStage ) &&
+                    ( slot.format == buffer.format ) &&
+                    ( slot.width == buffer.width ) &&
+                    ( slot.height == buffer.height ) ) {
+                slot.lastStage  = buffer.lastStage;
+                buffer.slot     = i;
+                assigned        = true;
+                break;
+            }
+        }
+
+        if( !assigned ) {
+            Slot slot;
+            slot.format     = buffer.format;
+            slot.width      = buffer.width;
+            slot.height     = buffer.height;
+            slot.lastStage  = buffer.lastStage;
+
+            buffer.slot = this->m_Slots.size();
+            this->m_Slots.push_back( slot );
+            this->m_PeakMemory += buffer.byteSize();
+        }
+    }
+}
+
+size_t BufferPlan::slotCount() const {
+    return this->m_Slots.size();
+}
+
+size_t BufferPlan::slot( size_t buffer ) const {
+    assert( this->m_Buffers.size() > buffer );
+
+    return this->m_Buffers[buffer].slot;
+}
+
+size_t BufferPlan::peakMemory() const {
+    return this->m_PeakMemory;
+}
+
+size_t BufferPlan::stageMemory( size_t stage ) const {
+    size_t bytes( 0 );
+
+    for( auto it = this->m_Buffers.begin(); it != this->m_Buffers.end(); ++it ) {
+        if( ( ( *it ).firstStage <= stage ) && ( ( *it ).lastStage >= stage ) ) {
+            bytes += ( *it ).byteSize();
+        }
+    }
+
+    return bytes;
+}
+
+size_t BufferPlan::unsharedMemory() const {
+    size_t bytes( 0 );
+
+    for( auto it = this->m_Buffers.begin(); it != this->m_Buffers.end(); ++it ) {
+        bytes += ( *it ).byteSize();
+    }
+
+    return bytes;
+}
+
+void BufferPlan::clear() {
+    this->m_Buffers.clear();
+    this->m_Slots.clear();
+    this->m_StageCount = 0;
+    this->m_PeakMemory = 0;
+}
+
+}
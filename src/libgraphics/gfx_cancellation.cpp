@@ -0,0 +1,42 @@
+#include <libgraphics/cancellation.hpp>
+
+namespace libgraphics {
+
+namespace {
+thread_local std::shared_ptr<CancellationToken> currentToken;
+}
+
+/// CancellationToken
+CancellationToken::CancellationToken() : m_Cancelled( false ) {}
+
+void CancellationToken::cancel() {
+    m_Cancelled.store( true, std::memory_order_relaxed );
+}
+
+void CancellationToken::reset() {
+    m_Cancelled.store( false, std::memory_order_relaxed );
+}
+
+bool CancellationToken::cancelled() const {
+    return m_Cancelled.load( std::memory_order_relaxed );
+}
+
+const std::shared_ptr<CancellationToken>& currentCancellationToken() {
+    return currentToken;
+}
+
+bool isCurrentOperationCancelled() {
+    return ( currentToken ) && currentToken->cancelled();
+}
+
+/// ScopedCancellationToken
+ScopedCancellationToken::ScopedCancellationToken( const std::shared_ptr<CancellationToken>& token ) :
+    m_Previous( currentToken ) {
+    currentToken = token;
+}
+
+ScopedCancellationToken::~ScopedCancellationToken() {
+    currentToken = m_Previous;
+}
+
+}
@@ -3,9 +3,9 @@
 
 namespace libgraphics {
 
-Filter::Filter( const std::string& _name, fxapi::ApiBackendDevice* _device ) : m_Name( _name ), m_Device( _device ) {}
+Filter::Filter( const std::string& _name, fxapi::ApiBackendDevice* _device ) : m_Name( _name ), m_Device( _device ), m_PixelScale( 1.0f ) {}
 
-Filter::Filter( fxapi::ApiBackendDevice* _device ) : m_Device( _device ) {}
+Filter::Filter( fxapi::ApiBackendDevice* _device ) : m_Device( _device ), m_PixelScale( 1.0f ) {}
 
 std::string& Filter::name() {
     return this->m_Name;
@@ -27,6 +27,64 @@ void Filter::setBackend( fxapi::ApiBackendDevice* _backend ) {
     this->m_Device = _backend;
 }
 
+bool Filter::process(
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
+) {
+    ( void )area;
+    return this->process( device, destination, source );
+}
+
+int Filter::haloRadius() const {
+    return 0;
+}
+
+void Filter::planBuffers(
+    BufferPlan&                 plan,
+    size_t                      stage,
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    size_t                      width,
+    size_t                      height
+) const {
+    ( void )plan;
+    ( void )stage;
+    ( void )device;
+    ( void )format;
+    ( void )width;
+    ( void )height;
+}
+
+void Filter::releaseBuffers() {}
+
+std::shared_ptr<const PointOperation> Filter::pointOperation( fxapi::EPixelFormat::t format ) {
+    ( void )format;
+    return std::shared_ptr<const PointOperation>();
+}
+
+bool Filter::producesMonochrome() const {
+    return false;
+}
+
+bool Filter::acceptsMonochrome() const {
+    return false;
+}
+
+float Filter::pixelScale() const {
+    return this->m_PixelScale;
+}
+
+void Filter::setPixelScale( float scale ) {
+    assert( scale > 0.0f );
+
+    if( this->m_PixelScale != scale ) {
+        this->m_PixelScale = scale;
+        this->releaseBuffers();
+    }
+}
+
 bool applyFilter(
     fxapi::ApiBackendDevice* backend,
     Filter* filter,
@@ -0,0 +1,221 @@
+#include <libgraphics/filterchain.hpp>
+#include <libgraphics/fx/operations/complex.hpp>
+#include <QDebug>
+
+#include <algorithm>
+
+namespace libgraphics {
+
+namespace {
+inline unsigned long long combineKeys( unsigned long long seed, unsigned long long value ) {
+    return seed ^ ( value + 0x9e3779b97f4a7c15ULL + ( seed << 6 ) + ( seed >> 2 ) );
+}
+}
+
+FilterChain::FilterChain(
+    const FilterStack&          stack,
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    bool                        monochromeWorkingFormat
+) {
+    assert( device );
+
+    const bool canFuse = ( device != nullptr ) && ( device->backendId() == FXAPI_BACKEND_CPU );
+
+    /** the single channel working format is only used for rgb
+        sources rendered by the cpu backend **/
+    const fxapi::EPixelFormat::t monoFormat = ( monochromeWorkingFormat && canFuse && ( fxapi::EPixelFormat::getChannelCount( format ) == 3 ) ) ?
+            fxapi::EPixelFormat::getAssociatedMonoFormat( format ) : fxapi::EPixelFormat::Empty;
+    bool isMonochrome( false );
+
+    for( auto it = stack.begin(); it != stack.end(); ++it ) {
+        std::shared_ptr<const PointOperation> operation;
+
+        /** after a b&w mixer the image stays single channel up to
+            the first filter, which needs the color channels **/
+        if( isMonochrome && !( *it )->acceptsMonochrome() ) {
+            isMonochrome = false;
+        }
+
+        const fxapi::EPixelFormat::t passFormat = isMonochrome ? monoFormat : format;
+
+        if( canFuse ) {
+            operation = ( *it )->pointOperation( passFormat );
+
+            if( operation && !operation->supportsFormat( passFormat ) ) {
+                operation.reset();
+            }
+        }
+
+        const unsigned long long presetKey = combineKeys(
+                                                 m_Passes.empty() ? 0 : m_Passes.back().presetKey,
+                                                 ( *it )->toPreset().hash()
+                                             );
+
+        if( ( monoFormat != fxapi::EPixelFormat::Empty ) && ( *it )->producesMonochrome() ) {
+            isMonochrome = true;
+        }
+
+        if( operation && !m_Passes.empty() && !m_Passes.back().operations.empty() &&
+                ( m_Passes.back().format == passFormat ) ) {
+            Pass& previous = m_Passes.back();
+
+            previous.filters.push_back( *it );
+            previous.operations.push_back( operation );
+            previous.presetKey = presetKey;
+            continue;
+        }
+
+        Pass pass;
+        pass.filters.push_back( *it );
+        pass.format    = passFormat;
+        pass.presetKey = presetKey;
+
+        if( operation ) {
+            pass.operations.push_back( operation );
+        }
+
+        m_Passes.push_back( pass );
+    }
+}
+
+size_t FilterChain::passCount() const {
+    return this->m_Passes.size();
+}
+
+size_t FilterChain::filterCount( size_t index ) const {
+    assert( index < this->m_Passes.size() );
+
+    return this->m_Passes[index].filters.size();
+}
+
+fxapi::EPixelFormat::t FilterChain::passFormat( size_t index ) const {
+    assert( index < this->m_Passes.size() );
+
+    return this->m_Passes[index].format;
+}
+
+unsigned long long FilterChain::passKey( size_t index, unsigned long long sourceKey ) const {
+    assert( index < this->m_Passes.size() );
+
+    return combineKeys( sourceKey, this->m_Passes[index].presetKey );
+}
+
+int FilterChain::haloRadius( size_t index ) const {
+    assert( index < this->m_Passes.size() );
+
+    int halo( 0 );
+
+    for( auto it = this->m_Passes[index].filters.begin(); it != this->m_Passes[index].filters.end(); ++it ) {
+        halo += ( *it )->haloRadius();
+    }
+
+    return halo;
+}
+
+Rect32I FilterChain::passArea(
+    size_t          index,
+    const Rect32I&  area,
+    size_t          width,
+    size_t          height
+) const {
+    assert( index < this->m_Passes.size() );
+
+    Rect32I expanded( area );
+
+    for( size_t pass = this->m_Passes.size() - 1; pass > index; --pass ) {
+        expanded = libgraphics::fx::operations::expandArea(
+                       expanded,
+                       this->haloRadius( pass ),
+                       width,
+                       height
+                   );
+    }
+
+    return expanded;
+}
+
+void FilterChain::planBuffers(
+    BufferPlan&                 plan,
+    fxapi::ApiBackendDevice*    device,
+    size_t                      width,
+    size_t                      height
+) const {
+    for( size_t index = 0; this->m_Passes.size() > index; ++index ) {
+        const Pass& pass = this->m_Passes[index];
+
+        for( auto it = pass.filters.begin(); it != pass.filters.end(); ++it ) {
+            ( *it )->planBuffers( plan, index, device, pass.format, width, height );
+        }
+    }
+}
+
+void FilterChain::releaseBuffers( size_t index ) {
+    assert( index < this->m_Passes.size() );
+
+    for( auto it = this->m_Passes[index].filters.begin(); it != this->m_Passes[index].filters.end(); ++it ) {
+        ( *it )->releaseBuffers();
+    }
+}
+
+bool FilterChain::processPass(
+    size_t                      index,
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source
+) {
+    assert( source );
+
+    return this->processPass(
+               index,
+               device,
+               destination,
+               source,
+               source->size()
+           );
+}
+
+bool FilterChain::processPass(
+    size_t                      index,
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    destination,
+    libgraphics::ImageLayer*    source,
+    const Rect32I&              area
+) {
+    assert( index < this->m_Passes.size() );
+    assert( device );
+    assert( destination );
+    assert( source );
+
+    if( index >= this->m_Passes.size() ) {
+        return false;
+    }
+
+    const Pass& pass = this->m_Passes[index];
+
+    /** a single point operation gains nothing from the fused pass */
+    if( pass.operations.size() < 2 ) {
+        return pass.filters.front()->process(
+                   device,
+                   destination,
+                   source,
+                   area
+               );
+    }
+
+#if LIBGRAPHICS_DEBUG_OUTPUT
+    qDebug() << "FilterChain::processPass(): Rendering" << pass.operations.size() << "fused point operations.";
+#endif
+
+    libgraphics::fx::operations::pointChain(
+        device,
+        destination,
+        source,
+        area,
+        pass.operations
+    );
+
+    return true;
+}
+
+}
@@ -4,6 +4,10 @@
 #include <log/log.hpp>
 #include <QDebug>
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 namespace libgraphics {
 
 /// impl: FilterPresetSerializationProvider
@@ -268,6 +272,91 @@ FilterPreset::FilterPreset() {}
 
 FilterPreset::FilterPreset( const std::string& name ) : m_Name( name ) {}
 
+namespace {
+/// fnv-1a
+static const unsigned long long FilterPresetHashSeed     = 14695981039346656037ULL;
+static const unsigned long long FilterPresetHashPrime    = 1099511628211ULL;
+
+unsigned long long hashBytes( unsigned long long hash, const void* data, size_t length ) {
+    const unsigned char* bytes = ( const unsigned char* )data;
+
+    for( size_t i = 0; length > i; ++i ) {
+        hash ^= bytes[i];
+        hash *= FilterPresetHashPrime;
+    }
+
+    return hash;
+}
+
+unsigned long long hashValue( unsigned long long hash, const std::string& value ) {
+    const size_t length = value.size();
+
+    hash = hashBytes( hash, &length, sizeof( length ) );
+    return hashBytes( hash, value.data(), length );
+}
+
+/// numbers, points, rects and colors are hashed by
+/// their bytes. none of them contains padding.
+template < class _t_value >
+unsigned long long hashValue( unsigned long long hash, const _t_value& value ) {
+    static_assert( std::is_standard_layout<_t_value>::value, "preset values have to be plain data" );
+
+    return hashBytes( hash, &value, sizeof( value ) );
+}
+
+/// the iteration order of the maps depends on their history,
+/// so the entries are hashed sorted by name.
+template < class _t_any >
+unsigned long long hashPresetMap( unsigned long long hash, const std::unordered_map<std::string, _t_any>& map ) {
+    std::vector<const std::pair<const std::string, _t_any>*> entries;
+    entries.reserve( map.size() );
+
+    for( auto it = map.begin(); it != map.end(); ++it ) {
+        entries.push_back( &( *it ) );
+    }
+
+    std::sort(
+        entries.begin(),
+        entries.end(),
+    []( const std::pair<const std::string, _t_any>* first, const std::pair<const std::string, _t_any>* second ) {
+        return first->first < second->first;
+    }
+    );
+
+    hash = hashValue( hash, entries.size() );
+
+    for( auto it = entries.begin(); it != entries.end(); ++it ) {
+        hash = hashValue( hash, ( *it )->first );
+        hash = hashValue( hash, ( *it )->second.value );
+    }
+
+    return hash;
+}
+}
+
+unsigned long long FilterPreset::hash() const {
+    unsigned long long value = hashValue( FilterPresetHashSeed, this->m_FilterName );
+
+    value = hashPresetMap( value, this->m_ValPosition );
+    value = hashPresetMap( value, this->m_ValLine );
+    value = hashPresetMap( value, this->m_ValRect );
+    value = hashPresetMap( value, this->m_ValFloat );
+    value = hashPresetMap( value, this->m_ValInt );
+    value = hashPresetMap( value, this->m_ValChar );
+    value = hashPresetMap( value, this->m_ValUInt );
+    value = hashPresetMap( value, this->m_ValSwitch );
+    value = hashPresetMap( value, this->m_ValString );
+    value = hashPresetMap( value, this->m_ValRGB8 );
+    value = hashPresetMap( value, this->m_ValRGB16 );
+    value = hashPresetMap( value, this->m_ValARGB8 );
+    value = hashPresetMap( value, this->m_ValARGB16 );
+    value = hashPresetMap( value, this->m_ValMono8 );
+    value = hashPresetMap( value, this->m_ValMono16 );
+    value = hashPresetMap( value, this->m_ValPoints );
+
+    return value;
+}
+
 bool FilterPreset::writeToFile( const std::string& path ) {
     FilterPresetSerializationProvider provider( this );
 
@@ -0,0 +1,347 @@
+#include <libgraphics/filterresultcache.hpp>
+#include <libgraphics/fx/operations/basic.hpp>
+#include <QDebug>
+
+namespace libgraphics {
+
+FilterResultCache::FilterResultCache( size_t memoryBudget, size_t spillBudget ) :
+    m_MemoryBudget( memoryBudget ), m_MemoryUsage( 0 ), m_SpillBudget( spillBudget ) {
+    MemoryGovernor::global().attach( this );
+}
+
+FilterResultCache::~FilterResultCache() {
+    MemoryGovernor::global().detach( this );
+}
+
+size_t FilterResultCache::memoryBudget() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_MemoryBudget;
+}
+
+void FilterResultCache::setMemoryBudget( size_t budget ) {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    this->m_MemoryBudget = budget;
+    this->evict( 0 );
+}
+
+size_t FilterResultCache::spillBudget() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_SpillBudget;
+}
+
+void FilterResultCache::setSpillBudget( size_t budget ) {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    this->m_SpillBudget = budget;
+    this->trimSpill( 0 );
+}
+
+size_t FilterResultCache::memoryUsage() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_MemoryUsage;
+}
+
+size_t FilterResultCache::spillUsage() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->spilledBytes();
+}
+
+size_t FilterResultCache::count() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_Entries.size();
+}
+
+bool FilterResultCache::contains( KeyType key ) const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->find( key ) != this->m_Entries.end();
+}
+
+bool FilterResultCache::restore(
+    KeyType                     key,
+    libgraphics::ImageLayer*    destination
+) {
+    assert( destination );
+
+    std::shared_ptr<libgraphics::ImageLayer> layer;
+
+    {
+        std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+        auto it = this->find( key );
+
+        if( it == this->m_Entries.end() ) {
+            return false;
+        }
+
+        /** move to the front of the lru list **/
+        this->m_Entries.splice( this->m_Entries.begin(), this->m_Entries, it );
+
+        Entry& entry = this->m_Entries.front();
+
+        if( ( entry.format != destination->format() ) ||
+                ( entry.width != ( size_t )destination->width() ) ||
+                ( entry.height != ( size_t )destination->height() ) ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+            qDebug() << "FilterResultCache::restore(): Cached layer doesn't match the destination layer.";
+#endif
+            return false;
+        }
+
+        if( !entry.layer ) {
+            /** spilled: read the layer back from the scratch file, the
+                lock keeps other threads from releasing the region **/
+            void* data = this->m_SpillFile->map( entry.spilled );
+
+            if( data == nullptr ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+                qDebug() << "FilterResultCache::restore(): Failed to map spilled layer.";
+#endif
+                return false;
+            }
+
+            const auto successfullyCopied = destination->copy(
+                                                data,
+                                                libgraphics::Rect32I( ( int )entry.width, ( int )entry.height ),
+                                                0,
+                                                0
+                                            );
+            this->m_SpillFile->unmap( data, entry.spilled );
+
+            return successfullyCopied;
+        }
+
+        layer = entry.layer;
+    }
+
+    MemoryGovernor::global().touch( this );
+
+    libgraphics::fx::operations::blit(
+        destination,
+        layer.get(),
+        layer->size(),
+        layer->size()
+    );
+
+    return true;
+}
+
+bool FilterResultCache::store(
+    KeyType                     key,
+    fxapi::ApiBackendDevice*    device,
+    libgraphics::ImageLayer*    layer
+) {
+    assert( device );
+    assert( layer );
+
+    const size_t byteSize = layer->byteSize();
+
+    {
+        std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+        if( byteSize > this->m_MemoryBudget ) {
+            return false;
+        }
+
+        if( this->find( key ) != this->m_Entries.end() ) {
+            return true;
+        }
+    }
+
+    /** the copy has to fit into the global memory budget **/
+    if( !MemoryGovernor::global().reserve( byteSize ) ) {
+        return false;
+    }
+
+    std::shared_ptr<libgraphics::ImageLayer> copy( libgraphics::makeImageLayer( device, layer ) );
+
+    if( !copy || copy->empty() ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "FilterResultCache::store(): Failed to allocate layer.";
+#endif
+        return false;
+    }
+
+    libgraphics::fx::operations::blit(
+        copy.get(),
+        layer,
+        layer->size(),
+        layer->size()
+    );
+
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    if( this->find( key ) != this->m_Entries.end() ) {
+        return true;
+    }
+
+    this->evict( byteSize );
+
+    Entry entry;
+    entry.key       = key;
+    entry.layer     = copy;
+    entry.byteSize  = byteSize;
+    entry.format    = copy->format();
+    entry.width     = copy->width();
+    entry.height    = copy->height();
+
+    this->m_Entries.push_front( entry );
+    this->m_MemoryUsage += byteSize;
+
+    return true;
+}
+
+size_t FilterResultCache::reclaim( size_t bytes ) {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    size_t released( 0 );
+
+    while( bytes > released ) {
+        const auto it = this->leastRecentlyUsed();
+
+        if( it == this->m_Entries.end() ) {
+            break;
+        }
+
+        released += ( *it ).byteSize;
+
+        if( !this->spill( *it ) ) {
+            this->erase( it );
+        }
+    }
+
+    return released;
+}
+
+void FilterResultCache::clear() {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    while( !this->m_Entries.empty() ) {
+        this->erase( this->m_Entries.begin() );
+    }
+
+    this->m_MemoryUsage = 0;
+}
+
+FilterResultCache::EntryList::iterator FilterResultCache::find( KeyType key ) {
+    for( auto it = this->m_Entries.begin(); it != this->m_Entries.end(); ++it ) {
+        if( ( *it ).key == key ) {
+            return it;
+        }
+    }
+
+    return this->m_Entries.end();
+}
+
+FilterResultCache::EntryList::const_iterator FilterResultCache::find( KeyType key ) const {
+    for( auto it = this->m_Entries.begin(); it != this->m_Entries.end(); ++it ) {
+        if( ( *it ).key == key ) {
+            return it;
+        }
+    }
+
+    return this->m_Entries.end();
+}
+
+FilterResultCache::EntryList::iterator FilterResultCache::leastRecentlyUsed() {
+    for( auto it = this->m_Entries.rbegin(); it != this->m_Entries.rend(); ++it ) {
+        if( ( *it ).layer ) {
+            return std::next( it ).base();
+        }
+    }
+
+    return this->m_Entries.end();
+}
+
+void FilterResultCache::evict( size_t requiredBytes ) {
+    while( this->m_MemoryUsage + requiredBytes > this->m_MemoryBudget ) {
+        const auto it = this->leastRecentlyUsed();
+
+        if( it == this->m_Entries.end() ) {
+            break;
+        }
+
+        if( !this->spill( *it ) ) {
+            this->erase( it );
+        }
+    }
+}
+
+bool FilterResultCache::spill( Entry& entry ) {
+    assert( entry.layer );
+
+    if( entry.byteSize > this->m_SpillBudget ) {
+        return false;
+    }
+
+    if( !this->m_SpillFile ) {
+        this->m_SpillFile.reset( new SpillFile() );
+    }
+
+    if( !this->m_SpillFile->valid() ) {
+        return false;
+    }
+
+    this->trimSpill( entry.byteSize );
+
+    const auto region = this->m_SpillFile->allocate( entry.byteSize );
+
+    if( region.empty() ) {
+        return false;
+    }
+
+    void* data = this->m_SpillFile->map( region );
+    const auto successfullyRetrieved = ( data != nullptr ) && entry.layer->retrieve( data );
+
+    this->m_SpillFile->unmap( data, region );
+
+    if( !successfullyRetrieved ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "FilterResultCache::spill(): Failed to write layer to the scratch file.";
+#endif
+        this->m_SpillFile->release( region );
+
+        return false;
+    }
+
+    entry.layer.reset();
+    entry.spilled = region;
+    this->m_MemoryUsage -= entry.byteSize;
+
+    return true;
+}
+
+void FilterResultCache::trimSpill( size_t requiredBytes ) {
+    auto it = this->m_Entries.end();
+
+    while( ( it != this->m_Entries.begin() ) && ( this->spilledBytes() + requiredBytes > this->m_SpillBudget ) ) {
+        --it;
+
+        if( !( *it ).layer ) {
+            this->m_SpillFile->release( ( *it ).spilled );
+            it = this->m_Entries.erase( it );
+        }
+    }
+}
+
+void FilterResultCache::erase( EntryList::iterator it ) {
+    if( ( *it ).layer ) {
+        this->m_MemoryUsage -= ( *it ).byteSize;
+    } else {
+        this->m_SpillFile->release( ( *it ).spilled );
+    }
+
+    this->m_Entries.erase( it );
+}
+
+size_t FilterResultCache::spilledBytes() const {
+    return this->m_SpillFile ? this->m_SpillFile->usage() : 0;
+}
+
+}
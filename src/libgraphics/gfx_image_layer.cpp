@@ -7,6 +7,8 @@
 
 #include <log/log.hpp>
 
+#include <atomic>
+
 namespace libgraphics {
 //// extern
 ///
@@ -312,59 +314,126 @@ struct ImageLayer::Private {
     /// meta info
     std::string name;
 
-    /// backend image objects
-    std::vector< std::unique_ptr<BackendImageObj> > objects;
+    /// backend image objects, shared with duplicates of the
+    /// layer until one of them writes.
+    std::vector< std::shared_ptr<BackendImageObj> > objects;
 
+    /// the layer generation is advanced by each write, a backend
+    /// object is valid as long as it carries the latest generation.
+    /// stale mirrors are synchronized on their next access.
+    unsigned long long generation;
+    std::map<int, unsigned long long> validGenerations;
 
+    /// process wide identity of the current contents, renewed by
+    /// each write and shared with duplicates.
+    unsigned long long contentId;
 
     Private() : width( 0 ), height( 0 ),
-        format( fxapi::EPixelFormat::Empty ) {}
+        format( fxapi::EPixelFormat::Empty ), generation( 0 ), contentId( nextContentId() ) {}
+
+    static unsigned long long nextContentId() {
+        static std::atomic<unsigned long long> counter( 0 );
+        return ++counter;
+    }
 
     void assign( const ImageLayer& rhs ) {
         assert( !rhs.empty() );
 
-        objects.clear();
+        if( rhs.d.get() == this ) {
+            return;
+        }
 
         format       = rhs.format();
         width        = rhs.width();
         height       = rhs.height();
         name         = rhs.name();
 
-        for( auto it = rhs.d->objects.begin(); it != rhs.d->objects.end(); ++it ) {
-            objects.emplace_back(
-                std::unique_ptr<BackendImageObj>( new BackendImageObj( ( *it )->device ) )
-            );
+        /** copy-on-write: the objects are copied on the first write **/
+        objects             = rhs.d->objects;
+        generation          = rhs.d->generation;
+        validGenerations    = rhs.d->validGenerations;
+        contentId           = rhs.d->contentId;
+    }
 
-            const auto sucessfullyCreated = objects.back()->imageObject->create(
-                                                format,
-                                                width,
-                                                height
-                                            );
-            assert( sucessfullyCreated );
+    bool covers( libgraphics::Rect32I area, int destX, int destY ) const {
+        return ( destX == 0 ) && ( destY == 0 ) && ( area.x == 0 ) && ( area.y == 0 ) &&
+               ( area.width == ( int )width ) && ( area.height == ( int )height );
+    }
+
+    /// replaces an object shared with other layers by a private
+    /// one, which receives a copy of the data if copyData is set.
+    bool detach( std::shared_ptr<BackendImageObj>& object, bool copyData ) {
+        assert( object );
 
-            if( !sucessfullyCreated ) {
+        if( object.use_count() <= 1 ) {
+            return true;
+        }
+
+        std::shared_ptr<BackendImageObj> privateObject( new BackendImageObj( object->device ) );
+
+        const auto sucessfullyCreated = privateObject->imageObject->create(
+                                            format,
+                                            width,
+                                            height
+                                        );
+        assert( sucessfullyCreated );
+
+        if( !sucessfullyCreated ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
-                qDebug() << "Failed to create image layer backend object - " << "width:" << width << "height:" << height;
+            qDebug() << "Failed to detach image layer backend object - " << "width:" << width << "height:" << height;
 #endif
-                continue;
-            }
+            return false;
+        }
 
-            const auto sucessfullyCopied = objects.back()->imageObject->copy(
-                                               ( *it )->imageObject,
+        if( copyData ) {
+            const auto sucessfullyCopied = privateObject->imageObject->copy(
+                                               object->imageObject,
                                                libgraphics::Rect32I( ( int )width, ( int )height ),
                                                0,
                                                0
                                            );
             assert( sucessfullyCopied );
 
-#ifdef LIBGRAPHICS_DEBUG_OUTPUT
-
             if( !sucessfullyCopied ) {
-                qDebug() << "Failed to copy data from another image layer backend object - " << "width:" << width << "height:" << height;
+#if LIBGRAPHICS_DEBUG_OUTPUT
+                qDebug() << "Failed to copy data of shared image layer backend object - " << "width:" << width << "height:" << height;
+#endif
+                return false;
             }
+        }
 
-#endif
+        object = privateObject;
+
+        return true;
+    }
+    bool detach( bool copyData ) {
+        bool detached( true );
+
+        for( auto it = objects.begin(); it != objects.end(); ++it ) {
+            detached = detach( *it, copyData ) && detached;
+        }
+
+        return detached;
+    }
+
+    /// empties an object before it is recreated, a shared object
+    /// is replaced by a new one.
+    void renew( std::shared_ptr<BackendImageObj>& object ) {
+        if( object.use_count() > 1 ) {
+            object.reset( new BackendImageObj( object->device ) );
+        } else {
+            object->reset();
+        }
+    }
+
+    std::shared_ptr<BackendImageObj> findObjectForBackend( int backend ) const {
+        for( auto it = objects.begin(); it != objects.end(); ++it ) {
+            if( ( *it )->backendId == backend ) {
+                return *it;
+            }
         }
+
+        return std::shared_ptr<BackendImageObj>();
     }
 
     BackendImageObj* getImageForBackend( int backend ) {
@@ -376,6 +445,199 @@ struct ImageLayer::Private {
 
         return nullptr;
     }
+
+    /// validity
+    bool isValidOnBackend( int backend ) const {
+        const auto it = validGenerations.find( backend );
+
+        return ( it != validGenerations.end() ) && ( ( *it ).second == generation );
+    }
+    bool isValid( const BackendImageObj& object ) const {
+        return isValidOnBackend( object.backendId );
+    }
+
+    /// marks the object as the only valid one
+    void written( const BackendImageObj& object ) {
+        ++generation;
+        contentId = nextContentId();
+        validGenerations[object.backendId] = generation;
+    }
+    /// marks all objects as valid, used if the contents are undefined
+    void writtenAll() {
+        ++generation;
+        contentId = nextContentId();
+
+        for( auto it = objects.begin(); it != objects.end(); ++it ) {
+            validGenerations[( *it )->backendId] = generation;
+        }
+    }
+
+    /// returns a valid object for reading, preferring the specified
+    /// backend.
+    BackendImageObj* readObject( int preferredBackend = FXAPI_BACKEND_CPU ) {
+        assert( !objects.empty() );
+
+        if( isValidOnBackend( preferredBackend ) ) {
+            auto object = getImageForBackend( preferredBackend );
+
+            if( object ) {
+                return object;
+            }
+        }
+
+        for( auto it = objects.begin(); it != objects.end(); ++it ) {
+            if( isValid( **it ) ) {
+                return ( *it ).get();
+            }
+        }
+
+        return objects.front().get();
+    }
+
+    /// returns the object that receives the next write. whole layer
+    /// writes prefer the cpu object, partial ones a valid object
+    /// to avoid synchronizing the data first.
+    std::vector< std::shared_ptr<BackendImageObj> >::iterator writeTarget( bool wholeLayer ) {
+        auto target = objects.end();
+
+        for( auto it = objects.begin(); it != objects.end(); ++it ) {
+            const auto isCpu = ( ( *it )->backendId == FXAPI_BACKEND_CPU );
+
+            if( wholeLayer ) {
+                if( isCpu || ( target == objects.end() ) ) {
+                    target = it;
+                }
+
+                continue;
+            }
+
+            if( isValid( **it ) ) {
+                if( ( target == objects.end() ) || !isValid( **target ) || isCpu ) {
+                    target = it;
+                }
+            } else if( target == objects.end() ) {
+                target = it;
+            }
+        }
+
+        return target;
+    }
+
+    /// brings a stale object up to date by copying the data from
+    /// a valid one, recreating it first if its shape is outdated.
+    bool synchronize( std::shared_ptr<BackendImageObj>& object ) {
+        assert( object );
+
+        if( isValid( *object ) ) {
+            return true;
+        }
+
+        BackendImageObj* source( nullptr );
+
+        for( auto it = objects.begin(); it != objects.end(); ++it ) {
+            if( ( ( *it ) != object ) && isValid( **it ) ) {
+                source = ( *it ).get();
+                break;
+            }
+        }
+
+        if( source ) {
+            const auto outdated = ( object->imageObject->format() != format ) ||
+                                  ( ( size_t )object->imageObject->width() != width ) ||
+                                  ( ( size_t )object->imageObject->height() != height );
+
+            if( outdated ) {
+                renew( object );
+
+                const auto successfullyCreated = object->imageObject->create(
+                                                     format,
+                                                     width,
+                                                     height
+                                                 );
+                assert( successfullyCreated );
+
+                if( !successfullyCreated ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+                    qDebug() << "Failed to recreate stale image layer backend object - " << "width:" << width << "height:" << height;
+#endif
+                    return false;
+                }
+            } else if( !detach( object, false ) ) {
+                return false;
+            }
+
+            const auto successfullyCopied = object->imageObject->copy(
+                                                source->imageObject,
+                                                libgraphics::Rect32I( ( int )width, ( int )height ),
+                                                0,
+                                                0
+                                            );
+            assert( successfullyCopied );
+
+            if( !successfullyCopied ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+                qDebug() << "Failed to synchronize stale image layer backend object - " << "width:" << width << "height:" << height;
+#endif
+                return false;
+            }
+        }
+
+        validGenerations[object->backendId] = generation;
+
+        return true;
+    }
+
+    /// removes an object, the data is handed to another mirror first
+    /// if the object holds the only valid copy.
+    void release( std::vector< std::shared_ptr<BackendImageObj> >::iterator object ) {
+        const auto backendId = ( *object )->backendId;
+
+        if( isValid( **object ) ) {
+            auto heir = objects.end();
+
+            for( auto it = objects.begin(); it != objects.end(); ++it ) {
+                if( it == object ) {
+                    continue;
+                }
+
+                if( isValid( **it ) ) {
+                    heir = objects.end();
+                    break;
+                }
+
+                if( heir == objects.end() ) {
+                    heir = it;
+                }
+            }
+
+            if( heir != objects.end() ) {
+                synchronize( *heir );
+            }
+        }
+
+        objects.erase( object );
+        validGenerations.erase( backendId );
+    }
+
+    /// prepares the write target, partial writes need the current
+    /// data of the object.
+    std::vector< std::shared_ptr<BackendImageObj> >::iterator prepareWrite( bool wholeLayer ) {
+        auto target = writeTarget( wholeLayer );
+
+        if( target == objects.end() ) {
+            return target;
+        }
+
+        const auto prepared = wholeLayer ? detach( *target, false ) :
+                              ( synchronize( *target ) && detach( *target, true ) );
+        assert( prepared );
+
+        if( !prepared ) {
+            return objects.end();
+        }
+
+        return target;
+    }
 };
 
 
@@ -383,7 +645,7 @@ ImageLayer::ImageLayer( libgraphics::fxapi::ApiBackendDevice* backendDevice, std
     d->name = _name;
 
     d->objects.emplace_back(
-        std::unique_ptr<Private::BackendImageObj>( new Private::BackendImageObj( backendDevice ) )
+        std::shared_ptr<Private::BackendImageObj>( new Private::BackendImageObj( backendDevice ) )
     );
 
     LIBGRAPHICS_MEMORY_LOG_ALLOCATE( this );
@@ -438,6 +700,7 @@ bool ImageLayer::reset() {
     LIBGRAPHICS_MEMORY_LOG_SCOPED_RESET( this );
 
     d->objects.clear();
+    d->validGenerations.clear();
 
     d->width = 0;
     d->height = 0;
@@ -461,7 +724,10 @@ bool ImageLayer::reset(
     assert( compatibleBackendFormat != libgraphics::fxapi::EPixelFormat::Empty );
 
     if( ( width() == bitmap->width() ) && ( height() == bitmap->height() ) && ( format() == compatibleBackendFormat ) ) {
-        for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
+        /** only one object receives the data, the others are synchronized on access **/
+        const auto it = d->prepareWrite( true );
+
+        if( it != d->objects.end() ) {
             const auto sucessfullyUploaded = ( *it )->imageObject->upload(
                                                  bitmap
                                              );
@@ -473,6 +739,8 @@ bool ImageLayer::reset(
 
                 return false;
             }
+
+            d->written( **it );
         }
 
         return true;
@@ -483,8 +751,14 @@ bool ImageLayer::reset(
     d->format = compatibleBackendFormat;
     d->maskInfo.clear();
 
+    const auto target = d->writeTarget( true );
+
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        ( *it )->reset();
+        d->renew( *it );
+
+        if( it != target ) {
+            continue;
+        }
 
         const auto successfullyCreated = ( *it )->imageObject->createFromBitmap(
                                              bitmap
@@ -497,6 +771,8 @@ bool ImageLayer::reset(
 
             return false;
         }
+
+        d->written( **it );
     }
 
     return true;
@@ -523,7 +799,9 @@ bool ImageLayer::reset(
     assert( compatibleBackendFormat != libgraphics::fxapi::EPixelFormat::Empty );
 
     if( ( width() == rect.width ) && ( height() == rect.height ) && ( format() == compatibleBackendFormat ) ) {
-        for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
+        const auto it = d->prepareWrite( true );
+
+        if( it != d->objects.end() ) {
             const auto sucessfullyUploaded = ( *it )->imageObject->upload(
                                                  bitmap,
                                                  rect,
@@ -538,6 +816,8 @@ bool ImageLayer::reset(
 
                 return false;
             }
+
+            d->written( **it );
         }
 
         return true;
@@ -548,8 +828,14 @@ bool ImageLayer::reset(
     d->format = compatibleBackendFormat;
     d->maskInfo.clear();
 
+    const auto target = d->writeTarget( true );
+
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        ( *it )->reset();
+        d->renew( *it );
+
+        if( it != target ) {
+            continue;
+        }
 
         const auto successfullyCreated = ( *it )->imageObject->createFromBitmap(
                                              bitmap,
@@ -563,6 +849,8 @@ bool ImageLayer::reset(
 
             return false;
         }
+
+        d->written( **it );
     }
 
     return true;
@@ -593,7 +881,7 @@ bool ImageLayer::reset(
     d->maskInfo.clear();
 
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        ( *it )->reset();
+        d->renew( *it );
 
         const auto successfullyCreated = ( *it )->imageObject->createFromBitmapInfo(
                                              info
@@ -608,6 +896,9 @@ bool ImageLayer::reset(
         }
     }
 
+    /** the contents are undefined, every object is as valid as the others **/
+    d->writtenAll();
+
     return true;
 }
 
@@ -634,7 +925,9 @@ bool ImageLayer::reset(
     }
 
     if( ( this->format() == format ) && ( this->width() == width ) && ( this->height() == height ) ) {
-        for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
+        const auto it = d->prepareWrite( true );
+
+        if( it != d->objects.end() ) {
             const auto sucessfullyUploaded = ( *it )->imageObject->upload(
                                                  data,
                                                  libgraphics::Rect32I( ( int )width, ( int )height ),
@@ -649,6 +942,8 @@ bool ImageLayer::reset(
 
                 return false;
             }
+
+            d->written( **it );
         }
 
         this->d->width = width;
@@ -657,8 +952,14 @@ bool ImageLayer::reset(
         return true;
     }
 
+    const auto target = d->writeTarget( true );
+
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        ( *it )->reset();
+        d->renew( *it );
+
+        if( it != target ) {
+            continue;
+        }
 
         const auto successfullyCreated = ( *it )->imageObject->createFromData(
                                              format,
@@ -674,6 +975,8 @@ bool ImageLayer::reset(
 
             return false;
         }
+
+        d->written( **it );
     }
 
     this->d->format = format;
@@ -708,7 +1011,7 @@ bool ImageLayer::reset(
     }
 
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        ( *it )->reset();
+        d->renew( *it );
 
         QElapsedTimer t;
         t.start();
@@ -730,6 +1033,7 @@ bool ImageLayer::reset(
     this->d->format = format;
     this->d->width = width;
     this->d->height = height;
+    this->d->writtenAll();
 
     return true;
 }
@@ -1070,7 +1374,7 @@ bool ImageLayer::retrieve(
 
     bool successfullyRetrieved( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
             if( ( *it )->backendId == FXAPI_BACKEND_CPU ) {
                 successfullyRetrieved = ( *it )->imageObject->retrieve(
@@ -1091,7 +1395,7 @@ bool ImageLayer::retrieve(
     }
 
     if( !successfullyRetrieved ) {
-        successfullyRetrieved = d->objects.front()->imageObject->retrieve(
+        successfullyRetrieved = d->readObject()->imageObject->retrieve(
                                     buffer
                                 );
 
@@ -1134,7 +1438,7 @@ bool ImageLayer::retrieve(
 
     bool successfullyRetrieved( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
             if( ( *it )->backendId == FXAPI_BACKEND_CPU ) {
                 successfullyRetrieved = ( *it )->imageObject->retrieve(
@@ -1156,7 +1460,7 @@ bool ImageLayer::retrieve(
     }
 
     if( !successfullyRetrieved ) {
-        successfullyRetrieved = d->objects.front()->imageObject->retrieve(
+        successfullyRetrieved = d->readObject()->imageObject->retrieve(
                                     buffer,
                                     rect
                                 );
@@ -1200,7 +1504,7 @@ bool ImageLayer::retrieve(
 
     bool successfullyRetrieved( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
             if( ( *it )->backendId == FXAPI_BACKEND_CPU ) {
                 successfullyRetrieved = ( *it )->imageObject->retrieve(
@@ -1221,7 +1525,7 @@ bool ImageLayer::retrieve(
     }
 
     if( !successfullyRetrieved ) {
-        successfullyRetrieved = d->objects.front()->imageObject->retrieve(
+        successfullyRetrieved = d->readObject()->imageObject->retrieve(
                                     bitmap
                                 );
 
@@ -1268,7 +1572,7 @@ bool ImageLayer::retrieve(
 
     bool successfullyRetrieved( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
             if( ( *it )->backendId == FXAPI_BACKEND_CPU ) {
                 successfullyRetrieved = ( *it )->imageObject->retrieve(
@@ -1290,7 +1594,7 @@ bool ImageLayer::retrieve(
     }
 
     if( !successfullyRetrieved ) {
-        successfullyRetrieved = d->objects.front()->imageObject->retrieve(
+        successfullyRetrieved = d->readObject()->imageObject->retrieve(
                                     bitmap,
                                     rect
                                 );
@@ -1364,7 +1668,7 @@ bool ImageLayer::retrieveChannel(
      *  cpu object first. */
     bool successfullyReceived( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
             if( ( *it )->backendId == FXAPI_BACKEND_CPU ) {
                 const auto temporaryBufferObject = ( *it )->device->allocator()->alloc(
@@ -1407,7 +1711,7 @@ bool ImageLayer::retrieveChannel(
                                            );
         assert( temporaryBufferObject->data );
 
-        const auto successfullyReceivedFromBackend = d->objects.front()->imageObject->retrieve(
+        const auto successfullyReceivedFromBackend = d->readObject()->imageObject->retrieve(
                     temporaryBufferObject->data,
                     rect
                 );
@@ -1498,7 +1802,7 @@ bool ImageLayer::retrieveChannel(
      *  cpu object first. */
     bool successfullyReceived( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
             if( ( *it )->backendId == FXAPI_BACKEND_CPU ) {
                 const auto temporaryBufferObject = ( *it )->device->allocator()->alloc(
@@ -1541,7 +1845,7 @@ bool ImageLayer::retrieveChannel(
                                            );
         assert( temporaryBufferObject->data );
 
-        const auto successfullyReceivedFromBackend = d->objects.front()->imageObject->retrieve(
+        const auto successfullyReceivedFromBackend = d->readObject()->imageObject->retrieve(
                     temporaryBufferObject->data,
                     rect
                 );
@@ -1603,22 +1907,29 @@ bool ImageLayer::copy(
         return false;
     }
 
-    for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        const auto successfullyCopiedData =
-            copyData( ( *it )->device, ( *it )->imageObject, source, sourceRect, destX, destY );
-        assert( successfullyCopiedData );
+    /** only one object receives the data, the others are synchronized on access **/
+    const auto it = d->prepareWrite( d->covers( sourceRect, destX, destY ) );
 
-        if( !successfullyCopiedData ) {
+    if( it == d->objects.end() ) {
+        return false;
+    }
+
+    const auto successfullyCopiedData =
+        copyData( ( *it )->device, ( *it )->imageObject, source, sourceRect, destX, destY );
+    assert( successfullyCopiedData );
+
+    if( !successfullyCopiedData ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
-            qDebug() << "ImageLayer::copy(): Failed to copy data to backend object. ImageLayer corrupted. Resetting internal state.";
+        qDebug() << "ImageLayer::copy(): Failed to copy data to backend object. ImageLayer corrupted. Resetting internal state.";
 #endif
 
-            assert( this->reset() );
+        assert( this->reset() );
 
-            return false;
-        }
+        return false;
     }
 
+    d->written( **it );
+
     return true;
 }
 
@@ -1654,62 +1965,63 @@ bool ImageLayer::copy(
         return false;
     }
 
-    std::map<Private::BackendImageObj*, bool>  objectSet;
+    /** whole layer copies share the objects of the source **/
+    const bool coversLayer = d->covers( sourceRect, destX, destY );
+    const bool wholeLayer  = coversLayer && ( source->format() == format() ) &&
+                             ( source->width() == width() ) && ( source->height() == height() );
 
-    for( auto it = d->objects.begin(); it != d->objects.end();  ++it ) {
-        objectSet[( *it ).get() ] = false;
-    }
+    if( wholeLayer ) {
+        bool sharedValidObject( false );
 
-    assert( !objectSet.empty() );
+        ++d->generation;
+        d->contentId = Private::nextContentId();
 
-    /// first run: copy matching backend objects
-    for( auto it = objectSet.begin(); it != objectSet.end(); ++it ) {
-        const auto backendObj = ( *it ).first;
-        assert( backendObj );
+        for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
+            const auto sourceObject = source->d->findObjectForBackend( ( *it )->backendId );
 
-        if( source->containsDataForBackend( backendObj->backendId ) ) {
-            const auto successfullyCopiedData = ( *it ).first->imageObject->copy(
-                                                    source->d->getImageForBackend( backendObj->backendId )->imageObject,
-                                                    sourceRect,
-                                                    destX,
-                                                    destY
-                                                );
+            if( sourceObject ) {
+                *it = sourceObject;
 
-            if( !successfullyCopiedData ) {
-#ifdef LIBGRAPHICS_DEBUG_OUTPUT
-                qDebug() << "ImageLayer::copy(): Failed to copy data from source to destination backend object.";
-#endif
-                return false;
+                if( source->d->isValid( *sourceObject ) ) {
+                    d->validGenerations[( *it )->backendId] = d->generation;
+                    sharedValidObject = true;
+                }
             }
+        }
 
-            ( *it ).second = true;
+        if( sharedValidObject ) {
+            return true;
         }
     }
 
-    /// second run: copy non-matching backend objects
-    for( auto it = objectSet.begin(); it != objectSet.end(); ++it ) {
-        if( !( *it ).second ) {
-            const auto backendObj = ( *it ).first;
-            LOGB_ASSERT( backendObj, "Invalid key" );
+    /// copy from the valid source object, preferably on the backend of the target
+    const auto it = d->prepareWrite( coversLayer );
+
+    if( it == d->objects.end() ) {
+        return false;
+    }
+
+    const auto sourceObject = source->d->readObject( ( *it )->backendId );
+    assert( sourceObject );
 
-            const auto successfullyCopiedData = ( *it ).first->imageObject->copy(
-                                                    source->d->objects.front()->imageObject,
-                                                    sourceRect,
-                                                    destX,
-                                                    destY
-                                                );
+    if( sourceObject != ( *it ).get() ) {
+        const auto successfullyCopiedData = ( *it )->imageObject->copy(
+                                                sourceObject->imageObject,
+                                                sourceRect,
+                                                destX,
+                                                destY
+                                            );
 
-            if( !successfullyCopiedData ) {
+        if( !successfullyCopiedData ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
-                qDebug() << "ImageLayer::copy(): Failed to copy data from source to destination backend object.";
+            qDebug() << "ImageLayer::copy(): Failed to copy data from source to destination backend object.";
 #endif
-                return false;
-            }
-
-            ( *it ).second = true;
+            return false;
         }
     }
 
+    d->written( **it );
+
     return true;
 
 }
@@ -1747,25 +2059,31 @@ bool ImageLayer::copy(
         return false;
     }
 
-    for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        const auto successfullyUploadedData = ( *it )->imageObject->upload(
-                bitmap,
-                sourceRect,
-                destX,
-                destY
-                                              );
-        assert( successfullyUploadedData );
+    const auto it = d->prepareWrite( d->covers( sourceRect, destX, destY ) );
+
+    if( it == d->objects.end() ) {
+        return false;
+    }
+
+    const auto successfullyUploadedData = ( *it )->imageObject->upload(
+            bitmap,
+            sourceRect,
+            destX,
+            destY
+                                          );
+    assert( successfullyUploadedData );
 
-        if( !successfullyUploadedData ) {
+    if( !successfullyUploadedData ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
-            qDebug() << "ImageLayer::copy(): Failed to upload image data to backend object. ImageLayer corrupted. Resetting...";
+        qDebug() << "ImageLayer::copy(): Failed to upload image data to backend object. ImageLayer corrupted. Resetting...";
 #endif
-            this->reset();
+        this->reset();
 
-            return false;
-        }
+        return false;
     }
 
+    d->written( **it );
+
     return true;
 }
 
@@ -1791,25 +2109,31 @@ bool ImageLayer::copy(
         return false;
     }
 
-    for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        const auto successfullyUploadedData = ( *it )->imageObject->upload(
-                data,
-                sourceRect,
-                destX,
-                destY
-                                              );
-        assert( successfullyUploadedData );
+    const auto it = d->prepareWrite( d->covers( sourceRect, destX, destY ) );
+
+    if( it == d->objects.end() ) {
+        return false;
+    }
+
+    const auto successfullyUploadedData = ( *it )->imageObject->upload(
+            data,
+            sourceRect,
+            destX,
+            destY
+                                          );
+    assert( successfullyUploadedData );
 
-        if( !successfullyUploadedData ) {
+    if( !successfullyUploadedData ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
-            qDebug() << "ImageLayer::copy(): Failed to upload image data to backend object. ImageLayer corrupted. Resetting...";
+        qDebug() << "ImageLayer::copy(): Failed to upload image data to backend object. ImageLayer corrupted. Resetting...";
 #endif
-            this->reset();
+        this->reset();
 
-            return false;
-        }
+        return false;
     }
 
+    d->written( **it );
+
     return true;
 
 }
@@ -1990,7 +2314,7 @@ bool ImageLayer::copyChannel(
     /// step 0: retrieve destination data
     bool successfullyObtainedDestinationData( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         const auto cpuBackendObject = this->d->getImageForBackend( FXAPI_BACKEND_CPU );
         assert( cpuBackendObject );
 
@@ -2018,7 +2342,7 @@ bool ImageLayer::copyChannel(
     }
 
     if( !successfullyObtainedDestinationData ) {
-        const auto successfullyReceivedData = this->d->objects.front()->imageObject->retrieve(
+        const auto successfullyReceivedData = this->d->readObject()->imageObject->retrieve(
                 destinationBufferObject->data,
                 libgraphics::Rect32I(
                     ( int )destX,
@@ -2117,7 +2441,7 @@ bool ImageLayer::copyChannel(
     return this->copyChannel(
                sourceChannelIndex,
                destChannelIndex,
-               source->d->objects.front()->imageObject,
+               source->d->readObject()->imageObject,
                sourceRect,
                destX,
                destY
@@ -2184,7 +2508,7 @@ bool ImageLayer::copyChannel(
     /// step 0: retrieve destination data
     bool successfullyObtainedDestinationData( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         const auto cpuBackendObject = this->d->getImageForBackend( FXAPI_BACKEND_CPU );
         assert( cpuBackendObject );
 
@@ -2212,7 +2536,7 @@ bool ImageLayer::copyChannel(
     }
 
     if( !successfullyObtainedDestinationData ) {
-        const auto successfullyReceivedData = this->d->objects.front()->imageObject->retrieve(
+        const auto successfullyReceivedData = this->d->readObject()->imageObject->retrieve(
                 destinationBufferObject->data,
                 libgraphics::Rect32I(
                     ( int )destX,
@@ -2317,7 +2641,7 @@ bool ImageLayer::copyChannel(
     /// step 0: retrieve destination data
     bool successfullyObtainedDestinationData( false );
 
-    if( this->containsDataForBackend( FXAPI_BACKEND_CPU ) ) {
+    if( this->d->isValidOnBackend( FXAPI_BACKEND_CPU ) ) {
         const auto cpuBackendObject = this->d->getImageForBackend( FXAPI_BACKEND_CPU );
         assert( cpuBackendObject );
 
@@ -2345,7 +2669,7 @@ bool ImageLayer::copyChannel(
     }
 
     if( !successfullyObtainedDestinationData ) {
-        const auto successfullyReceivedData = this->d->objects.front()->imageObject->retrieve(
+        const auto successfullyReceivedData = this->d->readObject()->imageObject->retrieve(
                 destinationBufferObject->data,
                 libgraphics::Rect32I(
                     ( int )destX,
@@ -2471,55 +2795,54 @@ ImageLayer* ImageLayer::duplicateArea(
         return nullptr;
     }
 
-    /// step 0: copy internal source data
-    const auto currentFormat = format();
-    const auto channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                                  currentFormat
-                              );
-    const auto pixelSize = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                               currentFormat
-                           );
-    const auto channelSize = pixelSize / channelCount;
-    LOGB_ASSERT( channelCount > 0, "invalid channel count" );
-    LOGB_ASSERT( pixelSize > 0, "invalid pixel size" );
-    LOGB_ASSERT( channelSize > 0, "invalid channel size" );
-
-    const auto sourceBufferObject = d->objects.front()->device->allocator()->alloc(
-                                        sourceRect.width * sourceRect.height * pixelSize
-                                    );
-    assert( sourceBufferObject->data );
-
-    const auto successfullyReceived = this->retrieve(
-                                          sourceBufferObject->data,
-                                          sourceRect
-                                      );
-    assert( successfullyReceived );
-
-    if( !successfullyReceived ) {
-#ifdef LIBGRAPHICS_DEBUG_OUTPUT
-        qDebug() << "ImageLayer::duplicateArea(): Failed to receive specified image region.";
-#endif
-        return nullptr;
+    if( d->covers( sourceRect, 0, 0 ) ) {
+        return duplicate();
     }
 
-    /// step 1: create layer and layer backend objects
+    /// copy the area on each valid backend, without a round trip
+    /// through host memory. stale mirrors stay stale in the copy.
     ImageLayer* layer = new ImageLayer();
     assert( layer );
 
     layer->d->format = this->format();
     layer->d->height = sourceRect.height;
     layer->d->width = sourceRect.width;
+    layer->d->generation = 1;
 
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
-        layer->d->objects.emplace_back(
-            new Private::BackendImageObj(
-                ( *it )->device,
-                sourceBufferObject->data,
-                sourceRect.width,
-                sourceRect.height,
-                currentFormat
-            )
-        );
+        std::shared_ptr<Private::BackendImageObj> areaObject( new Private::BackendImageObj( ( *it )->device ) );
+
+        if( !d->isValid( **it ) ) {
+            layer->d->objects.push_back( areaObject );
+            continue;
+        }
+
+        const auto successfullyCreated = areaObject->imageObject->create(
+                                             layer->d->format,
+                                             layer->d->width,
+                                             layer->d->height
+                                         );
+        assert( successfullyCreated );
+
+        const auto successfullyCopied = successfullyCreated && areaObject->imageObject->copy(
+                                            ( *it )->imageObject,
+                                            sourceRect,
+                                            0,
+                                            0
+                                        );
+        assert( successfullyCopied );
+
+        if( !successfullyCopied ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+            qDebug() << "ImageLayer::duplicateArea(): Failed to copy specified image region.";
+#endif
+            delete layer;
+
+            return nullptr;
+        }
+
+        layer->d->validGenerations[areaObject->backendId] = layer->d->generation;
+        layer->d->objects.push_back( areaObject );
     }
 
     return layer;
@@ -2636,6 +2959,8 @@ ImageLayer* ImageLayer::duplicateChannelArea(
         );
     }
 
+    layer->d->writtenAll();
+
     return layer;
 
 }
@@ -2720,7 +3045,14 @@ bool ImageLayer::addAlphaChannel() {
             return false;
         }
 
+        /** stale objects are recreated in the new format on their next access **/
         for( auto it = this->d->objects.begin(); it != this->d->objects.end(); ++it ) {
+            if( !d->isValid( **it ) ) {
+                continue;
+            }
+
+            d->detach( *it, true );
+
             const bool successfullyAddedAlphaChannel = ( *it )->addAlphaChannel(
                         width(),
                         height(),
@@ -2771,7 +3103,14 @@ bool ImageLayer::removeAlphaChannel() {
             return false;
         }
 
+        /** stale objects are recreated in the new format on their next access **/
         for( auto it = this->d->objects.begin(); it != this->d->objects.end(); ++it ) {
+            if( !d->isValid( **it ) ) {
+                continue;
+            }
+
+            d->detach( *it, true );
+
             const bool successfullyRemovedAlphaChannel = ( *it )->removeAlphaChannel(
                         width(),
                         height(),
@@ -2837,6 +3176,10 @@ bool ImageLayer::empty() const {
     return ( d->width == 0 ) && ( d->height == 0 );
 }
 
+unsigned long long ImageLayer::contentId() const {
+    return d->contentId;
+}
+
 size_t ImageLayer::byteSize() const {
     return width() * height() * pixelSize();
 }
@@ -2896,47 +3239,10 @@ void ImageLayer::updateDataForBackend(
             return;
         }
 
-        const auto img_width        = width();
-        const auto img_height       = height();
-        assert( img_width * img_height != 0 );
-
-        const auto currentFormat = format();
-        const auto channelCount = libgraphics::fxapi::EPixelFormat::getChannelCount(
-                                      currentFormat
-                                  );
-        const auto pixelSize = libgraphics::fxapi::EPixelFormat::getPixelSize(
-                                   currentFormat
-                               );
-        const auto channelSize = pixelSize / channelCount;
-
-        LOGB_ASSERT( channelCount > 0, "invalid channel count" );
-        LOGB_ASSERT( pixelSize > 0, "invalid pixel size" );
-        LOGB_ASSERT( channelSize > 0, "invalid channel size" );
-
-        const auto temporarySourceBuffer = device->allocator()->alloc(
-                                               img_width * img_height * pixelSize
-                                           );
-        assert( temporarySourceBuffer->data );
-
-        const auto successfullyReceivedSourceData = this->retrieve(
-                    temporarySourceBuffer->data
-                );
-        assert( successfullyReceivedSourceData );
-
-        if( !successfullyReceivedSourceData ) {
-#ifdef LIBGRAPHICS_DEBUG_OUTPUT
-            qDebug() << "ImageLayer::updateDataForBackend(): Failed to retrieve source data.";
-#endif
-            return;
-        }
-
+        /** the mirror starts stale and receives the data on its first access **/
         this->d->objects.emplace_back(
             new Private::BackendImageObj(
-                device,
-                temporarySourceBuffer->data,
-                img_width,
-                img_height,
-                currentFormat
+                device
             )
         );
     }
@@ -2947,6 +3253,11 @@ fxapi::ApiImageObject* ImageLayer::internalImageForBackend(
 ) const {
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
         if( ( *it )->backendId == backendId ) {
+            /** the caller writes to the object, the other mirrors become stale **/
+            d->synchronize( *it );
+            d->detach( *it, true );
+            d->written( **it );
+
             return ( *it )->imageObject;
         }
     }
@@ -2959,6 +3270,24 @@ fxapi::ApiImageObject* ImageLayer::internalImageForDevice(
 ) const {
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
         if( ( *it )->device == device ) {
+            d->synchronize( *it );
+            d->detach( *it, true );
+            d->written( **it );
+
+            return ( *it )->imageObject;
+        }
+    }
+
+    return nullptr;
+}
+
+fxapi::ApiImageObject* ImageLayer::sourceImageForBackend(
+    int backendId
+) const {
+    for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
+        if( ( *it )->backendId == backendId ) {
+            d->synchronize( *it );
+
             return ( *it )->imageObject;
         }
     }
@@ -2991,6 +3320,8 @@ bool ImageLayer::updateInternalState( int backendId ) {
             cHeight = ( *it )->imageObject->height();
             cFormat = ( *it )->imageObject->format();
 
+            d->written( **it );
+
             found = true;
 
             break;
@@ -3005,16 +3336,11 @@ bool ImageLayer::updateInternalState( int backendId ) {
     this->d->height = cHeight;
     this->d->format = cFormat;
 
-    /// !\todo image backend synchronization mode
-
-
-    for( auto it = d->objects.begin(); it != d->objects.end(); ) {
+    /** outdated mirrors are released now and recreated on their next access **/
+    for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
         if( ( ( *it )->imageObject->width() != cWidth ) || ( ( *it )->imageObject->height() != cHeight ) || ( ( *it )->imageObject->format() != cFormat ) ) {
-            it = d->objects.erase( it );
-            continue;
+            d->renew( *it );
         }
-
-        ++it;
     }
 
     return true;
@@ -3023,8 +3349,7 @@ bool ImageLayer::updateInternalState( int backendId ) {
 bool ImageLayer::deleteDataForBackend( int backendId ) {
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
         if( ( *it )->backendId == backendId ) {
-            ( *it )->reset();
-            it = d->objects.erase( it );
+            d->release( it );
             return true;
         }
     }
@@ -3035,8 +3360,7 @@ bool ImageLayer::deleteDataForBackend( int backendId ) {
 bool ImageLayer::deleteDataForDevice( libgraphics::fxapi::ApiBackendDevice* device ) {
     for( auto it = d->objects.begin(); it != d->objects.end(); ++it ) {
         if( ( *it )->device == device ) {
-            ( *it )->reset();
-            it = d->objects.erase( it );
+            d->release( it );
             return true;
         }
     }
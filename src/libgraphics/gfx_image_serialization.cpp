@@ -1,10 +1,14 @@
 #include <libgraphics/image.hpp>
 #include <libgraphics/image_p.hpp>
+#include <libgraphics/mappedfile.hpp>
+#include <libgraphics/backend/cpu/cpu_imageobject.hpp>
 #include <libserialization++.hpp>
 #include <log/log.hpp>
 #include <QDebug>
 
+#include <cstdio>
 #include <iostream>
+#include <vector>
 
 namespace libgraphics {
 struct MetaFormat : spp::AutoSerializable {
@@ -388,52 +392,147 @@ void metaFormatInstanceFromImage( MetaFormat* data, Image* image ) {
     );
 }
 
+/// creates a layer whose cpu object uses the mapped pixels instead of
+/// a copy. returns nullptr, if the device can't use the mapping.
+ImageLayer* makeMappedImageLayer(
+    fxapi::ApiBackendDevice* device,
+    const std::string& name,
+    fxapi::EPixelFormat::t format,
+    size_t width,
+    size_t height,
+    void* data,
+    const std::shared_ptr<MappedFile>& mapping
+) {
+    assert( device );
+    assert( data );
+    assert( mapping );
+
+    if( device->backendId() != FXAPI_BACKEND_CPU ) {
+        return nullptr;
+    }
+
+    /** unaligned channels are copied **/
+    const size_t channelSize = fxapi::EPixelFormat::getPixelSize( format ) / fxapi::EPixelFormat::getChannelCount( format );
+
+    if( ( ( size_t )data % channelSize ) != 0 ) {
+        return nullptr;
+    }
+
+    std::unique_ptr<ImageLayer> layer( new ImageLayer( device, name ) );
+
+    auto imageObject = ( backend::cpu::ImageObject* )layer->internalImageForBackend( FXAPI_BACKEND_CPU );
+
+    if( imageObject == nullptr ) {
+        return nullptr;
+    }
+
+    /** the blob keeps the mapping alive as long as the layer uses it **/
+    std::shared_ptr<StdDynamicPoolAllocator::Blob> blob(
+        new StdDynamicPoolAllocator::Blob( data ),
+        [mapping]( StdDynamicPoolAllocator::Blob * mappedBlob ) {
+            delete mappedBlob;
+        }
+    );
+
+    if( !imageObject->createFromBlob( format, width, height, blob ) ) {
+        return nullptr;
+    }
+
+    if( !layer->updateInternalState( FXAPI_BACKEND_CPU ) ) {
+        return nullptr;
+    }
+
+    return layer.release();
+}
+
 /// serialization
+bool Image::isSerializedImage(
+    const std::string& path
+) {
+    std::FILE* file = std::fopen( path.c_str(), "rb" );
+
+    if( file == nullptr ) {
+        return false;
+    }
+
+    int magic( 0 );
+    const bool complete = ( std::fread( ( void* )&magic, sizeof( magic ), 1, file ) == 1 );
+
+    std::fclose( file );
+
+    return complete && ( magic == MetaFormat::magic );
+}
+
+/// the file is mapped into memory instead of read, the cpu layers
+/// point into the private mapping, which copies pages on write.
+/// files which can't be mapped or are locked by a writer are read
+/// into memory.
 size_t Image::readFromFile(
     libgraphics::fxapi::ApiBackendDevice* defaultDevice,
     const std::string& path
 ) {
     assert( defaultDevice );
 
-    spp::FileStream fs( path, spp::FileOpenMode::AlwaysOpen, spp::FileStreamMode::Readable );
-
-    assert( fs.Length() == 0 );
+    std::shared_ptr<MappedFile> mapping( new MappedFile( path ) );
 
-    if( fs.Length() == 0 ) {
-        return 0;
+    if( mapping->valid() ) {
+        return this->readFromData(
+                   defaultDevice,
+                   mapping->data(),
+                   mapping->length(),
+                   mapping
+               );
     }
 
-    void* temporaryBuffer = ( void* ) new char[fs.Length()];
-    assert( temporaryBuffer );
+#if LIBGRAPHICS_DEBUG_OUTPUT
+    qDebug() << "Image::readFromFile(): Failed to map file, reading it instead" << path.c_str();
+#endif
 
-    const size_t readBytes = fs.Read(
-                                 &temporaryBuffer,
-                                 fs.Length()
-                             );
-    assert( readBytes > 0 );
+    std::FILE* file = std::fopen( path.c_str(), "rb" );
+
+    if( file == nullptr ) {
+        return 0;
+    }
 
-    if( readBytes > 0 ) {
-        const size_t readBytes = this->readFromData(
-                                     defaultDevice,
-                                     temporaryBuffer,
-                                     fs.Length()
-                                 );
+    std::vector<char> buffer;
+    char chunk[64 * 1024];
+    size_t length( 0 );
 
-        fs.Close();
+    while( ( length = std::fread( ( void* )chunk, 1, sizeof( chunk ), file ) ) > 0 ) {
+        buffer.insert( buffer.end(), chunk, chunk + length );
+    }
 
-        delete []( char* )temporaryBuffer;
+    std::fclose( file );
 
-        return readBytes;
+    if( buffer.empty() ) {
+        return 0;
     }
 
-    delete []( char* )temporaryBuffer;
-    return 0;
+    return this->readFromData(
+               defaultDevice,
+               ( void* )buffer.data(),
+               buffer.size()
+           );
 }
 
 size_t Image::readFromData(
     libgraphics::fxapi::ApiBackendDevice* defaultDevice,
     void* data,
     size_t size
+) {
+    return this->readFromData(
+               defaultDevice,
+               data,
+               size,
+               std::shared_ptr<MappedFile>()
+           );
+}
+
+size_t Image::readFromData(
+    libgraphics::fxapi::ApiBackendDevice* defaultDevice,
+    void* data,
+    size_t size,
+    const std::shared_ptr<MappedFile>& mapping
 ) {
     assert( defaultDevice );
     assert( data );
@@ -452,7 +551,16 @@ size_t Image::readFromData(
         return 0;
     }
 
-    const size_t metaFormatLength = *( size_t* )( *( char* )data + sizeof( int ) );
+    if( size < sizeof( int ) + sizeof( size_t ) ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "Image::readFromData(): FDM file corrupted. Header is truncated.";
+#endif
+        return 0;
+    }
+
+    /** the writer stores the length in the first 4 bytes of its field **/
+    unsigned int metaFormatLength( 0 );
+    ( void ) memcpy( ( void* )&metaFormatLength, ( const void* )( ( char* )data + sizeof( int ) ), sizeof( metaFormatLength ) );
     assert( metaFormatLength > 0 );
 
     if( metaFormatLength == 0 ) {
@@ -462,9 +570,9 @@ size_t Image::readFromData(
         return 0;
     }
 
-    assert( size > sizeof( int ) + metaFormatLength );
+    assert( size > sizeof( int ) + sizeof( size_t ) + metaFormatLength );
 
-    if( size < sizeof( int ) + metaFormatLength ) {
+    if( size < sizeof( int ) + sizeof( size_t ) + metaFormatLength ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
         qDebug() << "Image::readFromData(): FDM file corrupted. metaFormatLength is bigger than the complete buffer.";
 #endif
@@ -531,20 +639,42 @@ size_t Image::readFromData(
 
         assert( ptr );
 
-        if( ( *it ).offset + ( *it ).byteSize > size ) {
+        if( ( ( *it ).offset + ( *it ).byteSize > size ) ||
+                ( ( *it ).byteSize < ( *it ).width * ( *it ).height * fxapi::EPixelFormat::getPixelSize( this->d->format ) ) ) {
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
             qDebug() << "Image::readFromFile(): FDM file invalid. Layer structure points to invalid memory region.";
 #endif
             continue;
         }
 
-        const auto layer = this->createAndAppendLayer(
-                               defaultDevice,
-                               ( *it ).name,
-                               ( *it ).width,
-                               ( *it ).height,
-                               ptr
-                           );
+        ImageLayer* layer( nullptr );
+
+        if( mapping ) {
+            layer = makeMappedImageLayer(
+                        defaultDevice,
+                        ( *it ).name,
+                        this->d->format,
+                        ( *it ).width,
+                        ( *it ).height,
+                        ptr,
+                        mapping
+                    );
+
+            if( layer != nullptr ) {
+                ( void ) this->appendLayer( layer );
+            }
+        }
+
+        if( layer == nullptr ) {
+            layer = this->createAndAppendLayer(
+                        defaultDevice,
+                        ( *it ).name,
+                        ( *it ).width,
+                        ( *it ).height,
+                        ptr
+                    );
+        }
+
         assert( layer );
 
 #ifdef LIBGRAPHICS_DEBUG_OUTPUT
@@ -601,6 +731,18 @@ size_t Image::writeToFile(
         return 0;
     }
 
+    /** layers may still be backed by a mapping of the file **/
+    MappedFile::detachAll( path );
+
+    FileWriteLock writeLock( path );
+
+    if( !writeLock.locked() ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "Image::writeToFile(): File is mapped by another process " << path.c_str();
+#endif
+        return 0;
+    }
+
     spp::FileStream fs( path, spp::FileOpenMode::BinaryAlwaysCreate, spp::FileStreamMode::ReadWritable );
 
     if( bytesWritten != fs.Write( memoryStream.GetPointer(), bytesWritten ) ) {
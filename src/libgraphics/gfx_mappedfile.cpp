@@ -0,0 +1,273 @@
+#include <libgraphics/mappedfile.hpp>
+#include <QDebug>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+#   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/file.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace libgraphics {
+
+namespace {
+/** mappings of this process, used by detachAll() **/
+std::mutex                  registryMutex;
+std::vector<MappedFile*>    registry;
+}
+
+MappedFile::MappedFile( const std::string& path ) : m_Data( nullptr ), m_Length( 0 ), m_Detached( false ), m_Path( path ),
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    m_File( nullptr )
+#else
+    m_File( -1 ), m_Device( 0 ), m_Inode( 0 )
+#endif
+{
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    /** the share mode keeps other writers away while the file is open **/
+    const HANDLE file = ::CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+
+    if( file == INVALID_HANDLE_VALUE ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "MappedFile::MappedFile(): Failed to open file" << path.c_str();
+#endif
+        return;
+    }
+
+    this->m_File = ( void* )file;
+
+    LARGE_INTEGER fileSize;
+
+    if( ::GetFileSizeEx( file, &fileSize ) && ( fileSize.QuadPart > 0 ) ) {
+        const HANDLE mapping = ::CreateFileMappingW( file, NULL, PAGE_WRITECOPY, 0, 0, NULL );
+
+        if( mapping != NULL ) {
+            this->m_Data = ::MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 );
+
+            if( this->m_Data != nullptr ) {
+                this->m_Length = ( size_t )fileSize.QuadPart;
+            }
+
+            /** the view keeps the mapping alive **/
+            ::CloseHandle( mapping );
+        }
+    }
+#else
+    const int file = ::open( path.c_str(), O_RDONLY );
+
+    if( file < 0 ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "MappedFile::MappedFile(): Failed to open file" << path.c_str();
+#endif
+        return;
+    }
+
+    this->m_File = file;
+
+    /** a writer holds the exclusive lock, the file may be incomplete **/
+    if( ::flock( file, LOCK_SH | LOCK_NB ) != 0 ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "MappedFile::MappedFile(): File is locked by a writer" << path.c_str();
+#endif
+        this->closeFile();
+        return;
+    }
+
+    struct stat fileStat;
+
+    if( ( ::fstat( file, &fileStat ) == 0 ) && ( fileStat.st_size > 0 ) ) {
+        void* data = ::mmap( nullptr, ( size_t )fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0 );
+
+        if( data != MAP_FAILED ) {
+            this->m_Data    = data;
+            this->m_Length  = ( size_t )fileStat.st_size;
+            this->m_Device  = ( unsigned long long )fileStat.st_dev;
+            this->m_Inode   = ( unsigned long long )fileStat.st_ino;
+        }
+    }
+#endif
+
+    if( this->m_Data == nullptr ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "MappedFile::MappedFile(): Failed to map file" << path.c_str();
+#endif
+        this->closeFile();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock( registryMutex );
+    registry.push_back( this );
+}
+
+MappedFile::~MappedFile() {
+    if( this->m_Data == nullptr ) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+        registry.erase( std::remove( registry.begin(), registry.end(), this ), registry.end() );
+    }
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+
+    if( this->m_Detached ) {
+        ::VirtualFree( this->m_Data, 0, MEM_RELEASE );
+    } else {
+        ::UnmapViewOfFile( this->m_Data );
+    }
+
+#else
+    ::munmap( this->m_Data, this->m_Length );
+#endif
+
+    this->closeFile();
+}
+
+bool MappedFile::valid() const {
+    return ( this->m_Data != nullptr );
+}
+
+void* MappedFile::data() const {
+    return this->m_Data;
+}
+
+size_t MappedFile::length() const {
+    return this->m_Length;
+}
+
+bool MappedFile::detached() const {
+    return this->m_Detached;
+}
+
+bool MappedFile::detach() {
+    if( ( this->m_Data == nullptr ) || this->m_Detached ) {
+        return true;
+    }
+
+    std::unique_ptr<char[]> copy( new char[this->m_Length] );
+    ( void ) memcpy( ( void* )copy.get(), this->m_Data, this->m_Length );
+
+    /** the layers keep pointing to the old address **/
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    ::UnmapViewOfFile( this->m_Data );
+
+    const bool replaced = ( ::VirtualAlloc( this->m_Data, this->m_Length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE ) == this->m_Data );
+#else
+    const bool replaced = ( ::mmap( this->m_Data, this->m_Length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0 ) == this->m_Data );
+#endif
+    assert( replaced );
+
+    if( !replaced ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "MappedFile::detach(): Failed to replace the mapping of" << this->m_Path.c_str();
+#endif
+        return false;
+    }
+
+    ( void ) memcpy( this->m_Data, ( const void* )copy.get(), this->m_Length );
+
+    this->m_Detached = true;
+    this->closeFile();
+
+    return true;
+}
+
+void MappedFile::detachAll( const std::string& path ) {
+    std::lock_guard<std::mutex> lock( registryMutex );
+
+    for( auto it = registry.begin(); it != registry.end(); ++it ) {
+        if( !( *it )->detached() && ( *it )->refersTo( path ) ) {
+            ( void )( *it )->detach();
+        }
+    }
+}
+
+bool MappedFile::refersTo( const std::string& path ) const {
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    return ( ::lstrcmpiA( this->m_Path.c_str(), path.c_str() ) == 0 );
+#else
+    struct stat fileStat;
+
+    if( ::stat( path.c_str(), &fileStat ) != 0 ) {
+        return false;
+    }
+
+    return ( ( unsigned long long )fileStat.st_dev == this->m_Device ) && ( ( unsigned long long )fileStat.st_ino == this->m_Inode );
+#endif
+}
+
+void MappedFile::closeFile() {
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+
+    if( this->m_File != nullptr ) {
+        ::CloseHandle( ( HANDLE )this->m_File );
+        this->m_File = nullptr;
+    }
+
+#else
+
+    if( this->m_File >= 0 ) {
+        /** closing the descriptor releases the lock **/
+        ::close( this->m_File );
+        this->m_File = -1;
+    }
+
+#endif
+}
+
+/// FileWriteLock
+FileWriteLock::FileWriteLock( const std::string& path ) : m_Locked( false )
+#if LIBCOMMON_SYSTEM != LIBCOMMON_SYSTEM_WINDOWS
+    , m_File( -1 )
+#endif
+{
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    /** mapped files are opened without write sharing, opening them for writing fails **/
+    ( void )path;
+    this->m_Locked = true;
+#else
+    this->m_File = ::open( path.c_str(), O_RDONLY );
+
+    if( this->m_File < 0 ) {
+        /** nobody can have mapped a file which doesn't exist yet **/
+        this->m_Locked = true;
+        return;
+    }
+
+    this->m_Locked = ( ::flock( this->m_File, LOCK_EX | LOCK_NB ) == 0 );
+
+#if LIBGRAPHICS_DEBUG_OUTPUT
+
+    if( !this->m_Locked ) {
+        qDebug() << "FileWriteLock::FileWriteLock(): File is mapped by another process" << path.c_str();
+    }
+
+#endif
+#endif
+}
+
+FileWriteLock::~FileWriteLock() {
+#if LIBCOMMON_SYSTEM != LIBCOMMON_SYSTEM_WINDOWS
+
+    if( this->m_File >= 0 ) {
+        ::close( this->m_File );
+    }
+
+#endif
+}
+
+bool FileWriteLock::locked() const {
+    return this->m_Locked;
+}
+
+}
@@ -0,0 +1,143 @@
+#include <libgraphics/memorygovernor.hpp>
+#include <QDebug>
+
+#include <algorithm>
+
+namespace libgraphics {
+
+MemoryGovernor::MemoryGovernor( size_t memoryBudget ) :
+    m_MemoryBudget( memoryBudget ) {}
+
+size_t MemoryGovernor::memoryBudget() const {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    return this->m_MemoryBudget;
+}
+
+void MemoryGovernor::setMemoryBudget( size_t budget ) {
+    {
+        std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+        this->m_MemoryBudget = budget;
+    }
+
+    this->reserve( 0 );
+}
+
+size_t MemoryGovernor::memoryUsage() const {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    return this->usage();
+}
+
+bool MemoryGovernor::overBudget() const {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    return this->usage() > this->m_MemoryBudget;
+}
+
+void MemoryGovernor::attach( const std::shared_ptr<StdDynamicPoolAllocator>& allocator ) {
+    assert( allocator );
+
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    if( std::find( this->m_Allocators.begin(), this->m_Allocators.end(), allocator ) == this->m_Allocators.end() ) {
+        this->m_Allocators.push_back( allocator );
+    }
+}
+
+void MemoryGovernor::detach( const std::shared_ptr<StdDynamicPoolAllocator>& allocator ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    this->m_Allocators.erase(
+        std::remove( this->m_Allocators.begin(), this->m_Allocators.end(), allocator ),
+        this->m_Allocators.end()
+    );
+}
+
+void MemoryGovernor::attach( MemoryConsumer* consumer ) {
+    assert( consumer );
+
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    if( std::find( this->m_Consumers.begin(), this->m_Consumers.end(), consumer ) == this->m_Consumers.end() ) {
+        this->m_Consumers.push_front( consumer );
+    }
+}
+
+void MemoryGovernor::detach( MemoryConsumer* consumer ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    this->m_Consumers.remove( consumer );
+}
+
+void MemoryGovernor::touch( MemoryConsumer* consumer ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    const auto it = std::find( this->m_Consumers.begin(), this->m_Consumers.end(), consumer );
+
+    if( it != this->m_Consumers.end() ) {
+        this->m_Consumers.splice( this->m_Consumers.begin(), this->m_Consumers, it );
+    }
+}
+
+bool MemoryGovernor::reserve( size_t requiredBytes ) {
+    std::lock_guard<std::recursive_mutex> lock( this->m_Mutex );
+
+    if( this->usage() + requiredBytes <= this->m_MemoryBudget ) {
+        return true;
+    }
+
+    /** step 1: pool entries nobody uses **/
+    this->releaseUnused();
+
+    /** step 2: memory of the coldest consumers, the released layers
+        return to the pools as unused entries **/
+    for( auto it = this->m_Consumers.rbegin(); it != this->m_Consumers.rend(); ++it ) {
+        const size_t currentUsage = this->usage();
+
+        if( currentUsage + requiredBytes <= this->m_MemoryBudget ) {
+            break;
+        }
+
+        if( ( *it )->reclaim( currentUsage + requiredBytes - this->m_MemoryBudget ) > 0 ) {
+            this->releaseUnused();
+        }
+    }
+
+    const bool fits = ( this->usage() + requiredBytes <= this->m_MemoryBudget );
+
+#if LIBGRAPHICS_DEBUG_OUTPUT
+
+    if( !fits ) {
+        qDebug() << "MemoryGovernor::reserve(): Memory budget exceeded by" << ( this->usage() + requiredBytes - this->m_MemoryBudget ) << "bytes.";
+    }
+
+#endif
+
+    return fits;
+}
+
+MemoryGovernor& MemoryGovernor::global() {
+    static MemoryGovernor governor;
+
+    return governor;
+}
+
+size_t MemoryGovernor::usage() const {
+    size_t bytes( 0 );
+
+    for( auto it = this->m_Allocators.begin(); it != this->m_Allocators.end(); ++it ) {
+        bytes += ( *it )->queryMemoryCapacity();
+    }
+
+    return bytes;
+}
+
+void MemoryGovernor::releaseUnused() {
+    for( auto it = this->m_Allocators.begin(); it != this->m_Allocators.end(); ++it ) {
+        ( *it )->releaseUnused();
+    }
+}
+
+}
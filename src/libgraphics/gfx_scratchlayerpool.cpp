@@ -0,0 +1,222 @@
+#include <libgraphics/scratchlayerpool.hpp>
+#include <QDebug>
+
+namespace libgraphics {
+
+ScratchLayerPool::ScratchLayerPool( size_t memoryBudget ) :
+    m_MemoryBudget( memoryBudget ), m_MemoryUsage( 0 ) {
+    MemoryGovernor::global().attach( this );
+}
+
+ScratchLayerPool::~ScratchLayerPool() {
+    MemoryGovernor::global().detach( this );
+}
+
+size_t ScratchLayerPool::memoryBudget() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_MemoryBudget;
+}
+
+void ScratchLayerPool::setMemoryBudget( size_t budget ) {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    this->m_MemoryBudget = budget;
+    this->evict( 0 );
+}
+
+size_t ScratchLayerPool::memoryUsage() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_MemoryUsage;
+}
+
+size_t ScratchLayerPool::count() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_Entries.size();
+}
+
+ImageLayer* ScratchLayerPool::acquire(
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    size_t                      width,
+    size_t                      height
+) {
+    assert( device );
+
+    {
+        std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+        for( auto it = this->m_Entries.begin(); it != this->m_Entries.end(); ++it ) {
+            const auto& layer = ( *it ).layer;
+
+            if( ( ( *it ).device == device ) &&
+                    ( layer->format() == format ) &&
+                    ( layer->width() == width ) &&
+                    ( layer->height() == height ) &&
+                    layer->containsDataForBackend( device->backendId() ) ) {
+                /** the caller owns the layer until release() **/
+                ImageLayer* leased = ( *it ).layer.release();
+
+                this->m_MemoryUsage -= ( *it ).byteSize;
+                this->m_Entries.erase( it );
+
+                return leased;
+            }
+        }
+    }
+
+    MemoryGovernor::global().touch( this );
+    MemoryGovernor::global().reserve( width * height * fxapi::EPixelFormat::getPixelSize( format ) );
+
+    ImageLayer* layer = makeImageLayer(
+                            device,
+                            "scratch",
+                            format,
+                            width,
+                            height
+                        );
+
+#if LIBGRAPHICS_DEBUG_OUTPUT
+
+    if( layer == nullptr ) {
+        qDebug() << "ScratchLayerPool::acquire(): Failed to allocate layer.";
+    }
+
+#endif
+
+    return layer;
+}
+
+void ScratchLayerPool::release(
+    fxapi::ApiBackendDevice*    device,
+    ImageLayer*                 layer
+) {
+    assert( device );
+
+    if( layer == nullptr ) {
+        return;
+    }
+
+    std::unique_ptr<libgraphics::ImageLayer> releasedLayer( layer );
+    const size_t byteSize = layer->byteSize();
+
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    if( byteSize > this->m_MemoryBudget ) {
+        return;
+    }
+
+    this->evict( byteSize );
+
+    Entry entry;
+    entry.device    = device;
+    entry.layer     = std::move( releasedLayer );
+    entry.byteSize  = byteSize;
+
+    this->m_Entries.push_front( std::move( entry ) );
+    this->m_MemoryUsage += byteSize;
+}
+
+size_t ScratchLayerPool::reclaim( size_t bytes ) {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    size_t released( 0 );
+
+    while( !this->m_Entries.empty() && ( bytes > released ) ) {
+        released += this->m_Entries.back().byteSize;
+
+        this->m_MemoryUsage -= this->m_Entries.back().byteSize;
+        this->m_Entries.pop_back();
+    }
+
+    return released;
+}
+
+void ScratchLayerPool::clear( fxapi::ApiBackendDevice* device ) {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    for( auto it = this->m_Entries.begin(); it != this->m_Entries.end(); ) {
+        if( ( *it ).device == device ) {
+            this->m_MemoryUsage -= ( *it ).byteSize;
+            it = this->m_Entries.erase( it );
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ScratchLayerPool::clear() {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    this->m_Entries.clear();
+    this->m_MemoryUsage = 0;
+}
+
+ScratchLayerPool& ScratchLayerPool::global() {
+    static ScratchLayerPool pool;
+
+    return pool;
+}
+
+void ScratchLayerPool::evict( size_t requiredBytes ) {
+    while( !this->m_Entries.empty() && ( this->m_MemoryUsage + requiredBytes > this->m_MemoryBudget ) ) {
+        this->m_MemoryUsage -= this->m_Entries.back().byteSize;
+        this->m_Entries.pop_back();
+    }
+}
+
+ScopedScratchLayer::ScopedScratchLayer(
+    fxapi::ApiBackendDevice*    device,
+    fxapi::EPixelFormat::t      format,
+    size_t                      width,
+    size_t                      height,
+    ScratchLayerPool&           pool
+) : m_Pool( &pool ), m_Device( device ), m_Layer( pool.acquire( device, format, width, height ) ) {}
+
+ScopedScratchLayer::ScopedScratchLayer(
+    fxapi::ApiBackendDevice*    device,
+    ImageLayer*                 templateLayer,
+    ScratchLayerPool&           pool
+) : m_Pool( &pool ), m_Device( device ), m_Layer( nullptr ) {
+    assert( templateLayer );
+
+    this->m_Layer = pool.acquire(
+                        device,
+                        templateLayer->format(),
+                        templateLayer->width(),
+                        templateLayer->height()
+                    );
+}
+
+ScopedScratchLayer::~ScopedScratchLayer() {
+    this->reset();
+}
+
+ImageLayer* ScopedScratchLayer::get() const {
+    return this->m_Layer;
+}
+
+ImageLayer* ScopedScratchLayer::operator -> () const {
+    assert( this->m_Layer );
+
+    return this->m_Layer;
+}
+
+bool ScopedScratchLayer::empty() const {
+    return ( this->m_Layer == nullptr ) || this->m_Layer->empty();
+}
+
+void ScopedScratchLayer::reset() {
+    this->m_Pool->release( this->m_Device, this->m_Layer );
+    this->m_Layer = nullptr;
+}
+
+void ScopedScratchLayer::swap( ScopedScratchLayer& other ) {
+    std::swap( this->m_Pool, other.m_Pool );
+    std::swap( this->m_Device, other.m_Device );
+    std::swap( this->m_Layer, other.m_Layer );
+}
+
+}
@@ -0,0 +1,172 @@
+#include <libgraphics/spillfile.hpp>
+#include <QDebug>
+
+#include <algorithm>
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+#   include <Windows.h>
+#   include <io.h>
+#else
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+namespace libgraphics {
+
+SpillFile::SpillFile() : m_File( std::tmpfile() ), m_FileLength( 0 ), m_Usage( 0 ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+
+    if( this->m_File == nullptr ) {
+        qDebug() << "SpillFile::SpillFile(): Failed to create scratch file.";
+    }
+
+#endif
+}
+
+SpillFile::~SpillFile() {
+    if( this->m_File != nullptr ) {
+        std::fclose( this->m_File );
+    }
+}
+
+bool SpillFile::valid() const {
+    return ( this->m_File != nullptr );
+}
+
+size_t SpillFile::usage() const {
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    return this->m_Usage;
+}
+
+SpillFile::Region SpillFile::allocate( size_t length ) {
+    assert( length > 0 );
+
+    if( !this->valid() || ( length == 0 ) ) {
+        return Region();
+    }
+
+    const size_t alignedLength = ( length + RegionAlignment - 1 ) / RegionAlignment * RegionAlignment;
+
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    /** first fit, the rest of the free region stays free **/
+    for( auto it = this->m_FreeRegions.begin(); it != this->m_FreeRegions.end(); ++it ) {
+        if( ( *it ).length >= alignedLength ) {
+            const Region region( ( *it ).offset, alignedLength );
+
+            ( *it ).offset += alignedLength;
+            ( *it ).length -= alignedLength;
+
+            if( ( *it ).empty() ) {
+                this->m_FreeRegions.erase( it );
+            }
+
+            this->m_Usage += alignedLength;
+
+            return region;
+        }
+    }
+
+    const Region region( this->m_FileLength, alignedLength );
+
+    if( !this->grow( this->m_FileLength + alignedLength ) ) {
+#if LIBGRAPHICS_DEBUG_OUTPUT
+        qDebug() << "SpillFile::allocate(): Failed to grow scratch file to" << ( this->m_FileLength + alignedLength ) << "bytes.";
+#endif
+        return Region();
+    }
+
+    this->m_Usage += alignedLength;
+
+    return region;
+}
+
+void SpillFile::release( const Region& region ) {
+    if( region.empty() ) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock( this->m_Mutex );
+
+    auto it = std::lower_bound( this->m_FreeRegions.begin(), this->m_FreeRegions.end(), region, []( const Region & lhs, const Region & rhs ) {
+        return lhs.offset < rhs.offset;
+    } );
+    it = this->m_FreeRegions.insert( it, region );
+
+    /** merge with the neighbours **/
+    if( ( ( it + 1 ) != this->m_FreeRegions.end() ) && ( ( *it ).offset + ( *it ).length == ( *( it + 1 ) ).offset ) ) {
+        ( *it ).length += ( *( it + 1 ) ).length;
+        this->m_FreeRegions.erase( it + 1 );
+    }
+
+    if( ( it != this->m_FreeRegions.begin() ) && ( ( *( it - 1 ) ).offset + ( *( it - 1 ) ).length == ( *it ).offset ) ) {
+        ( *( it - 1 ) ).length += ( *it ).length;
+        this->m_FreeRegions.erase( it );
+    }
+
+    this->m_Usage -= region.length;
+}
+
+void* SpillFile::map( const Region& region ) {
+    assert( !region.empty() );
+    assert( region.offset % RegionAlignment == 0 );
+
+    if( !this->valid() || region.empty() ) {
+        return nullptr;
+    }
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    const HANDLE file = ( HANDLE )::_get_osfhandle( ::_fileno( this->m_File ) );
+    const HANDLE mapping = ::CreateFileMappingW( file, NULL, PAGE_READWRITE, 0, 0, NULL );
+
+    if( mapping == NULL ) {
+        return nullptr;
+    }
+
+    const unsigned long long offset = region.offset;
+    void* data = ::MapViewOfFile( mapping, FILE_MAP_ALL_ACCESS, ( DWORD )( offset >> 32 ), ( DWORD )( offset & 0xffffffff ), region.length );
+
+    /** the view keeps the mapping alive **/
+    ::CloseHandle( mapping );
+
+    return data;
+#else
+    void* data = ::mmap( nullptr, region.length, PROT_READ | PROT_WRITE, MAP_SHARED, ::fileno( this->m_File ), ( off_t )region.offset );
+
+    if( data == MAP_FAILED ) {
+        return nullptr;
+    }
+
+    return data;
+#endif
+}
+
+void SpillFile::unmap( void* data, const Region& region ) {
+    if( data == nullptr ) {
+        return;
+    }
+
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    ( void )region;
+    ::UnmapViewOfFile( data );
+#else
+    ::munmap( data, region.length );
+#endif
+}
+
+bool SpillFile::grow( size_t length ) {
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+    const bool grown = ( ::_chsize_s( ::_fileno( this->m_File ), ( __int64 )length ) == 0 );
+#else
+    const bool grown = ( ::ftruncate( ::fileno( this->m_File ), ( off_t )length ) == 0 );
+#endif
+
+    if( grown ) {
+        this->m_FileLength = length;
+    }
+
+    return grown;
+}
+
+}
@@ -5,6 +5,16 @@
 
 #include <optional>
 
+#if defined( _M_X64 ) || defined( _M_IX86 ) || defined( __x86_64__ ) || defined( __i386__ )
+#   define LIBGRAPHICS_SYSTEMINFO_X86
+#   if defined( _MSC_VER )
+#       include <intrin.h>
+#       include <immintrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
 #undef major
 #undef minor
 
@@ -248,6 +258,73 @@ bool SystemInfo::supportOpenGLFeature( const std::string& featureName ) {
 
 }
 
+#ifdef LIBGRAPHICS_SYSTEMINFO_X86
+namespace {
+void queryCpuId( unsigned int leaf, unsigned int subleaf, unsigned int registers[4] ) {
+#   if defined( _MSC_VER )
+    int values[4] = { 0 };
+    __cpuidex( values, ( int )leaf, ( int )subleaf );
+
+    for( size_t i = 0; 4 > i; ++i ) {
+        registers[i] = ( unsigned int )values[i];
+    }
+
+#   else
+    __cpuid_count( leaf, subleaf, registers[0], registers[1], registers[2], registers[3] );
+#   endif
+}
+
+/// returns the register state mask enabled by the os
+unsigned long long queryXCR0() {
+#   if defined( _MSC_VER )
+    return _xgetbv( 0 );
+#   else
+    unsigned int eax( 0 ), edx( 0 );
+    __asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+    return ( ( unsigned long long )edx << 32 ) | eax;
+#   endif
+}
+}
+#endif
+
+SystemInfo::CpuFeatures SystemInfo::queryCpuFeatures() {
+    CpuFeatures features;
+
+#ifdef LIBGRAPHICS_SYSTEMINFO_X86
+    unsigned int registers[4] = { 0 };
+
+    queryCpuId( 0, 0, registers );
+    const unsigned int maxLeaf = registers[0];
+
+    if( maxLeaf < 1 ) {
+        return features;
+    }
+
+    queryCpuId( 1, 0, registers );
+    features.sse2   = ( registers[3] & ( 1u << 26 ) ) != 0;
+    features.sse41  = ( registers[2] & ( 1u << 19 ) ) != 0;
+
+    /// the os has to save the ymm/zmm registers on
+    /// context switches.
+    const bool osxsave = ( registers[2] & ( 1u << 27 ) ) != 0;
+    const bool avx     = ( registers[2] & ( 1u << 28 ) ) != 0;
+
+    if( !osxsave || !avx || maxLeaf < 7 ) {
+        return features;
+    }
+
+    const unsigned long long xcr0 = queryXCR0();
+    const bool ymmEnabled = ( xcr0 & 0x6 ) == 0x6;
+    const bool zmmEnabled = ( xcr0 & 0xe6 ) == 0xe6;
+
+    queryCpuId( 7, 0, registers );
+    features.avx2       = ymmEnabled && ( registers[1] & ( 1u << 5 ) ) != 0;
+    features.avx512bw   = zmmEnabled && ( registers[1] & ( 1u << 16 ) ) != 0 && ( registers[1] & ( 1u << 30 ) ) != 0;
+#endif
+
+    return features;
+}
+
 void SystemInfo::queryOpenGLInfo() {
 
     this->m_OpenGLRenderer      = ( const char* ) ::glGetString( GL_RENDERER );
@@ -335,6 +412,43 @@ void SystemInfo::queryCpuInfo() {
 
     /// query the machine vendor
     this->m_CpuVendor = "Apple";
+
+    this->m_CpuCacheInfo = queryCpuCacheInfo();
+}
+
+SystemInfo::CpuCacheInfo SystemInfo::queryCpuCacheInfo() {
+    CpuCacheInfo info;
+
+    libgraphics::UInt64 value( 0 );
+    size_t length( sizeof( value ) );
+
+    if( ::sysctlbyname( "hw.l1dcachesize", &value, &length, nullptr, 0 ) == 0 && value > 0 ) {
+        info.l1DataSize = value;
+    }
+
+    value = 0; length = sizeof( value );
+
+    if( ::sysctlbyname( "hw.l2cachesize", &value, &length, nullptr, 0 ) == 0 && value > 0 ) {
+        info.l2Size = value;
+    }
+
+    value = 0; length = sizeof( value );
+
+    if( ::sysctlbyname( "hw.l3cachesize", &value, &length, nullptr, 0 ) == 0 ) {
+        info.l3Size = value;
+    }
+
+    value = 0; length = sizeof( value );
+
+    if( ::sysctlbyname( "hw.cachelinesize", &value, &length, nullptr, 0 ) == 0 && value > 0 ) {
+        info.lineSize = ( libgraphics::UInt32 )value;
+    }
+
+    return info;
+}
+
+libgraphics::UInt64 SystemInfo::queryPhysicalMemory() {
+    return sysctl_info_val<libgraphics::UInt64>( CTL_HW, HW_MEMSIZE );
 }
 
 void SystemInfo::queryGeneralInfo() {
@@ -342,9 +456,7 @@ void SystemInfo::queryGeneralInfo() {
     this->m_AvailableMemory     = 0;
     this->m_Unixoid             = true;
 
-    libgraphics::UInt64 size = sysctl_info_val<libgraphics::UInt64>( CTL_HW, HW_MEMSIZE );
-
-    this->m_AvailableMemory = size;
+    this->m_AvailableMemory = queryPhysicalMemory();
 }
 
 void SystemInfo::querySystemInfo() {
@@ -506,35 +618,84 @@ void SystemInfo::queryCpuInfo() {
     this->m_CpuCoreClockSpeed   = ( libgraphics::UInt32 )libcommon::metrics::megahertz<libgraphics::UInt64>( freq );
     this->m_CpuId               = id;
     this->m_CpuVendor           = vendor;
+    this->m_CpuCacheInfo        = queryCpuCacheInfo();
 
 }
 
-void SystemInfo::queryGeneralInfo() {
-    this->m_Architecture        = 64;
-    this->m_AvailableMemory     = 0;
-    this->m_Unixoid             = false;
+SystemInfo::CpuCacheInfo SystemInfo::queryCpuCacheInfo() {
+    CpuCacheInfo info;
 
-    /// query available cpu-accessible memory
-    {
-        ::MEMORYSTATUSEX        status;
-        {
-            ::memset( ( void* )&status, 0, sizeof( status ) );
-            status.dwLength = sizeof( status );
+    ::DWORD length( 0 );
+    ::GetLogicalProcessorInformation( NULL, &length );
+
+    if( length == 0 ) {
+        return info;
+    }
+
+    std::vector< ::SYSTEM_LOGICAL_PROCESSOR_INFORMATION > entries(
+        length / sizeof( ::SYSTEM_LOGICAL_PROCESSOR_INFORMATION )
+    );
+
+    if( !::GetLogicalProcessorInformation( entries.data(), &length ) ) {
+        return info;
+    }
+
+    for( auto it = entries.begin(); it != entries.end(); ++it ) {
+        if( ( *it ).Relationship != ::RelationCache ) {
+            continue;
         }
 
-        ::BOOL  ret =::GlobalMemoryStatusEx(
-                         &status
-                     );
-        ( void )ret;
+        const ::CACHE_DESCRIPTOR& cache = ( *it ).Cache;
 
-        assert( ret );
+        if( cache.Type != ::CacheData && cache.Type != ::CacheUnified ) {
+            continue;
+        }
 
-        /// \todo error log?
+        switch( cache.Level ) {
+            case 1:
+                info.l1DataSize = cache.Size;
+                info.lineSize   = cache.LineSize;
+                break;
 
-        this->m_AvailableMemory = static_cast<libgraphics::UInt64>( status.ullTotalPhys );
+            case 2:
+                info.l2Size     = cache.Size;
+                break;
+
+            case 3:
+                info.l3Size     = cache.Size;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return info;
+}
+
+libgraphics::UInt64 SystemInfo::queryPhysicalMemory() {
+    ::MEMORYSTATUSEX        status;
+    {
+        ::memset( ( void* )&status, 0, sizeof( status ) );
+        status.dwLength = sizeof( status );
+    }
 
-        assert( this->m_AvailableMemory > 0 );
+    if( !::GlobalMemoryStatusEx( &status ) ) {
+        return 0;
     }
+
+    return static_cast<libgraphics::UInt64>( status.ullTotalPhys );
+}
+
+void SystemInfo::queryGeneralInfo() {
+    this->m_Architecture        = 64;
+    this->m_AvailableMemory     = 0;
+    this->m_Unixoid             = false;
+
+    /// query available cpu-accessible memory
+    this->m_AvailableMemory = queryPhysicalMemory();
+
+    assert( this->m_AvailableMemory > 0 );
 }
 
 void SystemInfo::querySystemInfo() {
@@ -935,6 +1096,73 @@ void SystemInfo::queryCpuInfo() {
         this->m_CpuId               = first_proc.model;
     } while( false );
 
+    this->m_CpuCacheInfo = queryCpuCacheInfo();
+}
+
+SystemInfo::CpuCacheInfo SystemInfo::queryCpuCacheInfo() {
+    CpuCacheInfo info;
+
+    /// every index directory describes one cache of cpu0,
+    /// sizes are given as "32K" or "8192K".
+    for( size_t index = 0; 8 > index; ++index ) {
+        std::stringstream base;
+        base << "/sys/devices/system/cpu/cpu0/cache/index" << index << "/";
+
+        std::ifstream levelFile( ( base.str() + "level" ).c_str() );
+        std::ifstream typeFile( ( base.str() + "type" ).c_str() );
+        std::ifstream sizeFile( ( base.str() + "size" ).c_str() );
+        std::ifstream lineFile( ( base.str() + "coherency_line_size" ).c_str() );
+
+        if( !levelFile.is_open() || !typeFile.is_open() || !sizeFile.is_open() ) {
+            break;
+        }
+
+        size_t          level( 0 );
+        std::string     type;
+        libgraphics::UInt64 size( 0 );
+        std::string     unit;
+
+        levelFile >> level;
+        typeFile >> type;
+        sizeFile >> size >> unit;
+
+        if( type != "Data" && type != "Unified" ) {
+            continue;
+        }
+
+        if( unit == "K" ) {
+            size = libcommon::metrics::kilobytes<libcommon::UInt64>( size );
+        } else if( unit == "M" ) {
+            size = libcommon::metrics::megabytes<libcommon::UInt64>( size );
+        }
+
+        switch( level ) {
+            case 1: {
+                libgraphics::UInt32 lineSize( 0 );
+                lineFile >> lineSize;
+
+                info.l1DataSize = size;
+
+                if( lineSize > 0 ) {
+                    info.lineSize = lineSize;
+                }
+            }
+            break;
+
+            case 2:
+                info.l2Size = size;
+                break;
+
+            case 3:
+                info.l3Size = size;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return info;
 }
 
 void SystemInfo::queryGeneralInfo() {
@@ -958,29 +1186,28 @@ void SystemInfo::querySystemInfo() {
     }
 
     /// query ram
-    do {
-        std::string     data;
-        std::ifstream   mem_info_file( "/proc/meminfo" );
+    this->m_AvailableMemory = queryPhysicalMemory();
+}
 
-        unsigned long memory_length( 0 );
+libgraphics::UInt64 SystemInfo::queryPhysicalMemory() {
+    std::string     data;
+    std::ifstream   mem_info_file( "/proc/meminfo" );
 
-        while( mem_info_file >> data ) {
-            if( data == "MemTotal:" ) {
-                if( mem_info_file >> memory_length ) {
-                    break;
-                }
+    unsigned long memory_length( 0 );
 
+    while( mem_info_file >> data ) {
+        if( data == "MemTotal:" ) {
+            if( mem_info_file >> memory_length ) {
                 break;
             }
 
-            mem_info_file.ignore( std::numeric_limits<std::streamsize>::max(), '\n' );
+            break;
         }
 
-        this->m_AvailableMemory = libcommon::metrics::kilobytes<libcommon::UInt64>( memory_length );
-
-
-    } while( false );
+        mem_info_file.ignore( std::numeric_limits<std::streamsize>::max(), '\n' );
+    }
 
+    return libcommon::metrics::kilobytes<libcommon::UInt64>( memory_length );
 }
 
 #else
@@ -1038,6 +1265,10 @@ const libgraphics::UInt16&      SystemInfo::cpuCoreCount() const {
 
 }
 
+const SystemInfo::CpuCacheInfo&             SystemInfo::cpuCacheInfo() const {
+    return this->m_CpuCacheInfo;
+}
+
 const libgraphics::UInt32&      SystemInfo::cpuCoreClockSpeed() const {
 
     return this->m_CpuCoreClockSpeed;
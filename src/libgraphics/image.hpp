@@ -22,6 +22,8 @@ class ImageMetaInfo;
 class ImageMetaInfoDirectory;
 class ImageMetaInfoTag;
 
+class MappedFile;
+
 /// makers and helpers
 ImageLayer* makeImageLayer(
     fxapi::ApiBackendDevice* device,
@@ -387,12 +389,18 @@ class ImageLayerMask {
         );
 
         /// internals
+        /// for writing: the returned object is no longer
+        /// shared with duplicates of the layer.
         fxapi::ApiImageObject* internalImageForBackend(
             int backendId
         ) const;
         fxapi::ApiImageObject* internalImageForDevice(
             fxapi::ApiBackendDevice* device
         ) const;
+        /// for reading only, the object may be shared.
+        fxapi::ApiImageObject* sourceImageForBackend(
+            int backendId
+        ) const;
         fxapi::ApiBackendDevice* internalDeviceForBackend(
             int backendId
         ) const;
@@ -616,6 +624,11 @@ class Image {
         bool reset( fxapi::ApiBackendDevice* device, const libgraphics::BitmapInfo& info );
 
         /// serialization
+        /// true, if the file starts with the magic of the image format
+        /// written by writeToFile()
+        static bool isSerializedImage(
+            const std::string& path
+        );
         size_t readFromFile(
             libgraphics::fxapi::ApiBackendDevice* defaultDevice,
             const std::string& path
@@ -643,6 +656,15 @@ class Image {
         size_t      height() const;
         fxapi::EPixelFormat::t  format() const;
     protected:
+        /// the cpu layers point into the mapping, if one is
+        /// specified.
+        size_t readFromData(
+            libgraphics::fxapi::ApiBackendDevice* defaultDevice,
+            void* data,
+            size_t size,
+            const std::shared_ptr<MappedFile>& mapping
+        );
+
         std::shared_ptr<Private>   d;
 };
 
@@ -896,7 +918,8 @@ class ImageLayer {
         );
 
         /// constructs sub textures of the current
-        /// one.
+        /// one. duplicate() shares the backend data with
+        /// this layer until one of them writes to it.
         ImageLayer* duplicate();
         ImageLayer* duplicateArea(
             libgraphics::Rect32I sourceRect
@@ -941,7 +964,13 @@ class ImageLayer {
         size_t pixelSize() const;
         size_t channelSize() const; /// channelSize == pixelSize
 
-        /// internals, automatic backend mirroring
+        /// identifies the current contents of the layer. changes with
+        /// each write, duplicates share the id until one of them writes.
+        unsigned long long contentId() const;
+
+        /// internals, automatic backend mirroring. a write goes to
+        /// a single backend object and leaves the other mirrors stale,
+        /// these are synchronized lazily when they are accessed.
         bool containsDataForBackend(
             int backendId
         ) const;
@@ -952,12 +981,18 @@ class ImageLayer {
             libgraphics::fxapi::ApiBackendDevice* device,
             int backendId
         );
+        /// for writing: the returned object is up to date, no longer
+        /// shared with duplicates of the layer and the only valid mirror.
         fxapi::ApiImageObject* internalImageForBackend(
             int backendId
         ) const;
         fxapi::ApiImageObject* internalImageForDevice(
             fxapi::ApiBackendDevice* device
         ) const;
+        /// for reading only, the object is up to date but may be shared.
+        fxapi::ApiImageObject* sourceImageForBackend(
+            int backendId
+        ) const;
         fxapi::ApiBackendDevice* internalDeviceForBackend(
             int backendId
         ) const;
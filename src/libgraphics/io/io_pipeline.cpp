@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <cctype>
 #include <vector>
 
 #include <libgraphics/io/pipeline.hpp>
+#include <libgraphics/io/pipelineformatprobe.hpp>
 
 namespace libgraphics {
 namespace io {
@@ -221,6 +224,8 @@ bool StdPipeline::addImportersFromPlugin(
             d->importers.add( ( *it ) );
         }
 
+        this->rebuildImporterIndex();
+
         return true;
     }
 
@@ -232,6 +237,8 @@ bool StdPipeline::addImporter(
 ) {
     if( importer ) {
         d->importers.add( importer );
+        this->rebuildImporterIndex();
+
         return true;
     }
 
@@ -259,19 +266,28 @@ bool StdPipeline::removeExportersForExtension(
 bool StdPipeline::removeImporter(
     PipelineImporter* importer
 ) {
-    return d->importers.remove( importer );
+    const bool removed = d->importers.remove( importer );
+    this->rebuildImporterIndex();
+
+    return removed;
 }
 
 bool StdPipeline::removeImporterByName(
     const char* name
 ) {
-    return d->importers.removeByName( name );
+    const bool removed = d->importers.removeByName( name );
+    this->rebuildImporterIndex();
+
+    return removed;
 }
 
 bool StdPipeline::removeImportersForExtension(
     const char* extension
 ) {
-    return ( d->importers.removeByExtension( extension ) > 0 );
+    const bool removed = ( d->importers.removeByExtension( extension ) > 0 );
+    this->rebuildImporterIndex();
+
+    return removed;
 }
 
 bool StdPipeline::containsExporterForExtension(
@@ -300,6 +316,7 @@ bool StdPipeline::containsImporter(
 
 void StdPipeline::clearImporters() {
     d->importers.clear();
+    d->importerIndex.clear();
 }
 
 void StdPipeline::clearExporters() {
@@ -351,19 +368,35 @@ bool StdPipeline::importFromData(
     return false;
 }
 
+/// the format is detected from the magic bytes of the file header
+/// and only the importer registered for that format decodes the file.
+/// files without known magic bytes are looked up by their extension.
 bool StdPipeline::importFromPath(
     const char* path,
     libgraphics::Bitmap* out
 ) {
-    for( auto it = d->importers.begin(); it != d->importers.end(); ++it ) {
-        if( ( *it )->supportsActionFromPath( path ) ) {
-            if( ( *it )->importFromPath( path, out ) ) {
-                return true;
-            }
-        }
+    assert( path );
+
+    const std::string headerFormat      = probeFormatFromPath( path );
+    const std::string extensionFormat   = formatFromExtension( path );
+
+    /** mis-named file **/
+    if( !headerFormat.empty() && !extensionFormat.empty() && ( headerFormat != extensionFormat ) ) {
+        return false;
     }
 
-    return false;
+    const std::string format = headerFormat.empty() ? extensionFormat : headerFormat;
+    const auto it = d->importerIndex.find( format );
+
+    if( format.empty() || ( it == d->importerIndex.end() ) ) {
+        return false;
+    }
+
+    if( !( *it ).second->supportsActionFromPath( path ) ) {
+        return false;
+    }
+
+    return ( *it ).second->importFromPath( path, out );
 }
 
 bool StdPipeline::exportToStream(
@@ -404,5 +437,18 @@ bool StdPipeline::exportToPath(
 }
 
 
+void StdPipeline::rebuildImporterIndex() {
+    d->importerIndex.clear();
+
+    for( auto it = d->importers.begin(); it != d->importers.end(); ++it ) {
+        std::string format( ( *it )->mainExtension() );
+        std::transform( format.begin(), format.end(), format.begin(), []( char c ) {
+            return ( char )std::toupper( ( unsigned char )c );
+        } );
+
+        d->importerIndex.insert( std::make_pair( format, ( *it ).get() ) );
+    }
+}
+
 }
 }
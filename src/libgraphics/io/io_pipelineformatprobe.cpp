@@ -0,0 +1,124 @@
+#include <libgraphics/io/pipelineformatprobe.hpp>
+#include <libgraphics/io/pipeline.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace libgraphics {
+namespace io {
+
+namespace {
+
+struct FormatSignature {
+    const char*     format;
+    const char*     magic;
+    size_t          length;
+};
+
+/** tiff based raw files are reported as TIF **/
+static const FormatSignature signatures[] = {
+    { LIBGRAPHICS_IO_FORMAT_JPEG,       "\xFF\xD8\xFF", 3 },
+    { LIBGRAPHICS_IO_FORMAT_PNG,        "\x89PNG\r\n\x1A\n", 8 },
+    { LIBGRAPHICS_IO_FORMAT_TIF,        "II*\0", 4 },
+    { LIBGRAPHICS_IO_FORMAT_TIF,        "MM\0*", 4 },
+    { LIBGRAPHICS_IO_FORMAT_TIF,        "II+\0", 4 },
+    { LIBGRAPHICS_IO_FORMAT_TIF,        "MM\0+", 4 },
+    { LIBGRAPHICS_IO_FORMAT_JPEG2000,   "\0\0\0\x0CjP  \r\n\x87\n", 12 },
+    { LIBGRAPHICS_IO_FORMAT_JPEG2000,   "\xFF\x4F\xFF\x51", 4 },
+    { LIBGRAPHICS_IO_FORMAT_BMP,        "BM", 2 }
+};
+
+struct ExtensionAlias {
+    const char*     extension;
+    const char*     format;
+};
+
+static const ExtensionAlias aliases[] = {
+    { "JPG",    LIBGRAPHICS_IO_FORMAT_JPEG },
+    { "JPEG",   LIBGRAPHICS_IO_FORMAT_JPEG },
+    { "JPE",    LIBGRAPHICS_IO_FORMAT_JPEG },
+    { "PNG",    LIBGRAPHICS_IO_FORMAT_PNG },
+    { "TIF",    LIBGRAPHICS_IO_FORMAT_TIF },
+    { "TIFF",   LIBGRAPHICS_IO_FORMAT_TIF },
+    { "BMP",    LIBGRAPHICS_IO_FORMAT_BMP },
+    { "DIB",    LIBGRAPHICS_IO_FORMAT_BMP },
+    { "JP2",    LIBGRAPHICS_IO_FORMAT_JPEG2000 },
+    { "J2K",    LIBGRAPHICS_IO_FORMAT_JPEG2000 },
+    { "JPF",    LIBGRAPHICS_IO_FORMAT_JPEG2000 }
+};
+
+}
+
+std::string probeFormatFromData(
+    const void* data,
+    size_t length
+) {
+    assert( data || ( length == 0 ) );
+
+    if( data == nullptr ) {
+        return std::string();
+    }
+
+    for( size_t i = 0; ( sizeof( signatures ) / sizeof( signatures[0] ) ) > i; ++i ) {
+        if( ( length >= signatures[i].length ) && ( std::memcmp( data, signatures[i].magic, signatures[i].length ) == 0 ) ) {
+            return std::string( signatures[i].format );
+        }
+    }
+
+    return std::string();
+}
+
+std::string probeFormatFromPath(
+    const char* path
+) {
+    assert( path );
+
+    std::FILE* file = std::fopen( path, "rb" );
+
+    if( file == nullptr ) {
+        return std::string();
+    }
+
+    unsigned char header[FormatProbeHeaderLength];
+    const size_t length = std::fread( header, 1, sizeof( header ), file );
+
+    std::fclose( file );
+
+    return probeFormatFromData( header, length );
+}
+
+std::string formatFromExtension(
+    const char* path
+) {
+    assert( path );
+
+    const char* dot         = std::strrchr( path, '.' );
+    const char* separator   = std::strrchr( path, '/' );
+    const char* backslash   = std::strrchr( path, '\\' );
+
+    if( ( backslash != nullptr ) && ( ( separator == nullptr ) || ( backslash > separator ) ) ) {
+        separator = backslash;
+    }
+
+    if( ( dot == nullptr ) || ( ( separator != nullptr ) && ( dot < separator ) ) ) {
+        return std::string();
+    }
+
+    std::string extension( dot + 1 );
+    std::transform( extension.begin(), extension.end(), extension.begin(), []( char c ) {
+        return ( char )std::toupper( ( unsigned char )c );
+    } );
+
+    for( size_t i = 0; ( sizeof( aliases ) / sizeof( aliases[0] ) ) > i; ++i ) {
+        if( extension == aliases[i].extension ) {
+            return std::string( aliases[i].format );
+        }
+    }
+
+    return std::string();
+}
+
+}
+}
@@ -11,6 +11,9 @@
 #include <libgraphics/io/pipelineimporter.hpp>
 #include <libgraphics/io/pipelineprocessingstage.hpp>
 
+#include <map>
+#include <string>
+
 #define LIBGRAPHICS_IO_FORMAT_RAW  "RAW"
 #define LIBGRAPHICS_IO_FORMAT_JPEG  "JPEG"
 #define LIBGRAPHICS_IO_FORMAT_TIF "TIF"
@@ -180,6 +183,10 @@ class StdPipeline : public Pipeline {
             std::vector< std::unique_ptr< PipelineProcessingStage > >  stages;
             PipelineImporterGroup importers;
             PipelineExporterGroup exporters;
+
+            /// format -> importer, the first registered importer
+            /// of a format wins.
+            std::map< std::string, PipelineImporter* >  importerIndex;
         };
 
         StdPipeline();
@@ -319,6 +326,8 @@ class StdPipeline : public Pipeline {
             const char* path,
             libgraphics::Bitmap* toSave
         );
+    protected:
+        void rebuildImporterIndex();
     private:
         std::shared_ptr<Private> d;
 };
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <libgraphics/base.hpp>
+
+#include <string>
+
+namespace libgraphics {
+namespace io {
+
+/// format probing
+/// the probes return one of the LIBGRAPHICS_IO_FORMAT_* names or
+/// an empty string, if the format is unknown.
+
+/// number of header bytes the probe needs at most
+static const size_t FormatProbeHeaderLength = 16;
+
+/// detects the format from the magic bytes at the beginning of
+/// the file data.
+std::string probeFormatFromData(
+    const void* data,
+    size_t length
+);
+
+/// reads the header of the file once and detects the format from
+/// its magic bytes. the file is not decoded.
+std::string probeFormatFromPath(
+    const char* path
+);
+
+/// maps the file extension of the path to a format, e.g. "jpg"
+/// and "jpeg" map to LIBGRAPHICS_IO_FORMAT_JPEG. unknown extensions
+/// return an empty string.
+std::string formatFromExtension(
+    const char* path
+);
+
+}
+}
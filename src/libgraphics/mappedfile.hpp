@@ -0,0 +1,76 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+
+#include <string>
+
+namespace libgraphics {
+
+/// MappedFile
+/**
+ *  Maps a whole file into memory. The mapping is private: pages
+ *  are read from the file on their first access and copied on
+ *  their first write, the file itself is never modified.
+ *
+ *  Pages which haven't been copied yet still come from the file,
+ *  so the file must not be truncated or rewritten while it is
+ *  mapped. The mapping holds a shared lock on the file, writers
+ *  take the exclusive FileWriteLock and detach the mappings of
+ *  their own process first.
+ */
+class MappedFile : public libcommon::INonCopyable {
+    public:
+        explicit MappedFile( const std::string& path );
+        virtual ~MappedFile();
+
+        /// false, if the file couldn't be opened, locked or mapped
+        bool    valid() const;
+
+        void*   data() const;
+        size_t  length() const;
+
+        /// copies the mapped pages into anonymous memory at the same
+        /// address and releases the file. the data must not be written
+        /// by other threads meanwhile.
+        bool    detach();
+        bool    detached() const;
+
+        /// detaches all mappings of the specified file in this process
+        static void detachAll( const std::string& path );
+    protected:
+        bool    refersTo( const std::string& path ) const;
+        void    closeFile();
+
+        void*   m_Data;
+        size_t  m_Length;
+        bool    m_Detached;
+        std::string m_Path;
+#if LIBCOMMON_SYSTEM == LIBCOMMON_SYSTEM_WINDOWS
+        void*   m_File;
+#else
+        int     m_File;
+        unsigned long long  m_Device;
+        unsigned long long  m_Inode;
+#endif
+};
+
+/// FileWriteLock
+/**
+ *  Exclusive lock of a file, which is about to be replaced. Fails,
+ *  while another process keeps the file mapped.
+ */
+class FileWriteLock : public libcommon::INonCopyable {
+    public:
+        explicit FileWriteLock( const std::string& path );
+        virtual ~FileWriteLock();
+
+        bool    locked() const;
+    protected:
+        bool    m_Locked;
+#if LIBCOMMON_SYSTEM != LIBCOMMON_SYSTEM_WINDOWS
+        int     m_File;
+#endif
+};
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+#include <libgraphics/allocator.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace libgraphics {
+
+/// MemoryConsumer
+/**
+ *  Holds memory, which can be rebuilt when it's needed again,
+ *  like cached filter results, idle scratch layers or the
+ *  buffers filters keep between renders.
+ */
+class MemoryConsumer {
+    public:
+        virtual ~MemoryConsumer() {}
+
+        /// bytes held by the consumer
+        virtual size_t memoryUsage() const = 0;
+
+        /// gives back the least recently used memory until
+        /// bytes are released or nothing is left. returns the
+        /// number of released bytes.
+        virtual size_t reclaim( size_t bytes ) = 0;
+};
+
+/// MemoryGovernor
+/**
+ *  Keeps the memory of the pool allocators below a budget. The
+ *  cpu backend allocates the data of all image layers and pool
+ *  blobs from these allocators. When an allocation doesn't fit,
+ *  the unused pool entries are released first, then the least
+ *  recently used consumers are asked to reclaim memory.
+ *  Consumers must not call the governor while they hold a lock
+ *  that reclaim() takes.
+ *
+ *  Only the attached cpu allocators are counted. Textures and
+ *  render targets of the opengl backend live in its own pools,
+ *  see ApiBackendDevice::queryManagedMemoryConsumption(), and
+ *  are neither counted nor released by the governor.
+ */
+class MemoryGovernor : public libcommon::INonCopyable {
+    public:
+        static const size_t DefaultMemoryBudget = ( size_t )2048 * 1024 * 1024;
+
+        explicit MemoryGovernor( size_t memoryBudget = DefaultMemoryBudget );
+        virtual ~MemoryGovernor() {}
+
+        /// the application sets the budget from the physical
+        /// memory, see ApplicationBackend::initializeCpuBackend().
+        size_t  memoryBudget() const;
+        void    setMemoryBudget( size_t budget );
+
+        /// bytes allocated by the attached allocators, without
+        /// the memory of the opengl backend
+        size_t  memoryUsage() const;
+        bool    overBudget() const;
+
+        void    attach( const std::shared_ptr<StdDynamicPoolAllocator>& allocator );
+        void    detach( const std::shared_ptr<StdDynamicPoolAllocator>& allocator );
+
+        void    attach( MemoryConsumer* consumer );
+        void    detach( MemoryConsumer* consumer );
+
+        /// marks the consumer as recently used
+        void    touch( MemoryConsumer* consumer );
+
+        /// frees memory until requiredBytes more fit into the
+        /// budget. returns false if they don't fit anyway.
+        bool    reserve( size_t requiredBytes );
+
+        /// returns the governor shared by the render paths.
+        static MemoryGovernor& global();
+    protected:
+        size_t  usage() const;
+        void    releaseUnused();
+
+        mutable std::recursive_mutex                                m_Mutex;
+        std::vector< std::shared_ptr<StdDynamicPoolAllocator> >     m_Allocators;
+        std::list<MemoryConsumer*>                                  m_Consumers;    /// most recently used first
+        size_t                                                      m_MemoryBudget;
+};
+
+}
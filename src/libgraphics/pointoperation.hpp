@@ -0,0 +1,46 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+#include <libgraphics/fxapi.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace libgraphics {
+
+/// position of a run of pixels passed to
+/// PointOperation::processRow().
+struct PointOperationRow {
+    int     x;              /// first pixel of the run
+    int     y;
+    size_t  width;          /// pixels in the run
+    size_t  channels;
+    size_t  imageWidth;
+    size_t  imageHeight;
+
+    PointOperationRow() : x( 0 ), y( 0 ), width( 0 ), channels( 0 ),
+        imageWidth( 0 ), imageHeight( 0 ) {}
+};
+
+/// PointOperation
+/**
+ *  Per pixel stage of a fused filter pass, see
+ *  Filter::pointOperation(). processRow() transforms a run of
+ *  interleaved pixels in place and has to produce the same
+ *  values as the standalone operation of the filter. Stages are
+ *  immutable and shared between the render threads.
+ */
+class PointOperation : public libcommon::INonCopyable {
+    public:
+        virtual ~PointOperation() {}
+
+        virtual bool supportsFormat( fxapi::EPixelFormat::t format ) const = 0;
+
+        virtual void processRow( unsigned char* pixels, const PointOperationRow& row ) const = 0;
+        virtual void processRow( unsigned short* pixels, const PointOperationRow& row ) const = 0;
+};
+
+typedef std::vector<std::shared_ptr<const PointOperation> > PointOperationList;
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+#include <libgraphics/fxapi.hpp>
+#include <libgraphics/image.hpp>
+#include <libgraphics/memorygovernor.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace libgraphics {
+
+/// ScratchLayerPool
+/**
+ *  Keeps released temporary layers alive, so the next render
+ *  can lease a layer of the same backend, format and size
+ *  without allocating it again. The content of a leased layer
+ *  is undefined. The least recently released layers are
+ *  destroyed as soon as the idle layers exceed the memory
+ *  budget, or when the MemoryGovernor reclaims memory.
+ */
+class ScratchLayerPool : public libcommon::INonCopyable, public MemoryConsumer {
+    public:
+        static const size_t DefaultMemoryBudget = 512 * 1024 * 1024;
+
+        explicit ScratchLayerPool( size_t memoryBudget = DefaultMemoryBudget );
+        virtual ~ScratchLayerPool();
+
+        size_t  memoryBudget() const;
+        void    setMemoryBudget( size_t budget );
+
+        /// bytes used by the idle layers
+        virtual size_t  memoryUsage() const;
+        size_t  count() const;
+
+        /// destroys the least recently released layers.
+        virtual size_t  reclaim( size_t bytes );
+
+        /// returns an idle layer with matching properties or
+        /// creates a new one. returns nullptr on failure.
+        ImageLayer* acquire(
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            size_t                      width,
+            size_t                      height
+        );
+
+        /// hands a layer from acquire() back to the pool.
+        void release(
+            fxapi::ApiBackendDevice*    device,
+            ImageLayer*                 layer
+        );
+
+        /// destroys all idle layers of the device. has to be
+        /// called before the device is shut down.
+        void clear( fxapi::ApiBackendDevice* device );
+        void clear();
+
+        /// returns the pool shared by the render paths.
+        static ScratchLayerPool& global();
+    protected:
+        struct Entry {
+            fxapi::ApiBackendDevice*                    device;
+            std::unique_ptr<libgraphics::ImageLayer>    layer;
+            size_t                                      byteSize;
+        };
+        typedef std::list<Entry>    EntryList;
+
+        void evict( size_t requiredBytes );
+
+        mutable std::mutex  m_Mutex;
+        EntryList           m_Entries;      /// most recently released first
+        size_t              m_MemoryBudget;
+        size_t              m_MemoryUsage;
+};
+
+/// ScopedScratchLayer
+/**
+ *  Leases a layer from a ScratchLayerPool and returns it to
+ *  the pool on destruction.
+ */
+class ScopedScratchLayer : public libcommon::INonCopyable {
+    public:
+        ScopedScratchLayer(
+            fxapi::ApiBackendDevice*    device,
+            fxapi::EPixelFormat::t      format,
+            size_t                      width,
+            size_t                      height,
+            ScratchLayerPool&           pool = ScratchLayerPool::global()
+        );
+        ScopedScratchLayer(
+            fxapi::ApiBackendDevice*    device,
+            ImageLayer*                 templateLayer,
+            ScratchLayerPool&           pool = ScratchLayerPool::global()
+        );
+        virtual ~ScopedScratchLayer();
+
+        ImageLayer* get() const;
+        ImageLayer* operator -> () const;
+
+        /// true, if no layer could be leased
+        bool empty() const;
+
+        /// returns the layer to the pool before the
+        /// end of the scope.
+        void reset();
+
+        void swap( ScopedScratchLayer& other );
+    protected:
+        ScratchLayerPool*           m_Pool;
+        fxapi::ApiBackendDevice*    m_Device;
+        ImageLayer*                 m_Layer;
+};
+
+}
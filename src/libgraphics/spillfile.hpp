@@ -0,0 +1,66 @@
+#pragma once
+
+#include <libcommon/noncopyable.hpp>
+#include <libgraphics/base.hpp>
+
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace libgraphics {
+
+/// SpillFile
+/**
+ *  Anonymous scratch file, which keeps evicted buffers on disk.
+ *  The file is deleted by the system as soon as it's closed. A
+ *  region is mapped into memory only while it's written or
+ *  read, so the pages of spilled buffers can be dropped by the
+ *  system at any time.
+ */
+class SpillFile : public libcommon::INonCopyable {
+    public:
+        /// regions start at multiples of the allocation
+        /// granularity of file mappings.
+        static const size_t RegionAlignment = 64 * 1024;
+
+        struct Region {
+            size_t  offset;
+            size_t  length;
+
+            Region() : offset( 0 ), length( 0 ) {}
+            Region( size_t _offset, size_t _length ) : offset( _offset ), length( _length ) {}
+
+            bool empty() const {
+                return length == 0;
+            }
+        };
+
+        SpillFile();
+        virtual ~SpillFile();
+
+        /// false, if no scratch file could be created
+        bool    valid() const;
+
+        /// bytes of the regions in use
+        size_t  usage() const;
+
+        /// reserves a region of length bytes, the returned
+        /// region is empty on failure.
+        Region  allocate( size_t length );
+        void    release( const Region& region );
+
+        /// maps the region into memory, returns nullptr on
+        /// failure. each mapping has to be unmapped.
+        void*   map( const Region& region );
+        void    unmap( void* data, const Region& region );
+    protected:
+        bool    grow( size_t length );
+
+        mutable std::mutex      m_Mutex;
+        std::FILE*              m_File;
+        size_t                  m_FileLength;
+        size_t                  m_Usage;
+        std::vector<Region>     m_FreeRegions;  /// sorted by offset
+};
+
+}
@@ -101,8 +101,41 @@ class LIBGRAPHICS_API SystemInfo {
         };
 
 
+        struct CpuCacheInfo {
+            libgraphics::UInt64         l1DataSize; /// per core
+            libgraphics::UInt64         l2Size;     /// per core
+            libgraphics::UInt64         l3Size;     /// shared, 0 if not present
+            libgraphics::UInt32         lineSize;
+
+            CpuCacheInfo() : l1DataSize( 32 * 1024 ), l2Size( 256 * 1024 ),
+                l3Size( 0 ), lineSize( 64 ) {}
+        };
+
+        struct CpuFeatures {
+            bool                        sse2;
+            bool                        sse41;
+            bool                        avx2;       /// includes os support for ymm registers
+            bool                        avx512bw;   /// includes os support for zmm registers
+
+            CpuFeatures() : sse2( false ), sse41( false ),
+                avx2( false ), avx512bw( false ) {}
+        };
+
         SystemInfo();
 
+        /// queries the cache hierarchy of the first cpu core. does
+        /// not touch opengl, so it is safe to call without a context.
+        /// falls back to conservative defaults if detection fails.
+        static CpuCacheInfo             queryCpuCacheInfo();
+
+        /// queries the simd extensions of the cpu via cpuid. all
+        /// flags are false on non-x86 systems.
+        static CpuFeatures              queryCpuFeatures();
+
+        /// queries the installed physical memory in bytes. does not
+        /// touch opengl. returns 0 if detection fails.
+        static libgraphics::UInt64      queryPhysicalMemory();
+
         const libgraphics::UInt64&      availableMemory() const;
         const libgraphics::UInt8&       architecture() const;
 
@@ -110,6 +143,7 @@ class LIBGRAPHICS_API SystemInfo {
         const std::string&              cpuId() const;
         const libgraphics::UInt16&      cpuCoreCount() const;
         const libgraphics::UInt32&      cpuCoreClockSpeed() const;
+        const CpuCacheInfo&             cpuCacheInfo() const;
 
         const std::string&              systemName() const;
         const std::string&              systemVersion() const;
@@ -141,6 +175,7 @@ class LIBGRAPHICS_API SystemInfo {
         std::string                 m_CpuId;
         libgraphics::UInt16         m_CpuCoreCount;
         libgraphics::UInt32         m_CpuCoreClockSpeed;
+        CpuCacheInfo                m_CpuCacheInfo;
 
         /// system info
         std::string                 m_SystemName;
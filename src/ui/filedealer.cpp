@@ -32,6 +32,10 @@ void FileDealer::setType( FileType type ) {
             mSettingsRecent = "recentImages";
             mDefaultSuffix = "jpg";
             mPossibleSuffixes << "jpg" << "jpeg" << "png" << "tif" << "tiff";
+            // images saved by libgraphics can be opened, but not exported
+            mOpenSelection = tr( "Images (*.jpg *.jpeg *.JPG *.JPEG *.png *.PNG *.tif *.TIF *.tiff *.TIFF *.fdim *.FDIM)" );
+            mOpenSuffixes = mPossibleSuffixes;
+            mOpenSuffixes << "fdim";
             mUpdateRecentOnSave = false;
         }
         break;
@@ -44,6 +48,8 @@ void FileDealer::setType( FileType type ) {
             mSettingsRecent = "recentPresets";
             mDefaultSuffix = "bs";
             mPossibleSuffixes << "bs";
+            mOpenSelection = mIOSelection;
+            mOpenSuffixes = mPossibleSuffixes;
             mUpdateRecentOnSave = true;
         }
         break;
@@ -54,7 +60,7 @@ void FileDealer::setType( FileType type ) {
 }
 
 bool FileDealer::knows( const QString& suffix ) const {
-    bool ok = mPossibleSuffixes.contains( suffix, Qt::CaseInsensitive );
+    bool ok = mOpenSuffixes.contains( suffix, Qt::CaseInsensitive );
     return ok;
 }
 
@@ -119,7 +125,7 @@ std::pair<bool, QString> FileDealer::getOpenFilename() {
 
     QWidget* parent = mMenu ? mMenu->parentWidget() : 0;
 
-    QString filename = QFileDialog::getOpenFileName( parent, mOpenTitle, dir, mIOSelection );
+    QString filename = QFileDialog::getOpenFileName( parent, mOpenTitle, dir, mOpenSelection );
 
     if( filename.isEmpty() ) {
         ok = false;
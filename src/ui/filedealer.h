@@ -37,9 +37,11 @@ class FileDealer : public QObject {
         QString mSaveTitle;
         QString mOpenTitle;
         QString mIOSelection;
+        QString mOpenSelection;
         QString mSettingsRecent;
         QString mDefaultSuffix;
         QStringList mPossibleSuffixes;
+        QStringList mOpenSuffixes;
         bool mUpdateRecentOnSave;
 
         enum { MaxRecentFiles = 5 };
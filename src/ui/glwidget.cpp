@@ -304,7 +304,7 @@ void GLWidget::paintGL() {
 
     if( theApp()->view->valid() ) {
         t.start();
-        const auto successfullyUpdatedPreview = theApp()->updatePreview();
+        theApp()->updatePreview();
         elapsed = t.elapsed();
 
         if( elapsed == 0 ) {
@@ -313,7 +313,8 @@ void GLWidget::paintGL() {
 
         glColor3f( 1.0, 1.0, 1.0 );
 
-        if( !successfullyUpdatedPreview && theApp()->shouldRender ) {
+        /** throttled, or a coarse preview waits for refinement */
+        if( theApp()->shouldRender ) {
             if( staticScheduledUpdateCounter == 0 ) {
                 staticScheduledUpdateCounter++;
 
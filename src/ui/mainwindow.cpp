@@ -729,7 +729,7 @@ void MainWindow::setupHistograms() {
         return;
     }
 
-    libgraphics::backend::cpu::ImageObject* _backendObj = ( libgraphics::backend::cpu::ImageObject* )_topLayer->internalImageForBackend( FXAPI_BACKEND_CPU );
+    libgraphics::backend::cpu::ImageObject* _backendObj = ( libgraphics::backend::cpu::ImageObject* )_topLayer->sourceImageForBackend( FXAPI_BACKEND_CPU );
 
     if( !_backendObj ) {
         qDebug() << "Failed to setup histograms: Needs valid original image with cpu-backend.";
@@ -922,6 +922,7 @@ void MainWindow::on_lastWindowClosed() {
 
     qDebug() << "Resetting preview and session objects...";
     theApp()->actionRenderPreview.reset();
+    theApp()->previewLevels.clear();
     theApp()->currentSession->resetImageState();
     theApp()->filterFilmGrain->deleteGrainForBackend( FXAPI_BACKEND_CPU );
     theApp()->filterCascadedSharpen->deleteBlurBuffersForBackend( FXAPI_BACKEND_CPU );
@@ -55,6 +55,18 @@ struct App {
         libfoundation::app::ApplicationSession*                                                 currentSession;
         std::unique_ptr<libfoundation::app::ApplicationActionRenderPreview>                actionRenderPreview;
 
+        /// coarser copies of the preview, previewLevels[n] is
+        /// level n + 1 with half the size of level n. level 0
+        /// is the preview rendered by actionRenderPreview.
+        struct PreviewLevel {
+            std::unique_ptr<libgraphics::Image>                                     image;
+            std::unique_ptr<libfoundation::app::ApplicationActionRenderPreview>     actionRenderPreview;
+            float                                                                   scale; /// level 0 pixels per pixel
+
+            PreviewLevel() : scale( 1.0f ) {}
+        };
+        std::vector<PreviewLevel>                                                               previewLevels;
+
         /// ui
         std::unique_ptr<blacksilk::GraphicsView>                       view;
         bool                                                                shouldRender;
@@ -217,7 +229,8 @@ struct App {
             \since 1.0
             \brief Postprocesses the current original image
                 and eventually scales the preview template image layer
-                down.
+                down. Builds the layers of the preview pyramid from the
+                template.
         */
         void postProcessOriginalImage();
 
@@ -262,7 +275,12 @@ struct App {
             \fn updatePreview
             \since 1.0
             \brief Executes a preview render action, if needed. You can trigger
-                this by calling triggerRendering().
+                this by calling triggerRendering(). A zoomed view renders only its
+                visible part on the cpu backend, moving the view to a part, which
+                wasn't rendered yet, triggers a new render. The preview is rendered at the coarsest
+                level of the preview pyramid, which matches the zoom. The first
+                frame after triggerRendering() is rendered one level coarser and
+                refined by the following calls.
         */
         bool updatePreview();
 
@@ -342,6 +360,29 @@ struct App {
         void postImageLoad();
 
 
+        /**
+            \fn setupPreviewLevels
+            \brief Creates the coarse preview levels from the pyramid layers
+                of the original image.
+        */
+        bool setupPreviewLevels();
+
+        /**
+            \fn previewLevelForZoom
+            \brief Returns the coarsest preview level, which still has a
+                pixel for every screen pixel at the current zoom.
+        */
+        size_t previewLevelForZoom() const;
+
+        /**
+            \fn showPreviewLevel
+            \brief Shows the layers of the specified preview level in the
+                view.
+        */
+        void showPreviewLevel( size_t level );
+
+        libfoundation::app::ApplicationActionRenderPreview* previewLevelAction( size_t level ) const;
+
         /**
             \fn loadInternalPresets
             \brief Loads the internal presets into to the corresponding
@@ -356,6 +397,10 @@ struct App {
         QElapsedTimer       m_FrameTimer;
         bool                m_FrameTimerEnabled;
         size_t              m_MaxFPS;
+
+        libgraphics::Rect32I    m_RenderedArea;
+        size_t                  m_PreviewLevel;
+        bool                    m_PreviewChanged;
 };
 
 App* theApp();
@@ -14,6 +14,7 @@
 #include <libgraphics/backend/cpu/cpu_imageobject.hpp>
 #include <utils/hostmachine.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 #include <iostream>
@@ -44,7 +45,9 @@ App::App() :
     m_InitializedGraphicsBackend( false ),
     m_InitializedGraphicsPreview( false ),
     m_FrameTimerEnabled( true ),
-    m_MaxFPS( 10 ) {
+    m_MaxFPS( 10 ),
+    m_PreviewLevel( 0 ),
+    m_PreviewChanged( false ) {
 
     this->view.reset( new blacksilk::GraphicsView() );
 
@@ -769,6 +772,45 @@ float getScalingFactor( const float maxSize, const size_t width, const size_t he
     return fac;
 }
 
+/// the pyramid ends, before a level gets smaller than
+/// MinPreviewLevelSize pixels in both dimensions.
+static const size_t MaxPreviewLevels    = 4;
+static const size_t MinPreviewLevelSize = 256;
+
+static std::string previewLevelName( size_t level ) {
+    return "PreviewLevel" + std::to_string( level );
+}
+
+static void buildPreviewPyramid(
+    libgraphics::Image* originalImage,
+    libgraphics::ImageLayer* baseLayer,
+    libgraphics::fxapi::ApiBackendDevice* device
+) {
+    libgraphics::ImageLayer* previousLevel = baseLayer;
+
+    for( size_t level = 1; MaxPreviewLevels >= level; ++level ) {
+        if( std::max( previousLevel->width(), previousLevel->height() ) / 2 < MinPreviewLevelSize ) {
+            break;
+        }
+
+        libgraphics::ImageLayer* currentLevel = originalImage->createAndAppendLayer(
+                device,
+                previewLevelName( level )
+                                                );
+        assert( currentLevel != nullptr );
+
+        libgraphics::fx::operations::areaSample2x2(
+            currentLevel,
+            previousLevel,
+            0.5f
+        );
+
+        qDebug() << "PostProcess: Preview level" << level << "@" << currentLevel->width() << "x" << currentLevel->height();
+
+        previousLevel = currentLevel;
+    }
+}
+
 void App::postProcessOriginalImage() {
     if( theApp()->currentSession->originalImage() != nullptr ) {
         libgraphics::Image* originalImage = ( libgraphics::Image* )currentSession->originalImage();
@@ -817,12 +859,16 @@ void App::postProcessOriginalImage() {
 
             preview.isScaledDown = true;
 
+            buildPreviewPyramid( originalImage, previewTemplate, this->currentSession->backend()->cpuBackend() );
+
             return;
         }
 
         preview.isScaledDown = false;
         preview.currentImageSize =
             std::ceil( ( float )( originalImage->width() * originalImage->height() * libgraphics::fxapi::EPixelFormat::getPixelSize( originalImage->format() ) ) / ( 1000.0f * 1000.0f ) );
+
+        buildPreviewPyramid( originalImage, originalImage->topLayer(), this->currentSession->backend()->cpuBackend() );
     } else {
         qDebug() << "Error: Failed to postprocess original image. Original image not set.";
     }
@@ -837,7 +883,7 @@ bool App::setupPreviewFromOriginalImage() {
 
     assert( templateLayer != nullptr );
 
-    libgraphics::backend::cpu::ImageObject* cpuLayer = ( libgraphics::backend::cpu::ImageObject* )templateLayer->internalImageForBackend( FXAPI_BACKEND_CPU );
+    libgraphics::backend::cpu::ImageObject* cpuLayer = ( libgraphics::backend::cpu::ImageObject* )templateLayer->sourceImageForBackend( FXAPI_BACKEND_CPU );
     assert( cpuLayer != nullptr );
 
     bool ok = setupPreview(
@@ -846,9 +892,103 @@ bool App::setupPreviewFromOriginalImage() {
                   cpuLayer->height(),
                   cpuLayer->format()
               );
+
+    if( ok ) {
+        ok = setupPreviewLevels();
+    }
+
     return ok;
 }
 
+bool App::setupPreviewLevels() {
+    const libgraphics::Image* previewImage = this->currentSession->previewImage();
+    assert( previewImage != nullptr );
+
+    for( size_t level = 1; ; ++level ) {
+        libgraphics::ImageLayer* levelLayer = this->currentSession->originalImage()->layerByName( previewLevelName( level ) );
+
+        if( levelLayer == nullptr ) {
+            break;
+        }
+
+        libgraphics::backend::cpu::ImageObject* cpuLayer = ( libgraphics::backend::cpu::ImageObject* )levelLayer->sourceImageForBackend( FXAPI_BACKEND_CPU );
+        assert( cpuLayer != nullptr );
+
+        if( cpuLayer == nullptr ) {
+            return false;
+        }
+
+        PreviewLevel previewLevel;
+        previewLevel.scale = ( float )previewImage->width() / ( float )cpuLayer->width();
+        previewLevel.image.reset( new libgraphics::Image(
+                                      this->appBackend->gpuBackend(),
+                                      cpuLayer->format(),
+                                      cpuLayer->width(),
+                                      cpuLayer->height(),
+                                      cpuLayer->data()
+                                  ) );
+
+        libgraphics::ImageLayer* topLayer = previewLevel.image->topLayer();
+        libgraphics::ImageLayer* destinationLayer = topLayer->duplicate();
+
+        previewLevel.image->appendLayer( destinationLayer );
+        previewLevel.actionRenderPreview.reset( new libfoundation::app::ApplicationActionRenderPreview(
+                this->app->currentSession(),
+                this->appBackend->gpuBackend(),
+                destinationLayer,
+                topLayer,
+                this->app->currentSession()->filterStack()
+                                                ) );
+        previewLevel.actionRenderPreview->setRegionOfInterestDevice( this->appBackend->cpuBackend() );
+        previewLevel.actionRenderPreview->setResultCache( this->app->currentSession()->previewResultCache() );
+
+        /// the levels keep their own filter buffers and scale
+        /// the filter radii down to their size
+        previewLevel.actionRenderPreview->setResolutionScale( 1.0f / previewLevel.scale );
+
+        this->previewLevels.push_back( std::move( previewLevel ) );
+    }
+
+    return true;
+}
+
+size_t App::previewLevelForZoom() const {
+    const double maxScale = 1.0 / this->view->zoom();
+    size_t level( 0 );
+
+    while( ( this->previewLevels.size() > level ) && ( this->previewLevels[level].scale <= maxScale ) ) {
+        ++level;
+    }
+
+    return level;
+}
+
+libfoundation::app::ApplicationActionRenderPreview* App::previewLevelAction( size_t level ) const {
+    if( level == 0 ) {
+        return this->actionRenderPreview.get();
+    }
+
+    assert( this->previewLevels.size() >= level );
+
+    return this->previewLevels[level - 1].actionRenderPreview.get();
+}
+
+void App::showPreviewLevel( size_t level ) {
+    if( level == 0 ) {
+        this->view->setLayer( this->actionRenderPreview->imageLayer() );
+        this->view->setOriginalLayer( this->currentSession->previewImage()->topLayer() );
+        this->view->setLayerScale( 1.0f );
+    } else {
+        const PreviewLevel& previewLevel = this->previewLevels[level - 1];
+
+        this->view->setLayer( previewLevel.actionRenderPreview->imageLayer() );
+        this->view->setOriginalLayer( previewLevel.image->topLayer() );
+        this->view->setLayerScale( previewLevel.scale );
+    }
+
+    this->m_PreviewLevel = level;
+}
+
 bool App::setupPreview(
     void* data,
     size_t width,
@@ -885,6 +1025,11 @@ bool App::setupPreview(
         this->actionRenderPreview.reset();
     }
 
+    this->previewLevels.clear();
+    this->m_PreviewLevel = 0;
+    this->m_PreviewChanged = false;
+    this->view->setLayerScale( 1.0f );
+
     /// initialize current image state.
     {
         libgraphics::Image* previewImage = new libgraphics::Image(
@@ -917,6 +1062,8 @@ bool App::setupPreview(
             topLayer,
             this->app->currentSession()->filterStack()
         );
+        arp->setRegionOfInterestDevice( this->appBackend->cpuBackend() );
+        arp->setResultCache( this->app->currentSession()->previewResultCache() );
         this->actionRenderPreview.reset( arp );
     }
 
@@ -977,10 +1124,30 @@ bool App::setupPreview(
 
 void App::triggerRendering() {
     this->shouldRender = true;
+    this->m_PreviewChanged = true;
+
+    /// a render of the previous state is superseded
+    for( size_t level = 0; this->previewLevels.size() >= level; ++level ) {
+        libfoundation::app::ApplicationActionRenderPreview* action = this->previewLevelAction( level );
+
+        if( action ) {
+            action->cancel();
+        }
+    }
 }
 
 
 bool App::updatePreview() {
+    const size_t zoomLevel = this->previewLevelForZoom();
+
+    /// refine a coarse preview or render the parts, which
+    /// were moved into the view.
+    if( !this->shouldRender ) {
+        if( ( this->m_PreviewLevel != zoomLevel ) || !this->m_RenderedArea.contains( this->view->visibleArea() ) ) {
+            this->shouldRender = true;
+        }
+    }
+
     if( this->shouldRender ) {
         qint64 elapsedMilliseconds = this->m_FrameTimer.elapsed();
         qint64 minimalMilliseconds = 1000 / this->m_MaxFPS;
@@ -993,19 +1160,49 @@ bool App::updatePreview() {
 
         this->shouldRender = false;
 
-        if( !this->actionRenderPreview ) {
+        /// the first frame after a change is rendered one level
+        /// coarser, the following frames refine it level by level.
+        size_t level( zoomLevel );
+
+        if( this->m_PreviewChanged ) {
+            level = std::min( zoomLevel + 1, this->previewLevels.size() );
+        } else if( this->m_PreviewLevel > zoomLevel ) {
+            level = this->m_PreviewLevel - 1;
+        }
+
+        this->m_PreviewChanged = false;
+
+        libfoundation::app::ApplicationActionRenderPreview* actionRenderPreview = this->previewLevelAction( level );
+
+        if( !actionRenderPreview ) {
             assert( false );
             this->m_FrameTimer.restart();
             return false; /** no initialized preview object **/
         }
 
-        if( !this->actionRenderPreview->finished() ) {
+        if( !actionRenderPreview->finished() ) {
             assert( false );
             this->m_FrameTimer.restart();
             return false; /** preview renderer currently working **/
         }
 
-        const auto successfullyRenderedPreview = this->actionRenderPreview->process();
+        const size_t previousLevel = this->m_PreviewLevel;
+        this->showPreviewLevel( level );
+
+        const libgraphics::Rect32I visibleArea = this->view->visibleArea();
+        actionRenderPreview->setRegionOfInterest( visibleArea );
+        actionRenderPreview->resetCancellation();
+
+        const auto successfullyRenderedPreview = actionRenderPreview->process();
+
+        if( !successfullyRenderedPreview && actionRenderPreview->cancelled() ) {
+            /// superseded by a newer edit, keep showing the last frame
+            this->showPreviewLevel( previousLevel );
+            this->shouldRender = true;
+            this->m_FrameTimer.restart();
+            return false;
+        }
+
         assert( successfullyRenderedPreview );
 
         if( !successfullyRenderedPreview ) {
@@ -1014,8 +1211,11 @@ bool App::updatePreview() {
             return false;
         }
 
+        /// a zoomed view is rendered on the cpu backend, which
+        /// renders the visible area only
+        this->m_RenderedArea = actionRenderPreview->renderedArea();
 
-        const auto successfullyComittedPreview = this->actionRenderPreview->commit();
+        const auto successfullyComittedPreview = actionRenderPreview->commit();
         assert( successfullyComittedPreview );
 
         if( !successfullyComittedPreview ) {
@@ -1024,6 +1224,10 @@ bool App::updatePreview() {
             return false;
         }
 
+        if( level > zoomLevel ) {
+            this->shouldRender = true; /** refined by the next frame */
+        }
+
         this->m_FrameTimer.restart();
         return true;
     }
@@ -6,6 +6,9 @@
 
 #include <gl/glew.h>
 
+#include <algorithm>
+#include <cmath>
+
 #ifdef _WIN32
 #   include <Windows.h>
 #   include <gl/GL.h>
@@ -18,6 +21,7 @@ GraphicsView::GraphicsView() :
     m_ImageLayer( nullptr ),
     m_OriginalImageLayer( nullptr ),
     m_ZoomFactor( 1.0 ),
+    m_LayerScale( 1.0f ),
     m_ShowOriginalImage( false ) {}
 
 GraphicsView::GraphicsView(
@@ -28,6 +32,7 @@ GraphicsView::GraphicsView(
     m_OriginalImageLayer( originalImageLayer ),
     m_Viewport( viewport ),
     m_ZoomFactor( 1.0 ),
+    m_LayerScale( 1.0f ),
     m_ShowOriginalImage( false ) {
 
     assert( layer != nullptr );
@@ -60,6 +65,23 @@ void GraphicsView::setOriginalLayer( libgraphics::ImageLayer* layer ) {
     this->m_OriginalImageLayer = layer;
 }
 
+float                           GraphicsView::layerScale() const {
+    return this->m_LayerScale;
+}
+
+void GraphicsView::setLayerScale( float scale ) {
+    assert( scale > 0.0f );
+    this->m_LayerScale = scale;
+}
+
+float                           GraphicsView::imageWidth() const {
+    return ( float )this->m_ImageLayer->width() * this->m_LayerScale;
+}
+
+float                           GraphicsView::imageHeight() const {
+    return ( float )this->m_ImageLayer->height() * this->m_LayerScale;
+}
+
 const libgraphics::Point32F&    GraphicsView::center() const {
     return this->m_Center;
 }
@@ -98,8 +120,8 @@ void            GraphicsView::setZoom( double delta ) {
         return;
     }
 
-    const float ratioWidth      = ( float )this->m_Viewport.width / ( float )this->m_ImageLayer->width();
-    const float ratioHeight     = ( float )this->m_Viewport.height / ( float )this->m_ImageLayer->height();
+    const float ratioWidth      = ( float )this->m_Viewport.width / this->imageWidth();
+    const float ratioHeight     = ( float )this->m_Viewport.height / this->imageHeight();
 
     const float lower           = 0.5f * std::min<float>( ratioWidth, ratioHeight );
 
@@ -128,6 +150,30 @@ bool            GraphicsView::valid() const {
     return ( this->m_ImageLayer != nullptr ) && ( this->m_OriginalImageLayer != nullptr );
 }
 
+libgraphics::Rect32I    GraphicsView::visibleArea() const {
+    if( !valid() ) {
+        return libgraphics::Rect32I();
+    }
+
+    const float relativeWidth   = this->m_Viewport.width / this->m_ZoomFactor;
+    const float relativeHeight  = this->m_Viewport.height / this->m_ZoomFactor;
+
+    /// inverse of the transformation in update()
+    const float left    = ( this->imageWidth() / 2.0f ) - ( m_Center.x - ( this->m_Viewport.width / 2.0f ) ) - ( relativeWidth / 2.0f );
+    const float top     = ( this->imageHeight() / 2.0f ) - ( m_Center.y - ( this->m_Viewport.height / 2.0f ) ) - ( relativeHeight / 2.0f );
+
+    const int x0 = std::max( ( int )std::floor( left / this->m_LayerScale ), 0 );
+    const int y0 = std::max( ( int )std::floor( top / this->m_LayerScale ), 0 );
+    const int x1 = std::min( ( int )std::ceil( ( left + relativeWidth ) / this->m_LayerScale ), ( int )this->m_ImageLayer->width() );
+    const int y1 = std::min( ( int )std::ceil( ( top + relativeHeight ) / this->m_LayerScale ), ( int )this->m_ImageLayer->height() );
+
+    if( ( x1 <= x0 ) || ( y1 <= y0 ) ) {
+        return libgraphics::Rect32I();
+    }
+
+    return libgraphics::Rect32I( x0, y0, x1 - x0, y1 - y0 );
+}
+
 ///
 void            GraphicsView::fitImage(
     GraphicsView::EDimension dimension
@@ -136,8 +182,8 @@ void            GraphicsView::fitImage(
         return;
     }
 
-    const float ratioWidth    = ( float )this->m_Viewport.width / ( float )this->m_ImageLayer->width();
-    const float ratioHeight   = ( float )this->m_Viewport.height / ( float )this->m_ImageLayer->height();
+    const float ratioWidth    = ( float )this->m_Viewport.width / this->imageWidth();
+    const float ratioHeight   = ( float )this->m_Viewport.height / this->imageHeight();
 
     float ratio( 1.0f );
 
@@ -203,8 +249,9 @@ void GraphicsView::update() {
     glMatrixMode( GL_MODELVIEW );
     glLoadIdentity();
 
-    glTranslatef( -( this->m_ImageLayer->width() / 2.0f ), -( this->m_ImageLayer->height() / 2.0f ), 0.0f );
+    glTranslatef( -( this->imageWidth() / 2.0f ), -( this->imageHeight() / 2.0f ), 0.0f );
     glTranslatef( ( m_Center.x - ( this->m_Viewport.width / 2.0f ) ), ( m_Center.y - ( this->m_Viewport.height / 2.0f ) ), 0.0f );
+    glScalef( this->m_LayerScale, this->m_LayerScale, 1.0f );
 }
 
 void GraphicsView::render() {
@@ -228,7 +275,7 @@ void GraphicsView::render() {
         return;
     }
 
-    libgraphics::backend::gl::ImageObject* glBaseImage = ( libgraphics::backend::gl::ImageObject* )imageLayerToShow->internalImageForBackend( FXAPI_BACKEND_OPENGL );
+    libgraphics::backend::gl::ImageObject* glBaseImage = ( libgraphics::backend::gl::ImageObject* )imageLayerToShow->sourceImageForBackend( FXAPI_BACKEND_OPENGL );
     assert( glBaseImage != nullptr );
 
     if( glBaseImage == nullptr ) {
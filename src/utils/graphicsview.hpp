@@ -25,6 +25,12 @@ class GraphicsView : public libcommon::INonCopyable {
         libgraphics::ImageLayer*        originalLayer() const;
         void setOriginalLayer( libgraphics::ImageLayer* layer );
 
+        /// size of a layer pixel in view units. zoom and
+        /// center stay the same, if a layer is replaced by a
+        /// scaled copy with the matching scale.
+        float                           layerScale() const;
+        void setLayerScale( float scale );
+
         const libgraphics::Point32F&    center() const;
         libgraphics::Point32F&          center();
         void                            move(
@@ -48,6 +54,10 @@ class GraphicsView : public libcommon::INonCopyable {
 
         bool            valid() const;
 
+        /// returns the part of the layer shown in the
+        /// viewport, or an empty rect if none is shown.
+        libgraphics::Rect32I    visibleArea() const;
+
         ///
         enum EDimension : unsigned short {
             Horizontal,
@@ -64,12 +74,16 @@ class GraphicsView : public libcommon::INonCopyable {
         void update();
         void render();
     protected:
+        float imageWidth() const;
+        float imageHeight() const;
+
         libgraphics::ImageLayer*    m_ImageLayer;
         libgraphics::ImageLayer*    m_OriginalImageLayer;
 
         libgraphics::Rect32UI       m_Viewport;
         libgraphics::Point32F       m_Center;
         double                      m_ZoomFactor;
+        float                       m_LayerScale;
 
         bool                        m_ShowOriginalImage;
 };
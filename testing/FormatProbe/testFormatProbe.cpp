@@ -0,0 +1,101 @@
+
+#include <QString>
+#include <QByteArray>
+#include <QtTest>
+
+#include <libgraphics/io/pipeline.hpp>
+#include <libgraphics/io/pipelineformatprobe.hpp>
+
+class TestFormatProbe : public QObject {
+        Q_OBJECT
+
+    public:
+        TestFormatProbe();
+
+    private Q_SLOTS:
+        void testProbeFormatFromData();
+        void testProbeFormatFromData_data();
+        void testProbeFormatFromNull();
+        void testFormatFromExtension();
+        void testFormatFromExtension_data();
+};
+
+
+TestFormatProbe::TestFormatProbe() {
+}
+
+void TestFormatProbe::testProbeFormatFromData_data() {
+    QTest::addColumn<QByteArray>( "header" );
+    QTest::addColumn<QString>( "format" );
+
+    QTest::newRow( "jpeg" ) << QByteArray( "\xFF\xD8\xFF\xE0\0\x10JFIF", 10 ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG );
+    QTest::newRow( "png" ) << QByteArray( "\x89PNG\r\n\x1A\n\0\0\0\x0DIHDR", 16 ) << QString( LIBGRAPHICS_IO_FORMAT_PNG );
+    QTest::newRow( "tif little endian" ) << QByteArray( "II*\0\x08\0\0\0", 8 ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "tif big endian" ) << QByteArray( "MM\0*\0\0\0\x08", 8 ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "bigtiff little endian" ) << QByteArray( "II+\0\x08\0\0\0", 8 ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "bigtiff big endian" ) << QByteArray( "MM\0+\0\x08\0\0", 8 ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "jp2" ) << QByteArray( "\0\0\0\x0CjP  \r\n\x87\n", 12 ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG2000 );
+    QTest::newRow( "j2k codestream" ) << QByteArray( "\xFF\x4F\xFF\x51\0\x2F", 6 ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG2000 );
+    QTest::newRow( "bmp" ) << QByteArray( "BM\x36\0\x0C\0", 6 ) << QString( LIBGRAPHICS_IO_FORMAT_BMP );
+    QTest::newRow( "truncated png" ) << QByteArray( "\x89PNG", 4 ) << QString();
+    QTest::newRow( "truncated jpeg" ) << QByteArray( "\xFF\xD8", 2 ) << QString();
+    QTest::newRow( "text" ) << QByteArray( "hello world" ) << QString();
+    QTest::newRow( "empty" ) << QByteArray( "" ) << QString();
+}
+
+void TestFormatProbe::testProbeFormatFromData() {
+    QFETCH( QByteArray, header );
+    QFETCH( QString, format );
+
+    const std::string probed = libgraphics::io::probeFormatFromData(
+                                   header.constData(),
+                                   ( size_t )header.size()
+                               );
+
+    QCOMPARE( QString::fromStdString( probed ), format );
+}
+
+void TestFormatProbe::testProbeFormatFromNull() {
+    QVERIFY( libgraphics::io::probeFormatFromData( nullptr, 0 ).empty() );
+}
+
+void TestFormatProbe::testFormatFromExtension_data() {
+    QTest::addColumn<QString>( "path" );
+    QTest::addColumn<QString>( "format" );
+
+    QTest::newRow( "jpg" ) << QString( "image.jpg" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG );
+    QTest::newRow( "jpeg" ) << QString( "image.jpeg" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG );
+    QTest::newRow( "jpe" ) << QString( "image.jpe" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG );
+    QTest::newRow( "upper case" ) << QString( "IMAGE.JPG" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG );
+    QTest::newRow( "mixed case" ) << QString( "image.TiFf" ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "tif" ) << QString( "image.tif" ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "png" ) << QString( "image.png" ) << QString( LIBGRAPHICS_IO_FORMAT_PNG );
+    QTest::newRow( "bmp" ) << QString( "image.bmp" ) << QString( LIBGRAPHICS_IO_FORMAT_BMP );
+    QTest::newRow( "dib" ) << QString( "image.dib" ) << QString( LIBGRAPHICS_IO_FORMAT_BMP );
+    QTest::newRow( "jp2" ) << QString( "image.jp2" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG2000 );
+    QTest::newRow( "j2k" ) << QString( "image.j2k" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG2000 );
+    QTest::newRow( "jpf" ) << QString( "image.jpf" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG2000 );
+    QTest::newRow( "last extension" ) << QString( "image.png.jpg" ) << QString( LIBGRAPHICS_IO_FORMAT_JPEG );
+    QTest::newRow( "unix path" ) << QString( "/home/user/photos/image.png" ) << QString( LIBGRAPHICS_IO_FORMAT_PNG );
+    QTest::newRow( "windows path" ) << QString( "C:\\photos\\image.tif" ) << QString( LIBGRAPHICS_IO_FORMAT_TIF );
+    QTest::newRow( "unknown" ) << QString( "image.gif" ) << QString();
+    QTest::newRow( "no extension" ) << QString( "image" ) << QString();
+    QTest::newRow( "trailing dot" ) << QString( "image." ) << QString();
+    QTest::newRow( "dot in unix directory" ) << QString( "/home/user/photos.jpg/image" ) << QString();
+    QTest::newRow( "dot in windows directory" ) << QString( "C:\\photos.jpg\\image" ) << QString();
+}
+
+void TestFormatProbe::testFormatFromExtension() {
+    QFETCH( QString, path );
+    QFETCH( QString, format );
+
+    const std::string mapped = libgraphics::io::formatFromExtension(
+                                   path.toStdString().c_str()
+                               );
+
+    QCOMPARE( QString::fromStdString( mapped ), format );
+}
+
+QTEST_APPLESS_MAIN( TestFormatProbe )
+
+#include "testFormatProbe.moc"
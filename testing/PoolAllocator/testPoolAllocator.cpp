@@ -0,0 +1,158 @@
+
+#include <QtTest>
+
+#include <libgraphics/allocator.hpp>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+class TestPoolAllocator : public QObject {
+        Q_OBJECT
+
+        typedef libgraphics::StdDynamicPoolAllocator Allocator;
+
+    public:
+        TestPoolAllocator();
+
+    private Q_SLOTS:
+        void testSizeClasses();
+        void testSizeClasses_data();
+        void testThreadCacheReuse();
+        void testThreadCacheRelease();
+        void testThreadCacheDepth();
+        void testForeignThreadRelease();
+        void testLargeBlobs();
+};
+
+
+TestPoolAllocator::TestPoolAllocator() {
+}
+
+void TestPoolAllocator::testSizeClasses_data() {
+    QTest::addColumn<int>( "first" );
+    QTest::addColumn<int>( "second" );
+    QTest::addColumn<bool>( "shared" );
+
+    QTest::newRow( "minimum class" ) << 1 << 64 << true;
+    QTest::newRow( "same class" ) << 100 << 128 << true;
+    QTest::newRow( "class boundary" ) << 128 << 129 << false;
+    QTest::newRow( "largest class" ) << 40000 << 65536 << true;
+    QTest::newRow( "large blob" ) << 65536 << 65537 << false;
+}
+
+void TestPoolAllocator::testSizeClasses() {
+    QFETCH( int, first );
+    QFETCH( int, second );
+    QFETCH( bool, shared );
+
+    Allocator allocator( libgraphics::AllocatorPolicy( 1, libgraphics::AllocatorPolicy::DefaultAlignment, false ) );
+
+    const auto firstBlob = allocator.alloc( ( size_t )first );
+    const auto secondBlob = allocator.alloc( ( size_t )second );
+
+    QVERIFY( firstBlob->data != nullptr );
+    QVERIFY( secondBlob->data != nullptr );
+    QVERIFY( firstBlob->data != secondBlob->data );
+
+    QCOMPARE( allocator.size(), ( size_t )2 );
+    QCOMPARE( allocator.capacity(), ( size_t )2 );
+
+    QCOMPARE( allocator.countUsedOfSize( ( size_t )first ), ( size_t )( shared ? 2 : 1 ) );
+    QCOMPARE( allocator.countUsedOfSize( ( size_t )second ), ( size_t )( shared ? 2 : 1 ) );
+}
+
+void TestPoolAllocator::testThreadCacheReuse() {
+    Allocator allocator;
+
+    auto blob = allocator.alloc( 100 );
+    void* const data = blob->data;
+
+    blob.reset();
+
+    /** the released entry stays in the thread cache, but counts as unused **/
+    QCOMPARE( allocator.size(), ( size_t )0 );
+    QCOMPARE( allocator.capacity(), ( size_t )1 );
+    QCOMPARE( allocator.countUsedOfSize( 100 ), ( size_t )0 );
+    QCOMPARE( allocator.countUnusedOfSize( 100 ), ( size_t )1 );
+    QCOMPARE( allocator.queryMemoryConsumption(), ( size_t )0 );
+
+    blob = allocator.alloc( 120 );
+
+    QVERIFY( blob->data == data );
+    QCOMPARE( allocator.size(), ( size_t )1 );
+    QCOMPARE( allocator.capacity(), ( size_t )1 );
+    QCOMPARE( allocator.countUsedOfSize( 128 ), ( size_t )1 );
+    QCOMPARE( allocator.countUnusedOfSize( 128 ), ( size_t )0 );
+}
+
+void TestPoolAllocator::testThreadCacheRelease() {
+    Allocator allocator;
+
+    allocator.alloc( 256 ).reset();
+
+    QCOMPARE( allocator.countUnusedOfSize( 256 ), ( size_t )1 );
+
+    /** cached entries are owned by the thread, they are not freed **/
+    QCOMPARE( allocator.releaseUnused(), ( size_t )0 );
+    QCOMPARE( allocator.capacity(), ( size_t )1 );
+    QCOMPARE( allocator.countUnusedOfSize( 256 ), ( size_t )1 );
+}
+
+void TestPoolAllocator::testThreadCacheDepth() {
+    Allocator allocator;
+
+    const size_t count = Allocator::ThreadCacheDepth + 2;
+    std::vector< std::shared_ptr<Allocator::Blob> > blobs;
+
+    for( size_t i = 0; count > i; ++i ) {
+        blobs.push_back( allocator.alloc( 512 ) );
+    }
+
+    blobs.clear();
+
+    /** entries beyond the cache depth go back to the bin **/
+    QCOMPARE( allocator.countUnusedOfSize( 512 ), count );
+    QCOMPARE( allocator.releaseUnused(), count - Allocator::ThreadCacheDepth );
+    QCOMPARE( allocator.capacity(), ( size_t )Allocator::ThreadCacheDepth );
+}
+
+void TestPoolAllocator::testForeignThreadRelease() {
+    Allocator allocator;
+
+    auto blob = allocator.alloc( 1024 );
+    void* const data = blob->data;
+
+    /** the releasing thread returns its cached entries on exit **/
+    std::thread worker( [&blob]() {
+        blob.reset();
+    } );
+    worker.join();
+
+    QCOMPARE( allocator.size(), ( size_t )0 );
+    QCOMPARE( allocator.countUnusedOfSize( 1024 ), ( size_t )1 );
+
+    blob = allocator.alloc( 1024 );
+
+    QVERIFY( blob->data == data );
+    QCOMPARE( allocator.capacity(), ( size_t )1 );
+}
+
+void TestPoolAllocator::testLargeBlobs() {
+    Allocator allocator;
+
+    const size_t length = Allocator::SmallBlobLength + 1;
+
+    allocator.alloc( length ).reset();
+
+    /** large blobs bypass the thread cache **/
+    QCOMPARE( allocator.size(), ( size_t )0 );
+    QCOMPARE( allocator.countUnusedOfSize( length ), ( size_t )1 );
+    QCOMPARE( allocator.releaseUnused(), ( size_t )1 );
+    QCOMPARE( allocator.capacity(), ( size_t )0 );
+    QCOMPARE( allocator.countUnusedOfSize( length ), ( size_t )0 );
+}
+
+QTEST_APPLESS_MAIN( TestPoolAllocator )
+
+#include "testPoolAllocator.moc"
@@ -0,0 +1,204 @@
+
+#include <QtTest>
+
+#include <libgraphics/spillfile.hpp>
+
+#include <cstring>
+#include <vector>
+
+class TestSpillFile : public QObject {
+        Q_OBJECT
+
+        typedef libgraphics::SpillFile::Region Region;
+
+    public:
+        TestSpillFile();
+
+    private Q_SLOTS:
+        void testAllocate();
+        void testAllocate_data();
+        void testReuse();
+        void testSplit();
+        void testMerge();
+        void testMerge_data();
+        void testUsage();
+        void testMapping();
+};
+
+
+TestSpillFile::TestSpillFile() {
+}
+
+void TestSpillFile::testAllocate_data() {
+    QTest::addColumn<int>( "length" );
+    QTest::addColumn<int>( "regions" );
+
+    QTest::newRow( "single byte" ) << 1 << 1;
+    QTest::newRow( "exact" ) << ( int )libgraphics::SpillFile::RegionAlignment << 1;
+    QTest::newRow( "one more" ) << ( int )libgraphics::SpillFile::RegionAlignment + 1 << 2;
+    QTest::newRow( "several" ) << ( int )libgraphics::SpillFile::RegionAlignment * 3 - 100 << 3;
+}
+
+void TestSpillFile::testAllocate() {
+    QFETCH( int, length );
+    QFETCH( int, regions );
+
+    libgraphics::SpillFile file;
+    QVERIFY( file.valid() );
+
+    const Region first = file.allocate( ( size_t )length );
+    const Region second = file.allocate( ( size_t )length );
+
+    QCOMPARE( first.offset, ( size_t )0 );
+    QCOMPARE( first.length, ( size_t )regions * libgraphics::SpillFile::RegionAlignment );
+    QCOMPARE( second.offset, first.length );
+    QCOMPARE( second.length, first.length );
+}
+
+void TestSpillFile::testReuse() {
+    libgraphics::SpillFile file;
+    QVERIFY( file.valid() );
+
+    const Region first = file.allocate( 1000 );
+    const Region second = file.allocate( 1000 );
+    const Region third = file.allocate( 1000 );
+
+    file.release( second );
+
+    const Region reused = file.allocate( 1000 );
+
+    QCOMPARE( reused.offset, second.offset );
+    QCOMPARE( reused.length, second.length );
+
+    /** no free region is left, the file grows **/
+    const Region grown = file.allocate( 1000 );
+    QCOMPARE( grown.offset, third.offset + third.length );
+
+    file.release( first );
+    file.release( reused );
+    file.release( third );
+    file.release( grown );
+}
+
+void TestSpillFile::testSplit() {
+    libgraphics::SpillFile file;
+    QVERIFY( file.valid() );
+
+    const size_t alignment = libgraphics::SpillFile::RegionAlignment;
+
+    const Region large = file.allocate( alignment * 3 );
+    const Region tail = file.allocate( alignment );
+
+    file.release( large );
+
+    /** the front of the free region is taken, the rest stays free **/
+    const Region first = file.allocate( alignment );
+    const Region second = file.allocate( alignment * 2 );
+
+    QCOMPARE( first.offset, large.offset );
+    QCOMPARE( second.offset, large.offset + alignment );
+    QCOMPARE( file.allocate( 1 ).offset, tail.offset + tail.length );
+}
+
+void TestSpillFile::testMerge_data() {
+    QTest::addColumn<bool>( "reversed" );
+
+    QTest::newRow( "ascending" ) << false;
+    QTest::newRow( "descending" ) << true;
+}
+
+void TestSpillFile::testMerge() {
+    QFETCH( bool, reversed );
+
+    libgraphics::SpillFile file;
+    QVERIFY( file.valid() );
+
+    const size_t alignment = libgraphics::SpillFile::RegionAlignment;
+
+    const Region a = file.allocate( alignment );
+    const Region b = file.allocate( alignment );
+    const Region c = file.allocate( alignment );
+    const Region d = file.allocate( alignment );
+
+    if( reversed ) {
+        file.release( c );
+        file.release( b );
+        file.release( a );
+    } else {
+        file.release( a );
+        file.release( b );
+        file.release( c );
+    }
+
+    /** a, b and c are merged into a single free region **/
+    const Region merged = file.allocate( alignment * 3 );
+
+    QCOMPARE( merged.offset, a.offset );
+    QCOMPARE( merged.length, alignment * 3 );
+    QCOMPARE( file.allocate( alignment ).offset, d.offset + d.length );
+}
+
+void TestSpillFile::testUsage() {
+    libgraphics::SpillFile file;
+    QVERIFY( file.valid() );
+
+    const size_t alignment = libgraphics::SpillFile::RegionAlignment;
+
+    QCOMPARE( file.usage(), ( size_t )0 );
+
+    const Region first = file.allocate( 1 );
+    const Region second = file.allocate( alignment + 1 );
+
+    QCOMPARE( file.usage(), alignment * 3 );
+
+    file.release( first );
+    QCOMPARE( file.usage(), alignment * 2 );
+
+    file.release( second );
+    QCOMPARE( file.usage(), ( size_t )0 );
+
+    /** empty regions are ignored **/
+    file.release( Region() );
+    QCOMPARE( file.usage(), ( size_t )0 );
+}
+
+void TestSpillFile::testMapping() {
+    libgraphics::SpillFile file;
+    QVERIFY( file.valid() );
+
+    const size_t alignment = libgraphics::SpillFile::RegionAlignment;
+
+    const Region first = file.allocate( alignment );
+    const Region second = file.allocate( alignment );
+
+    unsigned char* data = ( unsigned char* )file.map( second );
+    QVERIFY( data != nullptr );
+
+    for( size_t i = 0; alignment > i; ++i ) {
+        data[i] = ( unsigned char )( i * 7 );
+    }
+
+    file.unmap( data, second );
+
+    /** the neighbour is not touched **/
+    data = ( unsigned char* )file.map( first );
+    QVERIFY( data != nullptr );
+
+    std::vector<unsigned char> zeros( alignment, 0 );
+    QVERIFY( std::memcmp( data, zeros.data(), alignment ) == 0 );
+
+    file.unmap( data, first );
+
+    data = ( unsigned char* )file.map( second );
+    QVERIFY( data != nullptr );
+
+    for( size_t i = 0; alignment > i; ++i ) {
+        QCOMPARE( data[i], ( unsigned char )( i * 7 ) );
+    }
+
+    file.unmap( data, second );
+}
+
+QTEST_APPLESS_MAIN( TestSpillFile )
+
+#include "testSpillFile.moc"
@@ -0,0 +1,32 @@
+QT       += opengl testlib
+
+TARGET = testSpillFile
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+DESTDIR  += bin
+
+OBJECTS_DIR = meta
+MOC_DIR = meta
+UI_DIR = meta
+RCC_DIR = meta
+
+PRI_DIR = ../../build/commons/qmake/blacksilk/include
+SRC_DIR = ../../src
+
+macx: include( $${PRI_DIR}/mac.pri )
+unix: !macx: include( $${PRI_DIR}/linux.pri )
+
+include( $${PRI_DIR}/log.pri )
+include( $${PRI_DIR}/graphics.pri )
+
+include( $${PRI_DIR}/libgraphics.pri )
+include( $${PRI_DIR}/libcommon.pri )
+
+INCLUDEPATH +=  $${SRC_DIR} \
+                . \
+
+SOURCES +=  testSpillFile.cpp
+
+DEFINES += SRCDIR=\\\"$$PWD/\\\"
@@ -38,7 +38,7 @@ case $(uname) in
         ;;
 esac
 
-TESTS="ColorSpaces Mixer YUVFrame ImageMagick trialversion"
+TESTS="ColorSpaces Mixer YUVFrame ImageMagick FormatProbe PoolAllocator SpillFile trialversion"
 
 for test in $TESTS; do
     (